@@ -0,0 +1,63 @@
+/***************************************************************************************************
+ * Program Name: Adjacency.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Adjacency struct that records which spaces of the board border each other. This
+ * 		file defines the names of the directions and the table of the map of Rome, and
+ * 		implements the hashing and equality functions. See Adjacency.hpp.
+ **************************************************************************************************/
+#include "Adjacency.hpp"
+#include <cstring>
+#include "HashBytes.hpp"
+
+const char* const DIRECTION_NAMES[NUM_DIRECTIONS] = {"North", "Northeast", "East", "Southeast",
+						    "South", "Southwest", "West", "Northwest"};
+
+// Shorter name for NO_NEIGHBOR so that each row of the table fits on one line
+const std::uint8_t X = NO_NEIGHBOR;
+
+// Each row lists the neighbors of one location (space number - 1) in the order
+// N, NE, E, SE, S, SW, W, NW. Each bitmask has bit d set when direction d has a
+// neighbor (bit 0 is north).
+const Adjacency ROME_ADJACENCY =
+{
+	{
+		{X, X, 1, 4, 3, X, X, X},	// Space 1 (Bibliotheca)
+		{X, X, 2, 5, 4, 3, 0, X},	// Space 2 (Domus Aurea)
+		{X, X, X, X, 5, 4, 1, X},	// Space 3 (Ludus)
+		{0, 1, 4, 7, 6, X, X, X},	// Space 4 (Circus Maximus)
+		{1, 2, 5, 8, 7, 6, 3, 0},	// Space 5 (Forum)
+		{2, X, X, X, 8, 7, 4, 1},	// Space 6 (Theatrum)
+		{3, 4, 7, X, X, X, X, X},	// Space 7 (Colosseum)
+		{4, 5, 8, X, X, X, 6, 3},	// Space 8 (Thermae)
+		{5, X, X, X, X, X, 7, 4}	// Space 9 (Campus Martius)
+	},
+	{0x1C, 0x7C, 0x70, 0x1F, 0xFF, 0xF1, 0x07, 0xC7, 0xC1}
+};
+
+
+/***************************************************************************************************
+ * Description: Equality operators that compare two tables byte by byte. Each receives the table
+ * 		to compare with and returns whether or not the tables are equal (or not equal).
+ ***************************************************************************************************/
+
+bool Adjacency::operator==(const Adjacency& other) const
+{
+	return std::memcmp(this, &other, sizeof(Adjacency)) == 0;
+}
+
+bool Adjacency::operator!=(const Adjacency& other) const
+{
+	return !(*this == other);
+}
+
+
+/***************************************************************************************************
+ * Description: Function that receives a table and returns a hash of all of its bytes (see
+ * 		hash_bytes).
+ ***************************************************************************************************/
+
+std::size_t hash_adjacency(const Adjacency& adjacency)
+{
+	return hash_bytes(&adjacency, sizeof(Adjacency));
+}
@@ -0,0 +1,63 @@
+/***************************************************************************************************
+ * Program Name: Adjacency.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Adjacency struct that records which spaces of the board border each other. For
+ * 		each location (space number - 1) and each of the 8 directions, the table holds the
+ * 		location of the neighboring space (or NO_NEIGHBOR at the edge of the map), and a
+ * 		bitmask per location holds one bit for each direction in which the player can move.
+ * 		Looking up a neighbor or checking a move is therefore a single indexed load.
+ *
+ * 		Like the GameState, the struct contains only bytes, so it has no padding, can be
+ * 		copied with memcpy, and can be hashed and compared byte by byte. The table of the
+ * 		map of Rome is the one from which the GameMap of Rome shared by every Board is built
+ * 		(see GameMap.hpp, which stores maps of any size in compressed sparse row form).
+ *
+ * 		Data members of the struct include the following:
+ * 		- A table of the location of the neighbor of each location in each direction
+ * 		- A bitmask of the valid directions from each location
+ *
+ * 		The Direction enum class, the names of the directions, the shared table of the map
+ * 		of Rome, and a hashing function are also declared in this header file.
+ **************************************************************************************************/
+#ifndef ADJACENCY_HPP
+#define ADJACENCY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Constant indicating the number of spaces on the board
+const int NUM_SPACES = 9;
+
+// Constant indicating the number of directions in which the player can move
+const int NUM_DIRECTIONS = 8;
+
+// Value stored in the table for a direction in which there is no space
+const std::uint8_t NO_NEIGHBOR = 0xFF;
+
+// Enum class that defines Direction data type
+// (the order matches the order of the choices in the move menu)
+enum class Direction{N, NE, E, SE, S, SW, W, NW};
+
+// Names of the directions, indexed by Direction
+extern const char* const DIRECTION_NAMES[NUM_DIRECTIONS];
+
+struct Adjacency
+{
+	std::uint8_t neighbor[NUM_SPACES][NUM_DIRECTIONS];
+	std::uint8_t validMask[NUM_SPACES];
+
+	bool operator==(const Adjacency& other) const;
+	bool operator!=(const Adjacency& other) const;
+};
+
+static_assert(std::is_trivially_copyable<Adjacency>::value, "Adjacency must be trivially copyable");
+static_assert(sizeof(Adjacency) == NUM_SPACES * (NUM_DIRECTIONS + 1), "Adjacency must not contain padding");
+
+// Table of the map of Rome (a 3 x 3 grid of spaces numbered 1-9 from the top left)
+extern const Adjacency ROME_ADJACENCY;
+
+// Function that returns a hash of all bytes of a table
+std::size_t hash_adjacency(const Adjacency& adjacency);
+#endif
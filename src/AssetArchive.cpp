@@ -0,0 +1,333 @@
+/***************************************************************************************************
+ * Program Name: AssetArchive.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: AssetArchive class that reads the game's text content from a single packed binary
+ * 		archive mapped into memory with mmap. The archive holds the text of every asset,
+ * 		the text already split into sections at every '#', and the trivia questions already
+ * 		parsed, so loading it takes one open, one mmap, and no parsing (or, for an archive
+ * 		embedded in the executable, no system calls at all). See AssetArchive.hpp for the
+ * 		layout of the archive.
+ **************************************************************************************************/
+#include "AssetArchive.hpp"
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include "Content.hpp"
+
+static_assert(sizeof(ArchiveQuestion::answerChoices) / sizeof(ArchiveSpan) == NUM_CHOICES,
+	      "ArchiveQuestion must hold NUM_CHOICES answer choices");
+
+
+/***************************************************************************************************
+ * Description: Constructor that creates an archive with nothing opened.
+ ***************************************************************************************************/
+
+AssetArchive::AssetArchive()
+{
+	data = nullptr;
+	dataSize = 0;
+	mapped = false;
+	header = nullptr;
+	assets = nullptr;
+	sections = nullptr;
+	questions = nullptr;
+	text = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor that unmaps the archive file (if one is mapped).
+ ***************************************************************************************************/
+
+AssetArchive::~AssetArchive()
+{
+	close();
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of an archive file and maps it into memory. Returns true if the
+ * 		file was mapped and is a valid archive for this version of the game, or false (with
+ * 		nothing mapped) if the file does not exist or is not a valid archive.
+ ***************************************************************************************************/
+
+bool AssetArchive::open(const char* fileName)
+{
+	close();
+
+	int fd = ::open(fileName, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat fileInfo;
+	if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size < static_cast<off_t>(sizeof(ArchiveHeader)))
+	{
+		::close(fd);
+		return false;
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	std::size_t size = static_cast<std::size_t>(fileInfo.st_size);
+	void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+
+	mapped = true;
+	return open_memory(mapping, size);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a pointer to the bytes of an archive that is already in memory (such as
+ * 		the archive embedded in the executable) and their size. The bytes must stay valid
+ * 		for as long as the archive is used. Returns true if the bytes are a valid archive
+ * 		for this version of the game, or false (with nothing opened) if they are not.
+ ***************************************************************************************************/
+
+bool AssetArchive::open_memory(const void* bytes, std::size_t size)
+{
+	data = static_cast<const char*>(bytes);
+	dataSize = size;
+	if (size < sizeof(ArchiveHeader))
+	{
+		close();
+		return false;
+	}
+
+	// Locate each table, which follow one another after the header
+	header = reinterpret_cast<const ArchiveHeader*>(data);
+	std::size_t offset = sizeof(ArchiveHeader);
+	assets = reinterpret_cast<const ArchiveAsset*>(data + offset);
+	offset += static_cast<std::size_t>(header->numAssets) * sizeof(ArchiveAsset);
+	sections = reinterpret_cast<const ArchiveSpan*>(data + offset);
+	offset += static_cast<std::size_t>(header->numSections) * sizeof(ArchiveSpan);
+	questions = reinterpret_cast<const ArchiveQuestion*>(data + offset);
+	offset += static_cast<std::size_t>(header->numQuestions) * sizeof(ArchiveQuestion);
+	text = data + offset;
+
+	if (!validate())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that checks that the mapped file is an archive of the
+ * 		expected version with one entry for each Asset and trivia question, and that every
+ * 		table, section, and question lies within the file. Returns a bool indicating whether
+ * 		or not the archive is valid.
+ ***************************************************************************************************/
+
+bool AssetArchive::validate() const
+{
+	if (header->magic != ARCHIVE_MAGIC || header->version != ARCHIVE_VERSION ||
+	    header->numAssets != static_cast<std::uint32_t>(NUM_ASSETS) ||
+	    header->numQuestions != static_cast<std::uint32_t>(NUM_QUESTIONS))
+	{
+		return false;
+	}
+
+	// The tables and text must exactly fill the file
+	std::uint64_t expectedSize = sizeof(ArchiveHeader) +
+		static_cast<std::uint64_t>(header->numAssets) * sizeof(ArchiveAsset) +
+		static_cast<std::uint64_t>(header->numSections) * sizeof(ArchiveSpan) +
+		static_cast<std::uint64_t>(header->numQuestions) * sizeof(ArchiveQuestion) + header->textSize;
+	if (expectedSize != dataSize)
+	{
+		return false;
+	}
+
+	// Every span must lie within the text
+	auto inText = [this](const ArchiveSpan& span)
+	{
+		return static_cast<std::uint64_t>(span.offset) + span.length <= header->textSize;
+	};
+
+	for (std::uint32_t index = 0; index < header->numAssets; index++)
+	{
+		if (!inText(assets[index].text) ||
+		    static_cast<std::uint64_t>(assets[index].firstSection) + assets[index].numSections > header->numSections)
+		{
+			return false;
+		}
+	}
+	for (std::uint32_t index = 0; index < header->numSections; index++)
+	{
+		if (!inText(sections[index]))
+		{
+			return false;
+		}
+	}
+	for (std::uint32_t index = 0; index < header->numQuestions; index++)
+	{
+		if (!inText(questions[index].questionText))
+		{
+			return false;
+		}
+		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
+		{
+			if (!inText(questions[index].answerChoices[choiceNum]))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that closes the archive, unmapping the archive file if
+ * 		one is mapped. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void AssetArchive::close()
+{
+	if (mapped)
+	{
+		munmap(const_cast<char*>(data), dataSize);
+	}
+	data = nullptr;
+	dataSize = 0;
+	mapped = false;
+	header = nullptr;
+	assets = nullptr;
+	sections = nullptr;
+	questions = nullptr;
+	text = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods for the mapped archive. is_open() returns whether or not a valid
+ * 		archive is mapped. The remaining accessors return the number of assets and
+ * 		questions, the entry for the asset, section, or question at a given index, and the
+ * 		text that a span refers to.
+ ***************************************************************************************************/
+
+bool AssetArchive::is_open() const
+{
+	return this->data != nullptr;
+}
+
+int AssetArchive::num_assets() const
+{
+	return static_cast<int>(this->header->numAssets);
+}
+
+int AssetArchive::num_questions() const
+{
+	return static_cast<int>(this->header->numQuestions);
+}
+
+const ArchiveAsset& AssetArchive::asset(int index) const
+{
+	return this->assets[index];
+}
+
+const ArchiveSpan& AssetArchive::section(int index) const
+{
+	return this->sections[index];
+}
+
+const ArchiveQuestion& AssetArchive::question(int index) const
+{
+	return this->questions[index];
+}
+
+std::string_view AssetArchive::view(const ArchiveSpan& span) const
+{
+	return std::string_view(text + span.offset, span.length);
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives Content loaded from the text files. Returns the bytes
+ * 		of an archive holding the text of every asset, the offset and length of every
+ * 		section, and every parsed question.
+ ***************************************************************************************************/
+
+std::string AssetArchive::build(const Content& content)
+{
+	// Concatenate the text of every asset, remembering where each one starts
+	std::string allText;
+	std::vector<std::uint32_t> assetStart;
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		assetStart.push_back(static_cast<std::uint32_t>(allText.size()));
+		allText.append(content.asset_text(static_cast<Asset>(index)));
+	}
+
+	// Converts a view into the text of an asset into a span of the concatenated text
+	auto toSpan = [&](Asset asset, std::string_view piece)
+	{
+		ArchiveSpan span = {0, 0};
+		if (!piece.empty())
+		{
+			std::string_view assetText = content.asset_text(asset);
+			span.offset = assetStart[static_cast<int>(asset)] + static_cast<std::uint32_t>(piece.data() - assetText.data());
+			span.length = static_cast<std::uint32_t>(piece.size());
+		}
+		return span;
+	};
+
+	// Build the asset and section tables
+	std::vector<ArchiveAsset> assetTable;
+	std::vector<ArchiveSpan> sectionTable;
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		Asset asset = static_cast<Asset>(index);
+		ArchiveAsset entry;
+		entry.text = toSpan(asset, content.asset_text(asset));
+		entry.firstSection = static_cast<std::uint32_t>(sectionTable.size());
+		entry.numSections = static_cast<std::uint32_t>(content.sections(asset).size());
+		for (std::string_view piece : content.sections(asset))
+		{
+			sectionTable.push_back(toSpan(asset, piece));
+		}
+		assetTable.push_back(entry);
+	}
+
+	// Build the question table
+	std::vector<ArchiveQuestion> questionTable;
+	for (const Question& q : content.questions())
+	{
+		ArchiveQuestion entry;
+		entry.questionText = toSpan(Asset::LUDUS_QUESTIONS, q.questionText);
+		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
+		{
+			entry.answerChoices[choiceNum] = toSpan(Asset::LUDUS_QUESTIONS, q.answerChoices[choiceNum]);
+		}
+		entry.answerNum = q.answerNum;
+		questionTable.push_back(entry);
+	}
+
+	ArchiveHeader archiveHeader;
+	archiveHeader.magic = ARCHIVE_MAGIC;
+	archiveHeader.version = ARCHIVE_VERSION;
+	archiveHeader.numAssets = static_cast<std::uint32_t>(assetTable.size());
+	archiveHeader.numSections = static_cast<std::uint32_t>(sectionTable.size());
+	archiveHeader.numQuestions = static_cast<std::uint32_t>(questionTable.size());
+	archiveHeader.textSize = static_cast<std::uint32_t>(allText.size());
+
+	// Put together the header, the tables, and the text
+	std::string archiveBytes;
+	archiveBytes.append(reinterpret_cast<const char*>(&archiveHeader), sizeof(archiveHeader));
+	archiveBytes.append(reinterpret_cast<const char*>(assetTable.data()), assetTable.size() * sizeof(ArchiveAsset));
+	archiveBytes.append(reinterpret_cast<const char*>(sectionTable.data()), sectionTable.size() * sizeof(ArchiveSpan));
+	archiveBytes.append(reinterpret_cast<const char*>(questionTable.data()), questionTable.size() * sizeof(ArchiveQuestion));
+	archiveBytes.append(allText);
+	return archiveBytes;
+}
@@ -0,0 +1,128 @@
+/***************************************************************************************************
+ * Program Name: AssetArchive.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: AssetArchive class that reads the game's text content from a single packed binary
+ * 		archive instead of the 14 loose text files. The archive is built by the asset
+ * 		compiler (assetCompiler.cpp, "make Game_Assets.bin") and is mapped into memory with
+ * 		one mmap call. Every string handed out is a std::string_view pointing directly into
+ * 		the mapped pages, so nothing is copied, and processes running the game at the same
+ * 		time share the same physical pages.
+ *
+ * 		In the embedded build mode ("make embedded"), the asset compiler also writes the
+ * 		archive as a constant byte array in a generated source file (EmbeddedAssets.cpp)
+ * 		that is compiled into the executable with EMBED_ASSETS defined. The archive is then
+ * 		opened directly from the executable's read-only data, with no file I/O at all.
+ *
+ * 		The archive is laid out as follows (all integers are 32-bit and in the byte order of
+ * 		the machine that built the archive, which is checked by the magic number):
+ * 		- An ArchiveHeader (magic number, counts of assets, sections, and questions, and
+ * 		  the size of the text)
+ * 		- An ArchiveAsset for each Asset (where its text is and which sections are its own)
+ * 		- An ArchiveSpan (offset and length within the text) for each section, with the
+ * 		  text already split at every '#'
+ * 		- An ArchiveQuestion for each trivia question, already parsed into the question,
+ * 		  the answer choices, and the number of the correct answer
+ * 		- The text of every asset, one after the other
+ *
+ * 		Private data members of the AssetArchive class include the following:
+ * 		- A pointer to the archive's bytes, their size, and whether they were mapped from a file
+ * 		- Pointers to each table within the archive
+ *
+ * 		Public member functions of the AssetArchive class include the following:
+ * 		- A constructor and a destructor (which unmaps the archive if it was mapped)
+ * 		- Functions that open and validate an archive file or an archive already in memory
+ * 		- Accessors for the text, sections, and questions in the archive
+ * 		- A static function that builds the bytes of an archive from loaded Content
+ **************************************************************************************************/
+#ifndef ASSETARCHIVE_HPP
+#define ASSETARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Name of the archive file built by the asset compiler
+const char ARCHIVE_FILE_NAME[] = "Game_Assets.bin";
+
+#ifdef EMBED_ASSETS
+// Archive compiled into the executable (defined in the generated EmbeddedAssets.cpp)
+extern const unsigned char EMBEDDED_ARCHIVE[];
+extern const std::size_t EMBEDDED_ARCHIVE_SIZE;
+#endif
+
+// Number identifying a file as an archive (also detects a different byte order)
+const std::uint32_t ARCHIVE_MAGIC = 0x4E45524F;		// "NERO"
+const std::uint32_t ARCHIVE_VERSION = 1;
+
+// Structs making up the tables of the archive
+struct ArchiveHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint32_t numAssets;
+	std::uint32_t numSections;
+	std::uint32_t numQuestions;
+	std::uint32_t textSize;
+};
+
+struct ArchiveSpan
+{
+	std::uint32_t offset;
+	std::uint32_t length;
+};
+
+struct ArchiveAsset
+{
+	ArchiveSpan text;
+	std::uint32_t firstSection;
+	std::uint32_t numSections;
+};
+
+struct ArchiveQuestion
+{
+	ArchiveSpan questionText;
+	ArchiveSpan answerChoices[4];
+	std::int32_t answerNum;
+};
+
+class Content;
+
+class AssetArchive
+{
+	private:
+		// Private data members
+		const char* data;
+		std::size_t dataSize;
+		bool mapped;
+		const ArchiveHeader* header;
+		const ArchiveAsset* assets;
+		const ArchiveSpan* sections;
+		const ArchiveQuestion* questions;
+		const char* text;
+
+		// Private member functions
+		bool validate() const;
+		void close();
+
+	public:
+		// Public member functions
+		AssetArchive();
+		~AssetArchive();
+		bool open(const char* fileName);
+		bool open_memory(const void* bytes, std::size_t size);
+		bool is_open() const;
+		int num_assets() const;
+		int num_questions() const;
+		const ArchiveAsset& asset(int index) const;
+		const ArchiveSpan& section(int index) const;
+		const ArchiveQuestion& question(int index) const;
+		std::string_view view(const ArchiveSpan& span) const;
+		static std::string build(const Content& content);
+
+		// A mapping is owned by one archive, so an archive can never be copied
+		AssetArchive(const AssetArchive&) = delete;
+		AssetArchive& operator=(const AssetArchive&) = delete;
+};
+#endif
@@ -0,0 +1,428 @@
+/***************************************************************************************************
+ * Program Name: BatchEnv.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: BatchEnv class that plays thousands of games at once in lockstep, with the fields
+ * 		of the games stored as a structure of arrays and every turn computed without
+ * 		branches. See BatchEnv.hpp.
+ **************************************************************************************************/
+#include "BatchEnv.hpp"
+#include "Bibliotheca.hpp"
+#include "CircusMaximus.hpp"
+#include "Colosseum.hpp"
+#include "DomusAurea.hpp"
+#include "Forum.hpp"
+#include "Game.hpp"
+#include "GameModel.hpp"
+#include "Ludus.hpp"
+#include "Thermae.hpp"
+
+// Bits of the satchel of a game in a batch (one bit for each ItemId, as in a Satchel)
+const std::uint32_t SCROLL_BIT = 1u << SCROLL;
+const std::uint32_t PERMIT_BIT = 1u << PERMIT;
+
+// Bits of a random number drawn on a turn that decide each random outcome (only one is used on
+// any turn, so they may overlap): a tie at trivia (1 chance in 1024, as in the GameModel), the
+// 16 bits from which the winner of the chariot race is drawn, whether the player wins a battle,
+// and whether the senator orders the death of the loser
+const std::uint32_t TRIVIA_TIE_BITS = 0x3FF;
+const int RACE_SHIFT = 10;
+const int BATTLE_WIN_SHIFT = 26;
+const int BATTLE_DEATH_SHIFT = 27;
+
+// Number of games played together by the vectorized loop of step()
+const std::size_t STEP_BLOCK = 64;
+
+// With GCC or Clang on x86-64, step() is compiled once for each of several instruction sets, and
+// the version for the best one the processor has is chosen when the program starts (the
+// vectorized loop needs the gathers and 32-bit multiplies of AVX2 to be worthwhile), so that
+// the program itself can still be built for, and run on, any x86-64 processor
+#if defined(__GNUC__) && defined(__x86_64__)
+#define BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#define BATCH_INLINE __attribute__((always_inline))
+#else
+#define BATCH_KERNEL
+#define BATCH_INLINE
+#endif
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a 32-bit number and returns a well-mixed hash of it
+ * 		(Chris Wellons's "lowbias32", which takes two multiplies and three shifts, all of
+ * 		which have vector instructions).
+ ***************************************************************************************************/
+
+static inline std::uint32_t hash32(std::uint32_t value)
+{
+	value ^= value >> 16;
+	value *= 0x7FEB352Du;
+	value ^= value >> 15;
+	value *= 0x846CA68Bu;
+	value ^= value >> 16;
+	return value;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a number of at most 8 bits and returns the number of
+ * 		bits set in it (the number of items in a satchel), without branches or table lookups.
+ ***************************************************************************************************/
+
+static inline std::uint32_t count_bits(std::uint32_t bits)
+{
+	bits = bits - ((bits >> 1) & 0x55);
+	bits = (bits & 0x33) + ((bits >> 2) & 0x33);
+	return (bits + (bits >> 4)) & 0x0F;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the number of games to play at once, the seed, and the
+ * 		map on which they are played (the map of Rome by default). Builds the neighbor table
+ * 		(see BatchEnv.hpp) and the table of space types, and starts a new game in every slot.
+ ***************************************************************************************************/
+
+BatchEnv::BatchEnv(std::size_t numGames, std::uint64_t seed, std::shared_ptr<const GameMap> map)
+{
+	neighbors.resize(static_cast<std::size_t>(map->num_spaces()) * NUM_DIRECTIONS);
+	spaceTypes.resize(map->num_spaces());
+	for (std::uint32_t location = 0; location < map->num_spaces(); location++)
+	{
+		spaceTypes[location] = static_cast<std::uint32_t>(map->get_type(location));
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+		{
+			std::uint32_t neighbor = map->get_neighbor(location, static_cast<Direction>(dirNum));
+			neighbors[static_cast<std::size_t>(location) * NUM_DIRECTIONS + dirNum] = (neighbor == NO_SPACE) ? location : neighbor;
+		}
+	}
+	startLocation = map->get_start();
+	this->seed = seed;
+	gamesStarted = 0;
+
+	status.resize(numGames);
+	location.resize(numGames);
+	money.resize(numGames);
+	stepsTaken.resize(numGames);
+	stepsSinceBathing.resize(numGames);
+	flags.resize(numGames);
+	satchel.resize(numGames);
+	gamesPlayed.resize(numGames);
+	expensiveItem.resize(numGames);
+	cheapItem.resize(numGames);
+	key.resize(numGames);
+	turnsPlayed.resize(numGames);
+	reset();
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the number of a slot and starts the next
+ * 		game of the batch in it: the player starts at the start location with no coins and
+ * 		an empty satchel, and the game's key and the items the prefect wants (stored as
+ * 		satchel bits) are drawn from the seed and the number of the game. Returns nothing.
+ ***************************************************************************************************/
+
+void BatchEnv::start_game(std::size_t gameNum)
+{
+	const ItemId expensiveItems[] = {OLIVE_OIL, SANDALS, WINE};
+	const ItemId cheapItems[] = {GRAIN, SALT, TUNIC};
+
+	std::uint64_t gameKey = hash_model_key(seed + gamesStarted * 0x9E3779B97F4A7C15ULL);
+	gamesStarted++;
+	status[gameNum] = static_cast<std::uint32_t>(BatchStatus::RUNNING);
+	location[gameNum] = startLocation;
+	money[gameNum] = 0;
+	stepsTaken[gameNum] = 0;
+	stepsSinceBathing[gameNum] = 0;
+	flags[gameNum] = 0;
+	satchel[gameNum] = 0;
+	gamesPlayed[gameNum] = 0;
+	expensiveItem[gameNum] = 1u << expensiveItems[(gameKey >> 32) % 3];
+	cheapItem[gameNum] = 1u << cheapItems[(gameKey >> 40) % 3];
+	key[gameNum] = static_cast<std::uint32_t>(gameKey);
+	turnsPlayed[gameNum] = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Starts a new game in every slot. Returns nothing.
+ ***************************************************************************************************/
+
+void BatchEnv::reset()
+{
+	for (std::size_t gameNum = 0; gameNum < status.size(); gameNum++)
+	{
+		start_game(gameNum);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Starts a new game in every slot whose game is over (in the order
+ * 		of the slots). Returns the number of games started.
+ ***************************************************************************************************/
+
+std::size_t BatchEnv::reset_finished()
+{
+	std::size_t started = 0;
+	for (std::size_t gameNum = 0; gameNum < status.size(); gameNum++)
+	{
+		if (status[gameNum] != static_cast<std::uint32_t>(BatchStatus::RUNNING))
+		{
+			start_game(gameNum);
+			started++;
+		}
+	}
+	return started;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives an array holding one action for each game (see BatchEnv.hpp). Plays one
+ * 		turn of every game still running: the player enters the space if the action says
+ * 		so, the game ends if they are received by Nero, die, or have taken MAX_STEPS, and
+ * 		otherwise they move in the action's direction. Every rule is computed for every
+ * 		game as 0 or 1 (or an all-ones or all-zeros mask) and applied by multiplying or
+ * 		masking, so that the loop has no branches and is vectorized (over blocks of
+ * 		STEP_BLOCK games, with the games left over played one at a time). Games that are
+ * 		over are left as they are. Returns nothing.
+ ***************************************************************************************************/
+
+BATCH_KERNEL void BatchEnv::step(const std::uint8_t actions[])
+{
+	const std::uint32_t* __restrict neighborTable = neighbors.data();
+	const std::uint32_t* __restrict typeTable = spaceTypes.data();
+	std::uint32_t* __restrict statusArray = status.data();
+	std::uint32_t* __restrict locationArray = location.data();
+	std::int32_t* __restrict moneyArray = money.data();
+	std::uint32_t* __restrict stepsArray = stepsTaken.data();
+	std::uint32_t* __restrict bathingArray = stepsSinceBathing.data();
+	std::uint32_t* __restrict flagsArray = flags.data();
+	std::uint32_t* __restrict satchelArray = satchel.data();
+	std::uint32_t* __restrict gamesArray = gamesPlayed.data();
+	const std::uint32_t* __restrict expensiveArray = expensiveItem.data();
+	const std::uint32_t* __restrict cheapArray = cheapItem.data();
+	const std::uint32_t* __restrict keyArray = key.data();
+	std::uint32_t* __restrict turnsArray = turnsPlayed.data();
+	std::size_t numGames = status.size();
+
+	// Play the turn of one game
+	auto playTurn = [&](std::size_t gameNum) BATCH_INLINE
+	{
+		std::uint32_t action = actions[gameNum];
+		std::uint32_t running = (statusArray[gameNum] == static_cast<std::uint32_t>(BatchStatus::RUNNING));
+		std::uint32_t here = locationArray[gameNum];
+		std::uint32_t type = typeTable[here];
+		std::uint32_t entering = running & (action >> 3);
+		std::int32_t coins = moneyArray[gameNum];
+		std::uint32_t bits = satchelArray[gameNum];
+		std::uint32_t gameFlags = flagsArray[gameNum];
+		std::uint32_t bathing = bathingArray[gameNum];
+		std::uint32_t played = gamesArray[gameNum];
+		std::uint32_t expensive = expensiveArray[gameNum];
+		std::uint32_t cheap = cheapArray[gameNum];
+		std::uint32_t itemCount = count_bits(bits);
+		std::uint32_t random = hash32(keyArray[gameNum] + turnsArray[gameNum] * 0x9E3779B9u);
+
+		// Whether the player entered each type of space (only one can be 1)
+		std::uint32_t atBibliotheca = entering & (type == static_cast<std::uint32_t>(SpaceType::BIBLIOTHECA));
+		std::uint32_t atDomusAurea = entering & (type == static_cast<std::uint32_t>(SpaceType::DOMUS_AUREA));
+		std::uint32_t atLudus = entering & (type == static_cast<std::uint32_t>(SpaceType::LUDUS));
+		std::uint32_t atCircus = entering & (type == static_cast<std::uint32_t>(SpaceType::CIRCUS_MAXIMUS));
+		std::uint32_t atForum = entering & (type == static_cast<std::uint32_t>(SpaceType::FORUM));
+		std::uint32_t atTheatrum = entering & (type == static_cast<std::uint32_t>(SpaceType::THEATRUM));
+		std::uint32_t atColosseum = entering & (type == static_cast<std::uint32_t>(SpaceType::COLOSSEUM));
+		std::uint32_t atThermae = entering & (type == static_cast<std::uint32_t>(SpaceType::THERMAE));
+		std::uint32_t atCampus = entering & (type == static_cast<std::uint32_t>(SpaceType::CAMPUS_MARTIUS));
+
+		std::uint32_t knows = (gameFlags & KNOWS_ABOUT_SCROLL) != 0;
+		std::uint32_t returned = (gameFlags & RETURNED_SCROLL) != 0;
+		std::uint32_t hasScroll = (bits & SCROLL_BIT) != 0;
+		std::uint32_t hasPermit = (bits & PERMIT_BIT) != 0;
+		std::uint32_t gaveExpensive = (gameFlags & GAVE_EXPENSIVE) != 0;
+		std::uint32_t gaveCheap = (gameFlags & GAVE_CHEAP) != 0;
+
+		// Domus Aurea: the player is received by Nero with the permit, freshly bathed
+		std::uint32_t wins = atDomusAurea & hasPermit & ((gameFlags & HAS_BATHED) != 0) & (bathing <= MAX_STEPS_SINCE_BATHING);
+
+		// Bibliotheca: the librarian asks for the scroll, or takes it and gives a reward
+		std::uint32_t learns = atBibliotheca & (knows ^ 1);
+		std::uint32_t returns = atBibliotheca & knows & (returned ^ 1) & hasScroll;
+		gameFlags |= learns * KNOWS_ABOUT_SCROLL | returns * RETURNED_SCROLL;
+		coins += returns * SCROLL_REWARD;
+		bits &= ~(returns * SCROLL_BIT);
+
+		// Ludus: the magister hands over the scroll, and the player plays trivia
+		std::uint32_t takesScroll = atLudus & knows & (returned ^ 1) & (hasScroll ^ 1) & (itemCount < SATCHEL_CAPACITY);
+		std::uint32_t playsTrivia = atLudus & (played < NUM_GAMES);
+		std::uint32_t ties = (random & TRIVIA_TIE_BITS) == 0;
+		bits |= takesScroll * SCROLL_BIT;
+		played += playsTrivia;
+		coins += playsTrivia * (TRIVIA_WIN_PRIZE - ties * (TRIVIA_WIN_PRIZE - TRIVIA_TIE_PRIZE));
+
+		// Circus Maximus: the player bets the most they can afford and wins twice the bet
+		// (one chance in three) or loses it
+		std::int32_t bet = (coins >= HIGH_BET) ? HIGH_BET : ((coins >= MEDIUM_BET) ? MEDIUM_BET : ((coins >= LOW_BET) ? LOW_BET : 0));
+		std::int32_t raceWon = ((((random >> RACE_SHIFT) & 0xFFFF) * 3) >> 16) == 0;
+		coins += static_cast<std::int32_t>(atCircus) * bet * (2 * raceWon - 1);
+
+		// Forum: the player buys the items the prefect wants that they can afford and carry
+		std::uint32_t buysExpensive = atForum & (hasPermit ^ 1) & (gaveExpensive ^ 1) & ((bits & expensive) == 0) &
+					      (coins >= EXPENSIVE_PRICE) & (itemCount < SATCHEL_CAPACITY);
+		coins -= buysExpensive * EXPENSIVE_PRICE;
+		bits |= (0u - buysExpensive) & expensive;
+		std::uint32_t buysCheap = atForum & (hasPermit ^ 1) & (gaveCheap ^ 1) & ((bits & cheap) == 0) &
+					  (coins >= CHEAP_PRICE) & (itemCount + buysExpensive < SATCHEL_CAPACITY);
+		coins -= buysCheap * CHEAP_PRICE;
+		bits |= (0u - buysCheap) & cheap;
+
+		// Theatrum: the player donates every item that is of no use to them
+		std::uint32_t useful = SCROLL_BIT | PERMIT_BIT | ((0u - (gaveExpensive ^ 1)) & expensive) | ((0u - (gaveCheap ^ 1)) & cheap);
+		bits &= ~((0u - atTheatrum) & ~useful);
+
+		// Colosseum: the player wins the battle and a prize, or loses it, and the senator
+		// orders the death of the loser half of the time
+		std::uint32_t battleWon = (random >> BATTLE_WIN_SHIFT) & 1;
+		std::uint32_t dies = atColosseum & (battleWon ^ 1) & ((random >> BATTLE_DEATH_SHIFT) & 1);
+		coins += atColosseum * battleWon * BATTLE_PRIZE;
+
+		// Thermae: the player bathes if they can afford it
+		std::uint32_t bathes = atThermae & (coins >= BATH_COST);
+		coins -= bathes * BATH_COST;
+		gameFlags |= bathes * HAS_BATHED;
+		bathing &= bathes - 1;
+
+		// Campus Martius: the player passes the prefect's test, or gives him the items he
+		// wants and receives the permit once he has both
+		std::uint32_t takesTest = atCampus & ((gameFlags & PASSED_TEST) == 0);
+		std::uint32_t gives = atCampus & ((gameFlags & PASSED_TEST) != 0) & (hasPermit ^ 1);
+		std::uint32_t givesExpensive = gives & (gaveExpensive ^ 1) & ((bits & expensive) != 0);
+		std::uint32_t givesCheap = gives & (gaveCheap ^ 1) & ((bits & cheap) != 0);
+		bits &= ~(((0u - givesExpensive) & expensive) | ((0u - givesCheap) & cheap));
+		gameFlags |= takesTest * PASSED_TEST | givesExpensive * GAVE_EXPENSIVE | givesCheap * GAVE_CHEAP;
+		std::uint32_t receivesPermit = gives & ((gameFlags & GAVE_EXPENSIVE) != 0) & ((gameFlags & GAVE_CHEAP) != 0);
+		bits |= receivesPermit * PERMIT_BIT;
+
+		// End the game, or move in the action's direction (a direction off the board
+		// leads back to the same space, and takes no step)
+		std::uint32_t steps = stepsArray[gameNum];
+		std::uint32_t outOfSteps = running & (wins ^ 1) & (dies ^ 1) & (steps >= MAX_STEPS);
+		std::uint32_t moving = running & (wins ^ 1) & (dies ^ 1) & (outOfSteps ^ 1);
+		std::uint32_t there = neighborTable[here * NUM_DIRECTIONS + (action & 7)];
+		std::uint32_t moves = moving & (there != here);
+		std::uint32_t newStatus = wins * static_cast<std::uint32_t>(BatchStatus::WON) + dies * static_cast<std::uint32_t>(BatchStatus::DIED) +
+					  outOfSteps * static_cast<std::uint32_t>(BatchStatus::OUT_OF_STEPS);
+		bathing += moves & ((gameFlags & HAS_BATHED) != 0) & (bathing <= MAX_STEPS_SINCE_BATHING);
+
+		statusArray[gameNum] = (running & (newStatus != 0)) ? newStatus : statusArray[gameNum];
+		locationArray[gameNum] = moves ? there : here;
+		stepsArray[gameNum] = steps + moves;
+		moneyArray[gameNum] = coins;
+		satchelArray[gameNum] = bits;
+		flagsArray[gameNum] = gameFlags;
+		bathingArray[gameNum] = bathing;
+		gamesArray[gameNum] = played;
+		turnsArray[gameNum] += running;
+	};
+
+	// Play the games in blocks of a fixed number, which the compiler vectorizes without
+	// needing to handle a partial vector, and then the games left over
+	std::size_t gameNum = 0;
+	for (; gameNum + STEP_BLOCK <= numGames; gameNum += STEP_BLOCK)
+	{
+#pragma GCC ivdep
+		for (std::size_t blockNum = 0; blockNum < STEP_BLOCK; blockNum++)
+		{
+			playTurn(gameNum + blockNum);
+		}
+	}
+	for (; gameNum < numGames; gameNum++)
+	{
+		playTurn(gameNum);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of games played at
+ * 		once (the number of slots).
+ ***************************************************************************************************/
+
+std::size_t BatchEnv::num_games() const
+{
+	return this->status.size();
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing and return the arrays of the status (each a
+ * 		BatchStatus value), location, coins, and steps taken of every game (num_games()
+ * 		long, and valid until the BatchEnv is destroyed).
+ ***************************************************************************************************/
+
+const std::uint32_t* BatchEnv::get_status() const
+{
+	return this->status.data();
+}
+
+const std::uint32_t* BatchEnv::get_location() const
+{
+	return this->location.data();
+}
+
+const std::int32_t* BatchEnv::get_money() const
+{
+	return this->money.data();
+}
+
+const std::uint32_t* BatchEnv::get_steps_taken() const
+{
+	return this->stepsTaken.data();
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the number of a game (slot). Returns its state as a GameState (with the
+ * 		questions in their unshuffled order, since the batch does not ask them), so that the
+ * 		Solver or the Expectimax engine can evaluate it.
+ ***************************************************************************************************/
+
+GameState BatchEnv::get_state(std::size_t gameNum) const
+{
+	GameState state{};
+	state.location = location[gameNum];
+	state.money = static_cast<std::int16_t>(money[gameNum]);
+	state.stepsTaken = static_cast<std::uint8_t>(stepsTaken[gameNum]);
+	state.stepsSinceBathing = static_cast<std::uint8_t>(stepsSinceBathing[gameNum]);
+	for (ItemId item = 0; item < NUM_ITEMS; item++)
+	{
+		if (satchel[gameNum] & (1u << item))
+		{
+			state.satchel.insert(item);
+		}
+		if (expensiveItem[gameNum] == (1u << item))
+		{
+			state.expensiveChoice = item;
+		}
+		if (cheapItem[gameNum] == (1u << item))
+		{
+			state.cheapChoice = item;
+		}
+	}
+	state.hasBathed = (flags[gameNum] & HAS_BATHED) != 0;
+	state.knowsAboutScroll = (flags[gameNum] & KNOWS_ABOUT_SCROLL) != 0;
+	state.returnedScroll = (flags[gameNum] & RETURNED_SCROLL) != 0;
+	state.obtainedScroll = state.returnedScroll || state.satchel.contains(SCROLL);
+	state.hasPassedTest = (flags[gameNum] & PASSED_TEST) != 0;
+	state.hasGivenExpensive = (flags[gameNum] & GAVE_EXPENSIVE) != 0;
+	state.hasGivenCheap = (flags[gameNum] & GAVE_CHEAP) != 0;
+	state.gamesPlayed = static_cast<std::uint8_t>(gamesPlayed[gameNum]);
+	state.stillAlive = (status[gameNum] != static_cast<std::uint32_t>(BatchStatus::DIED));
+	state.withNero = (status[gameNum] == static_cast<std::uint32_t>(BatchStatus::WON));
+	state.gameOver = (status[gameNum] != static_cast<std::uint32_t>(BatchStatus::RUNNING));
+	for (int index = 0; index < NUM_QUESTIONS; index++)
+	{
+		state.questionOrder[index] = index;
+	}
+	return state;
+}
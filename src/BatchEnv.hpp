@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Program Name: BatchEnv.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: BatchEnv class that plays thousands of games at once in lockstep, for training
+ * 		programs that learn to play (which need far more games than the Game class, with its
+ * 		text and menus, can play). Each call to step() plays one turn of every game still
+ * 		running, given one action for each game.
+ *
+ * 		The state of the games is stored as a structure of arrays: one array for each field
+ * 		(location, coins, steps taken, steps since bathing, flags, satchel, trivia games
+ * 		played, the items the prefect wants, and the state of the game's random numbers),
+ * 		indexed by the number of the game. Every field is 32 bits wide, so the turn of
+ * 		each game is computed the same way, without branches: every rule is applied to
+ * 		every game, masked by whether it applies (whether the player entered, the type of
+ * 		the space, whether they can afford an item, and so on), and the loop over the games
+ * 		compiles to vector instructions that play several games at once. The neighbors of
+ * 		every space are kept in a table of NUM_DIRECTIONS entries per space in which a
+ * 		direction that leads off the board leads back to the space itself, so that moving
+ * 		is a single lookup.
+ *
+ * 		An action is a direction (its number, from 0 to NUM_DIRECTIONS - 1) and whether to
+ * 		enter the space first (ENTER_ACTION added to the direction). Entering a space does
+ * 		what the GameModel (see GameModel.hpp) does when the player enters it: the player
+ * 		buys the items the prefect wants, donates every other item, bathes, accepts every
+ * 		trivia challenge and answers every question correctly, passes the prefect's test,
+ * 		and bets the most they can afford. The random outcomes (a tie at trivia, the winner
+ * 		of the chariot race, and the battle and the senator's verdict at the Colosseum)
+ * 		have the same chances as in the GameModel, drawn from a hash of the game's key and
+ * 		the number of turns it has played (so that drawing a number needs no state but a
+ * 		counter). An action that moves off the board leaves the player where they are
+ * 		without taking a step (the game would ask again for a direction).
+ *
+ * 		Each game ends when the player is received by Nero, dies, or ends a turn at
+ * 		MAX_STEPS, as in the Game class, and then does nothing until it is reset. Game
+ * 		number n played in the batch (counting from 0) gets its key, and the items the
+ * 		prefect wants, from the seed of the batch and n, so that a batch plays the same
+ * 		games every time it is created with the same seed and given the same actions.
+ *
+ *		Private data members of the BatchEnv class include:
+ *		- The neighbor table and the type of every space of the map
+ *		- The start location and the seed
+ *		- The number of games started so far
+ *		- The arrays of the fields of the games (including the status of each)
+ *
+ *		Public member functions of the BatchEnv class include:
+ *		- A constructor that receives the number of games, the seed, and the map
+ *		- Functions that start a new game in every slot, or in every slot whose game is
+ *		  over
+ *		- A function that plays one turn of every game still running
+ *		- Accessor methods for the number of games, the arrays of the status (each a
+ *		  BatchStatus value), location, coins, and steps taken of every game, and the
+ *		  GameState of a game
+ *
+ *		The BatchStatus enum class and the ENTER_ACTION constant are also declared in this
+ *		header file.
+ **************************************************************************************************/
+#ifndef BATCHENV_HPP
+#define BATCHENV_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "GameMap.hpp"
+#include "GameState.hpp"
+
+// Enum class identifying whether a game of a batch is still running, and if not, how it ended
+enum class BatchStatus : std::uint32_t {RUNNING, WON, DIED, OUT_OF_STEPS};
+
+// Amount added to the number of a direction to make the action of entering the space first
+const std::uint8_t ENTER_ACTION = 8;
+
+class BatchEnv
+{
+	private:
+		// Private data members
+		std::vector<std::uint32_t> neighbors;
+		std::vector<std::uint32_t> spaceTypes;
+		std::uint32_t startLocation;
+		std::uint64_t seed;
+		std::uint64_t gamesStarted;
+
+		// Fields of the games
+		std::vector<std::uint32_t> status;
+		std::vector<std::uint32_t> location;
+		std::vector<std::int32_t> money;
+		std::vector<std::uint32_t> stepsTaken;
+		std::vector<std::uint32_t> stepsSinceBathing;
+		std::vector<std::uint32_t> flags;
+		std::vector<std::uint32_t> satchel;
+		std::vector<std::uint32_t> gamesPlayed;
+		std::vector<std::uint32_t> expensiveItem;
+		std::vector<std::uint32_t> cheapItem;
+		std::vector<std::uint32_t> key;
+		std::vector<std::uint32_t> turnsPlayed;
+
+		// Private member function
+		void start_game(std::size_t gameNum);
+
+	public:
+		// Public member functions
+		BatchEnv(std::size_t numGames, std::uint64_t seed, std::shared_ptr<const GameMap> map = GameMap::rome());
+		void reset();
+		std::size_t reset_finished();
+		void step(const std::uint8_t actions[]);
+		std::size_t num_games() const;
+		const std::uint32_t* get_status() const;
+		const std::uint32_t* get_location() const;
+		const std::int32_t* get_money() const;
+		const std::uint32_t* get_steps_taken() const;
+		GameState get_state(std::size_t gameNum) const;
+};
+#endif
@@ -13,17 +13,15 @@
  * 		sheet music he will be performing in the Theatrum).
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
- *		Additional private data member of Bibliotheca class is a bool indicating
- *		whether or not the user has returned the scroll (so that the side quest is not repeated).
+ *		Whether or not the user has returned the scroll (so that the side quest is not
+ *		repeated) is kept in the GameState so that a Bibliotheca never changes during a game.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -36,15 +34,14 @@
 
 #include "Space.hpp"
 
+// Constant indicating the number of coins the librarian gives for returning the scroll
+const int SCROLL_REWARD = 5;
+
 class Bibliotheca : public Space
 {
-	private:
-		bool returnedScroll;
-
 	public:
 		Bibliotheca();
 		virtual ~Bibliotheca();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -2,139 +2,87 @@
  * Program Name: Board.cpp
  * Author: Alexander Densmore
  * Date: 12/3/18
- * Description: Class that implements a Board object consisting of linked Space objects for use in 
+ * Description: Class that implements a Board object consisting of Space objects for use in 
  * 		the Ancient Rome-Themed game.
  *
- * 		An enum class included in the Board class's header file
- * 		defines the Direction data type for use in the Board class.
+ * 		The layout of the board (which type of space is at each location and which spaces
+ * 		border each other) is described by a GameMap (see GameMap.hpp), which is shared by
+ * 		every Board that uses it. By default, a Board uses the map of Rome of the original
+ * 		game, but it can use any map, such as a map loaded from a map file. Every space of
+ * 		the same type is played through the same Space object.
+ *
+ * 		The text-based board images are loaded once per process by the Content class. They
+ * 		show the map of Rome, so on any other map the player's location is printed instead.
  *
  * 		Private data members of the Board class include the following:
- * 		- A vector containing text-based board images
- * 		- Pointers to each of the 9 different Spaces on the board
- * 		- A pointer to the space at which the player is currently located
+ * 		- The GameMap of the board
+ * 		- An array of pointers to one Space of each of the 9 different types, indexed by
+ * 		  SpaceType
+ * 		- A bool indicating whether or not the board images show the board's map
+ * 		- The table of hints (see HintTable.hpp), if the player can ask for hints
+ * 		- The menus of every location (see BoardMenus.hpp), built once per map and shared
+ * 		  by every board that uses it, so that no menu is built for a board or a game
+ *
+ *		The player's location is not stored in the Board. It is kept in the GameState so
+ *		that the Board never changes during a game.
  *
  *		Public member functions include:
- *		- A constructor and destructor
- *		- An accessor method that returns the Space pointer to the player's location
+ *		- Constructors (using the map of Rome or a given map) and a destructor
+ *		- An accessor method that returns the Space pointer at a given location
+ *		- An accessor method that returns the board's GameMap
+ *		- Accessor methods that return the menu asking whether to enter the space at a
+ *		  location and the menu of directions in which the player can move from it (each
+ *		  also offers a hint if the board has a table of hints)
  *		- A function that prints an image of the board (including the player's location)
- *		- A function that moves the player on the board
- *
- *		Private member functions include:
- *		- A function that sets the choices of the menu of where the player can move
- *		  (based on which spaces, if any, are in each direction from the player)
- *		- A function that determines whether a move in a given direction is possible
+ *		- A function that moves the player on the board (the menu of directions also
+ *		  offers a hint, the best direction in which to move, if the board has a table
+ *		  of hints)
+ *		- Accessor and mutator methods for the table of hints
  ***************************************************************************************************/
 #include "Board.hpp"
+#include "HintTable.hpp"
 
 
 /*************************************************************************************************** 
- * Description: Default constructor of Board class. 
- *
- * 		Dynamically allocates memory for each space on the board (each of the 9 spaces
- * 		is a different type of space, represented by a different subclass of Space).
- *
- *		Assigns the space5 pointer to the player's starting
- *		location pointer (the player starts in the Forum).
+ * Description: Default constructor of Board class. Creates a board with the map of Rome used by
+ * 		the original game.
+ ***************************************************************************************************/
+
+Board::Board() : Board(GameMap::rome())
+{
+}
+
+
+/*************************************************************************************************** 
+ * Description: Constructor of Board class that receives the GameMap to use.
  *
- *		Sets values of each Space's pointers to other Spaces
- *		(setting values only for directions in which there is another space and 
- *		leaving all other pointers at default value of nullptr).
+ * 		Dynamically allocates memory for one space of each type (each of the 9 types of
+ * 		space is represented by a different subclass of Space). Spaces never change during
+ * 		a game, so every space of the same type on the map is played through the same Space.
  *
- *		Loads text-based images of Board from file into vector of strings.
+ *		Stores a pointer to each space in the spaces array at the index of its type, and
+ *		looks up the menus of the map (building them if no other board has).
  ***************************************************************************************************/
 
-Board::Board()
+Board::Board(std::shared_ptr<const GameMap> map) : map(std::move(map))
 {
-	// Dynamically allocate memory for each of 9 Spaces
-	// (each space pointer's number corresponds to that same number on the Board map).
-	space1 = new Bibliotheca;
-	space2 = new DomusAurea;
-	space3 = new Ludus;
-	space4 = new CircusMaximus;
-	space5 = new Forum;
-	space6 = new Theatrum;
-	space7 = new Colosseum;
-	space8 = new Thermae;
-	space9 = new CampusMartius;
-
-	// Set the player's starting location to space5 (the Forum)
-	playerLocation = space5;
-
-	// Set each space’s directional pointers (if a space does not have another space in a 
-	// given direction, that direction’s pointer will be left as the default value of nullptr).
-	
-	// Set space1 pointers
-	space1->set_east(space2);
-	space1->set_southeast(space5);
-	space1->set_south(space4);
-	
-	// Set space2 pointers
-	space2->set_east(space3);
-	space2->set_southeast(space6);
-	space2->set_south(space5);
-	space2->set_southwest(space4);
-	space2->set_west(space1);
-
-	// Set space3 pointers
-	space3->set_south(space6);
-	space3->set_southwest(space5);
-	space3->set_west(space2);
-
-	// Set space4 pointers
-	space4->set_north(space1);
-	space4->set_northeast(space2);
-	space4->set_east(space5);
-	space4->set_southeast(space8);
-	space4->set_south(space7);
-
-	// Set space5 pointers
-	space5->set_north(space2);
-	space5->set_northeast(space3);
-	space5->set_east(space6);
-	space5->set_southeast(space9);
-	space5->set_south(space8);
-	space5->set_southwest(space7);
-	space5->set_west(space4);
-	space5->set_northwest(space1);
-
-	// Set space6 pointers
-	space6->set_north(space3);
-	space6->set_south(space9);
-	space6->set_southwest(space8);
-	space6->set_west(space5);
-	space6->set_northwest(space2);
-
-	// Set space7 pointers
-	space7->set_north(space4);
-	space7->set_northeast(space5);
-	space7->set_east(space8);
-
-	// Set space8 pointers
-	space8->set_north(space5);
-	space8->set_northeast(space6);
-	space8->set_east(space9);
-	space8->set_west(space7);
-	space8->set_northwest(space4);
-
-	// Set space9 pointers
-	space9->set_north(space6);
-	space9->set_west(space8);
-	space9->set_northwest(space5);
-
-	// Fill boardImages vector with strings of boardImages
-	// by reading in from input file
-	std::ifstream inputFile("Board_Images.txt");
-	std::string image;
-
-	// Use a for loop to read in each image from the file
-	// The images are each multiple lines, so they are
-	// separated by the delimination character '#'
-	for(int index = 0; index < NUM_BOARD_IMAGES; index++)
-	{
-		getline(inputFile, image, DELIM);
-		boardImages.push_back(image);	
-	}
-	inputFile.close();
+	// Dynamically allocate memory for one Space of each type (each type's index is the
+	// location of that type of space on the map of Rome, so on that map each space's
+	// number corresponds to that same number on the Board map).
+	spaces[static_cast<int>(SpaceType::BIBLIOTHECA)] = new Bibliotheca;
+	spaces[static_cast<int>(SpaceType::DOMUS_AUREA)] = new DomusAurea;
+	spaces[static_cast<int>(SpaceType::LUDUS)] = new Ludus;
+	spaces[static_cast<int>(SpaceType::CIRCUS_MAXIMUS)] = new CircusMaximus;
+	spaces[static_cast<int>(SpaceType::FORUM)] = new Forum;
+	spaces[static_cast<int>(SpaceType::THEATRUM)] = new Theatrum;
+	spaces[static_cast<int>(SpaceType::COLOSSEUM)] = new Colosseum;
+	spaces[static_cast<int>(SpaceType::THERMAE)] = new Thermae;
+	spaces[static_cast<int>(SpaceType::CAMPUS_MARTIUS)] = new CampusMartius;
+
+	// The board images only show the map of Rome
+	hasImages = (this->map->num_spaces() == NUM_BOARD_IMAGES && *this->map == *GameMap::rome());
+
+	menus = BoardMenus::for_map(*this->map, spaces);
 }
 
 
@@ -144,77 +92,101 @@ Board::Board()
 
 Board::~Board()
 {
-	delete space1;
-	space1 = nullptr;
-	delete space2;
-	space2 = nullptr;
-	delete space3;
-	space3 = nullptr;
-	delete space4;
-	space4 = nullptr;
-	delete space5;
-	space5 = nullptr;
-	delete space6;
-	space6 = nullptr;
-	delete space7;
-	space7 = nullptr;
-	delete space8;
-	space8 = nullptr;
-	delete space9;
-	space9 = nullptr;
-	playerLocation = nullptr;
+	for (int typeNum = 0; typeNum < NUM_SPACE_TYPES; typeNum++)
+	{
+		delete spaces[typeNum];
+		spaces[typeNum] = nullptr;
+	}
+}
+
+
+/*************************************************************************************************** 
+ * Description: Accessor method that receives a location (space number - 1) and returns the Space
+ * 		pointer indicating the type of space at that location.
+ ***************************************************************************************************/
+
+Space* Board::get_space(std::uint32_t location) const
+{
+	return this->spaces[static_cast<int>(this->map->get_type(location))];
+}
+
+
+/*************************************************************************************************** 
+ * Description: Accessor method that receives no parameter and returns the board's GameMap.
+ ***************************************************************************************************/
+
+const GameMap& Board::get_map() const
+{
+	return *this->map;
 }
 
 
 /*************************************************************************************************** 
- * Description: Accessor method that receives no parameters and returns the Space pointer indicating
- * 		the space at which the player is located.
+ * Description: Accessor methods that receive a location. They return the menu asking whether to
+ * 		enter the space at the location or keep moving, and the menu of the 8 directions
+ * 		in which the player can try to move from it, each followed by a hint if the board
+ * 		has a table of hints. The menus stay valid as long as the board does.
  ***************************************************************************************************/
 
-Space* Board::get_player_location() const
+MenuChoices Board::get_enter_menu(std::uint32_t location) const
+{
+	return this->menus->get_enter_menu(location, hints != nullptr);
+}
+
+MenuChoices Board::get_move_menu(std::uint32_t location) const
 {
-	return this->playerLocation;
+	return this->menus->get_move_menu(location, hints != nullptr);
 }
 
 
 /*************************************************************************************************** 
  * Description: Function that prints an image of the board when called based on the player's current
  * 		location (the square in which the player is located is marked with an
- * 		asterisk centered in the bottom row). Receives and returns nothing.
+ * 		asterisk centered in the bottom row). On a map other than the map of Rome, which
+ * 		has no images, the player's location is printed instead. Receives the GameIO
+ * 		object to which the image is written and the player's location. Returns nothing.
  ***************************************************************************************************/
 
-void Board::print_board()
+void Board::print_board(GameIO& io, std::uint32_t location)
 {
-	// Determine which board to print based on the number of the space
-	// at which the player is located (Spaces are numbered 1-9;
-	// subtracting 1 from player's space num gives the index in the images
-	// vector corresponding to the player's current location).
-	int boardIndex = (playerLocation->get_num() -1);
-	std::cout << boardImages[boardIndex];
+	// Maps other than the map of Rome have no images, so print the player's location instead
+	if (!hasImages)
+	{
+		io.out() << "\nYou are at space " << (location + 1) << " of the " << map->num_spaces() << " spaces of this map.\n";
+		return;
+	}
+
+
+	// Determine which board to print based on the player's location
+	// (Spaces are numbered 1-9; the player's location is the space num - 1,
+	// which is the index of the section of the board images corresponding to that location;
+	// the images are each multiple lines, so they are separated by the delimination character '#').
+	io.out() << Content::get().section(Asset::BOARD_IMAGES, location);
 }
 
 
 /*************************************************************************************************** 
- * Description: Function that moves the player from one space to another
- * 		(assigns a different space's pointer to the playerLocation pointer).
+ * Description: Coroutine that moves the player from one space to another
+ * 		(changes the location stored in the GameState).
  *		Lists choices of all possible spaces to which the player can move
  *		(lists all 8 directions but indicates those in which the
  *		user cannot move and the names of the spaces in each direction that the player can 
  *		move). Validates the user's choice, only allowing them to move
- *		in a valid direction. Receives and returns nothing.
+ *		in a valid direction. If the board has a table of hints, the menu also offers
+ *		a hint, which prints the best direction in which to move (looked up in the
+ *		table) before asking again. Receives the GameIO object through which the menu is
+ *		displayed and the user's choice is made and the GameState holding the player's
+ *		location (passed by reference so that it can be changed). Returns nothing.
  ***************************************************************************************************/
 
-void Board::move()
+Task<void> Board::move(GameIO& io, GameState& state)
 {
-	// Declare a vector to store the move menu choices.
-	std::vector<std::string> moveChoices;
-
-	// Pass the vector to set_move_menu private function so that
-	// it can be initialized with menu choices based on the player's current location
-	set_move_menu(moveChoices);
+	// Look up the move menu choices for the player's current location (built when the
+	// board was created, so nothing is allocated here)
+	MenuChoices moveChoices = get_move_menu(state.location);
 
 	// Ask the user in what direction they would like to move
-	std::cout << "In what direction would you like to move?\n";
+	io.out() << "In what direction would you like to move?\n";
 
 	// declare variables for use in do-while loop
 	bool validMove = false;
@@ -225,7 +197,25 @@ void Board::move()
 	do
 	{
 		// Get the user's choice for direction in which to move.
-		int moveChoiceNum = menu(moveChoices);
+		int moveChoiceNum = co_await io.choose(Prompt::MOVE, moveChoices);
+
+		// If the user has asked for a hint, print the best direction in which to move
+		// (or that there is none) and ask again.
+		if (hints && moveChoiceNum == NUM_DIRECTIONS + 1)
+		{
+			Direction hintDir;
+			if (hints->best_direction(state, hintDir))
+			{
+				io.out() << "Hint: move " << DIRECTION_NAMES[static_cast<int>(hintDir)] << " to the ";
+				io.out() << get_space(map->get_neighbor(state.location, hintDir))->get_name() << ".\n";
+			}
+			else
+			{
+				io.out() << "Hint: there is no hint here (you may no longer be able to reach Nero in the steps you have left).\n";
+			}
+			validMove = false;
+			continue;
+		}
 		
 		// Decrement the choice number so that it corresponds to
 		// the correct enum value, and static cast it to a Direction
@@ -234,266 +224,36 @@ void Board::move()
 
 		// Check whether a move in the direction the user selected is valid.
 		// If it is not, prompt them to enter a new choice before looping again.
-		validMove = is_valid_move(dir);
+		validMove = map->is_valid_move(state.location, dir);
 		if (!validMove)
 		{
-			std::cout << "You cannot move in that direction; please pick a different direction.\n";
+			io.out() << "You cannot move in that direction; please pick a different direction.\n";
 		}
 	} while (!validMove);
 	
-	// Now that the move choice has been validated, move the player to the new space based on the validated
-	// direction.
-	if (dir == Direction::N)
-	{
-		playerLocation = playerLocation->get_north();
-	}
-	else if (dir == Direction::NE)
-	{
-		playerLocation = playerLocation->get_northeast();
-	}
-	else if (dir == Direction::E)
-	{
-		playerLocation = playerLocation->get_east();
-	}
-	else if (dir == Direction::SE)
-	{
-		playerLocation = playerLocation->get_southeast();
-	}
-	else if (dir == Direction::S)
-	{
-		playerLocation = playerLocation->get_south();
-	}
-	else if (dir == Direction::SW)
-	{
-		playerLocation = playerLocation->get_southwest();
-	}
-	else if (dir == Direction::W)
-	{
-		playerLocation = playerLocation->get_west();
-	}
-	else if (dir == Direction::NW)
-	{
-		playerLocation = playerLocation->get_northwest();
-	}
+	// Now that the move choice has been validated, store the location of the space
+	// in that direction in the state
+	state.location = map->get_neighbor(state.location, dir);
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function that receives empty string vector passed
- * 		by reference that it fills with the move menu choices based
- * 		on the player's current location. Returns nothing.
+ * Description: Accessor method that receives nothing and returns the board's table of hints (or
+ * 		nullptr if the player cannot ask for hints).
  ***************************************************************************************************/
 
-void Board::set_move_menu(std::vector<std::string>& moveChoices)
+const HintTable* Board::get_hints() const
 {
-	// For the sake of consistency with what each direction’s number is in the menu, all 
-	// directions will be printed as choices, even if they player cannot move in that direction. 
-	// After the name of the direction, the name of the space that is in that direction will be
-	// printed or the message “cannot move in this direction” will be printed if applicable.
- 	
-	// Declare string with message about not being able to move in a given direction
-	// (added to the end of a direction's menu option when applicable).
-	std::string cannotMove = "(cannot move in this direction)";
- 	
-	// Make a menu option for each direction.
-	// Check to see if the user can move in that direction, adding the name
-	// of the space if the user can move in that direction
-	// or the cannotMove message if they cannot move in that direction.
-	std::string directionMenuOption = "North: ";
- 	if (playerLocation->get_north() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_north()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
- 	
-	directionMenuOption = "Northeast: ";
-	if (playerLocation->get_northeast() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_northeast()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-	
-	directionMenuOption = "East: ";
-	if (playerLocation->get_east() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_east()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-
-	directionMenuOption = "Southeast: ";
-	if (playerLocation->get_southeast() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_southeast()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-
-	directionMenuOption = "South: ";
-	if (playerLocation->get_south() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_south()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-
-	directionMenuOption = "Southwest: ";
-	if (playerLocation->get_southwest() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_southwest()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-
-	directionMenuOption = "West: ";
-	if (playerLocation->get_west() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_west()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
-
-	directionMenuOption = "Northwest: ";
-	if (playerLocation->get_northwest() != nullptr)
- 	{
-		directionMenuOption += playerLocation->get_northwest()->get_name();
- 	}
-	else
- 	{
-		directionMenuOption += cannotMove;
- 	}
- 	moveChoices.push_back(directionMenuOption);
+	return this->hints.get();
 }
 
 
-/****************************************************************************************************
- * Description: Private member function that receives the direction that the user has
- * 		requested to move. Returns a boolean value indicating
- * 		whether or not the user can move in that direction.
+/*************************************************************************************************** 
+ * Description: Mutator method that receives a table of hints for the board's map (shared with any
+ * 		other boards using it), or nullptr to stop offering hints. Returns nothing.
  ***************************************************************************************************/
 
-bool Board::is_valid_move(Direction dir)
+void Board::set_hints(std::shared_ptr<const HintTable> hints)
 {
-	// Use nested conditionals to test whether
-	// the user can move in the specified direction.
-	// Return false if the pointer to that direction is nullptr,
-	// true if it is a valid space.
-	if (dir == Direction::N)
-	{
-		if (playerLocation->get_north() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::NE)
-	{
-		if (playerLocation->get_northeast() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::E)
-	{
-		if (playerLocation->get_east() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::SE)
-	{
-		if (playerLocation->get_southeast() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::S)
-	{
-		if (playerLocation->get_south() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::SW)
-	{
-		if (playerLocation->get_southwest() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::W)
-	{
-		if (playerLocation->get_west() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
-
-	else if (dir == Direction::NW)
-	{
-		if (playerLocation->get_northwest() == nullptr)
-		{
-			return false;
-		}
-		else
-		{
-			return true;
-		}
-	}
+	this->hints = std::move(hints);
 }
@@ -2,27 +2,42 @@
  * Program Name: Board.hpp
  * Author: Alexander Densmore
  * Date: 12/3/18
- * Description: Class that implements a Board object consisting of linked Space objects for use in 
+ * Description: Class that implements a Board object consisting of Space objects for use in 
  * 		the Ancient Rome-Themed game.
  *
- * 		An enum class included in the Board class's header file
- * 		defines the Direction data type for use in the Board class.
+ * 		The layout of the board (which type of space is at each location and which spaces
+ * 		border each other) is described by a GameMap (see GameMap.hpp), which is shared by
+ * 		every Board that uses it. By default, a Board uses the map of Rome of the original
+ * 		game, but it can use any map, such as a map loaded from a map file. Every space of
+ * 		the same type is played through the same Space object.
+ *
+ * 		The text-based board images are loaded once per process by the Content class. They
+ * 		show the map of Rome, so on any other map the player's location is printed instead.
  *
  * 		Private data members of the Board class include the following:
- * 		- A vector containing text-based board images
- * 		- Pointers to each of the 9 different Spaces on the board
- * 		- A pointer to the space at which the player is currently located
+ * 		- The GameMap of the board
+ * 		- An array of pointers to one Space of each of the 9 different types, indexed by
+ * 		  SpaceType
+ * 		- A bool indicating whether or not the board images show the board's map
+ * 		- The table of hints (see HintTable.hpp), if the player can ask for hints
+ * 		- The menus of every location (see BoardMenus.hpp), built once per map and shared
+ * 		  by every board that uses it, so that no menu is built for a board or a game
+ *
+ *		The player's location is not stored in the Board. It is kept in the GameState so
+ *		that the Board never changes during a game.
  *
  *		Public member functions include:
- *		- A constructor and destructor
- *		- An accessor method that returns the Space pointer to the player's location
+ *		- Constructors (using the map of Rome or a given map) and a destructor
+ *		- An accessor method that returns the Space pointer at a given location
+ *		- An accessor method that returns the board's GameMap
+ *		- Accessor methods that return the menu asking whether to enter the space at a
+ *		  location and the menu of directions in which the player can move from it (each
+ *		  also offers a hint if the board has a table of hints)
  *		- A function that prints an image of the board (including the player's location)
- *		- A function that moves the player on the board
- *
- *		Private member functions include:
- *		- A function that sets the choices of the menu of where the player can move
- *		  (based on which spaces, if any, are in each direction from the player)
- *		- A function that determines whether a move in a given direction is possible
+ *		- A function that moves the player on the board (the menu of directions also
+ *		  offers a hint, the best direction in which to move, if the board has a table
+ *		  of hints)
+ *		- Accessor and mutator methods for the table of hints
  ***************************************************************************************************/
 #ifndef BOARD_HPP
 #define BOARD_HPP
@@ -37,41 +52,39 @@
 #include "Colosseum.hpp"
 #include "Thermae.hpp"
 #include "CampusMartius.hpp"
+#include "GameMap.hpp"
+#include "BoardMenus.hpp"
 
 // Constant indicating the number of board images to be stored in boardImages data member
 // (one image for each space on the board)
 const int NUM_BOARD_IMAGES = 9;
 
-// Enum class that defines Direction data type for use in Board class
-enum class Direction{N, NE, E, SE, S, SW, W, NW};
+// Table of the best choice in every state of a game (see HintTable.hpp)
+class HintTable;
 
 // Board class declaration
 class Board
 {
 	private:
 		// Private data members
-		std::vector<std::string> boardImages;
-		Space* space1;
-		Space* space2;
-		Space* space3;
-		Space* space4;
-		Space* space5;
-		Space* space6;
-		Space* space7;
-		Space* space8;
-		Space* space9;
-		Space* playerLocation;
-
-		// Private member functions
-		void set_move_menu(std::vector<std::string>& moveMenuChoices);
-		bool is_valid_move(Direction dir);
+		std::shared_ptr<const GameMap> map;
+		Space* spaces[NUM_SPACE_TYPES];
+		bool hasImages;
+		std::shared_ptr<const HintTable> hints;
+		std::shared_ptr<const BoardMenus> menus;
 
 	public:
 		// Public member functions
 		Board();
+		Board(std::shared_ptr<const GameMap> map);
 		~Board();
-		Space* get_player_location() const;
-		void print_board();
-		void move();
+		Space* get_space(std::uint32_t location) const;
+		const GameMap& get_map() const;
+		MenuChoices get_enter_menu(std::uint32_t location) const;
+		MenuChoices get_move_menu(std::uint32_t location) const;
+		void print_board(GameIO& io, std::uint32_t location);
+		Task<void> move(GameIO& io, GameState& state);
+		const HintTable* get_hints() const;
+		void set_hints(std::shared_ptr<const HintTable> hints);
 };
 #endif
@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * Program Name: BoardMenus.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: BoardMenus class that holds the menus of every location on a map, shared by every
+ * 		Board that uses the map and built one location at a time. See BoardMenus.hpp.
+ ***************************************************************************************************/
+#include "BoardMenus.hpp"
+#include <mutex>
+
+
+/***************************************************************************************************
+ * Description: Constructor of BoardMenus class that receives a map and a Space of each type
+ * 		(indexed by SpaceType). Stores the map and the name of each type of space, and marks
+ * 		the menus of every location as not yet built.
+ ***************************************************************************************************/
+
+BoardMenus::BoardMenus(const GameMap& map, Space* const spaces[NUM_SPACE_TYPES]) :
+	map(&map), numLocations(map.num_spaces()), locations(new std::atomic<const LocationMenus*>[numLocations])
+{
+	for (int typeNum = 0; typeNum < NUM_SPACE_TYPES; typeNum++)
+	{
+		spaceNames[typeNum] = spaces[typeNum]->get_name();
+	}
+	for (std::uint32_t location = 0; location < numLocations; location++)
+	{
+		locations[location].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor that deallocates the menus of every location that were built (without
+ * 		looking at the map, which is usually being destroyed).
+ ***************************************************************************************************/
+
+BoardMenus::~BoardMenus()
+{
+	for (std::uint32_t location = 0; location < numLocations; location++)
+	{
+		delete locations[location].load(std::memory_order_relaxed);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives a map and a Space of each type (indexed by
+ * 		SpaceType). Returns the menus of the map, held by the map and shared with every other
+ * 		Board that uses it, creating them (with no location's menus built yet) if no Board has.
+ * 		Safe to call from any thread.
+ ***************************************************************************************************/
+
+std::shared_ptr<const BoardMenus> BoardMenus::for_map(const GameMap& map, Space* const spaces[NUM_SPACE_TYPES])
+{
+	std::call_once(map.menusOnce, [&map, spaces]()
+	{
+		map.menus = std::make_shared<const BoardMenus>(map, spaces);
+	});
+	return map.menus;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a location and returns its menus, building
+ * 		them if no Board has asked for them yet: the menu asking whether to enter the space
+ * 		there or keep moving, and the menu of where the player can move from there. If two
+ * 		threads build the same menus at once, the menus of the first to store them are kept
+ * 		and the others are discarded.
+ ***************************************************************************************************/
+
+const LocationMenus& BoardMenus::location_menus(std::uint32_t location) const
+{
+	const LocationMenus* found = locations[location].load(std::memory_order_acquire);
+	if (found != nullptr)
+	{
+		return *found;
+	}
+
+	LocationMenus* built = new LocationMenus;
+
+	// For the sake of consistency with what each direction’s number is in the menu, all
+	// directions will be printed as choices, even if they player cannot move in that direction.
+	// After the name of the direction, the name of the space that is in that direction will be
+	// printed or the message “cannot move in this direction” will be printed if applicable.
+	for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+	{
+		std::string directionMenuOption = std::string(DIRECTION_NAMES[dirNum]) + ": ";
+		std::uint32_t neighbor = map->get_neighbor(location, static_cast<Direction>(dirNum));
+		if (neighbor != NO_SPACE)
+		{
+			directionMenuOption += spaceNames[static_cast<int>(map->get_type(neighbor))];
+		}
+		else
+		{
+			directionMenuOption += "(cannot move in this direction)";
+		}
+		built->directionText[dirNum] = std::move(directionMenuOption);
+		built->moveMenu[dirNum] = built->directionText[dirNum];
+	}
+	built->moveMenu[NUM_DIRECTIONS] = "Hint";
+
+	built->enterText = "Enter " + spaceNames[static_cast<int>(map->get_type(location))];
+	built->enterMenu[0] = built->enterText;
+	built->enterMenu[1] = "Keep moving";
+	built->enterMenu[2] = "Hint";
+
+	if (!locations[location].compare_exchange_strong(found, built, std::memory_order_acq_rel, std::memory_order_acquire))
+	{
+		delete built;
+		return *found;
+	}
+	return *built;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive a location and whether to offer a hint. They return
+ * 		the menu asking whether to enter the space at the location or keep moving, and the
+ * 		menu of the 8 directions from the location, each ending with the hint if asked to
+ * 		(building the location's menus the first time either is asked for). The menus stay
+ * 		valid as long as the BoardMenus does.
+ ***************************************************************************************************/
+
+MenuChoices BoardMenus::get_enter_menu(std::uint32_t location, bool withHint) const
+{
+	return MenuChoices(location_menus(location).enterMenu, withHint ? ENTER_MENU_SIZE : ENTER_MENU_SIZE - 1);
+}
+
+MenuChoices BoardMenus::get_move_menu(std::uint32_t location, bool withHint) const
+{
+	return MenuChoices(location_menus(location).moveMenu, withHint ? MOVE_MENU_SIZE : MOVE_MENU_SIZE - 1);
+}
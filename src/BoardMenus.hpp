@@ -0,0 +1,89 @@
+/***************************************************************************************************
+ * Program Name: BoardMenus.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: BoardMenus class that holds the menus of every location on a map: the menu asking
+ * 		whether to enter the space there or keep moving, and the menu of the 8 directions in
+ * 		which the player can try to move from there (each naming the space in that
+ * 		direction, if any). Each menu also offers a hint, which a Board leaves out if it has
+ * 		no table of hints.
+ *
+ * 		The menus of a map never change, so they are held by the GameMap itself (created
+ * 		once, when the first Board uses the map) and shared (through a shared_ptr) by every
+ * 		Board that uses it, and the menus of a location are built the first time any of
+ * 		those Boards asks for them. Creating a Board (and so a Game) therefore
+ * 		builds no menu whatever the size of the map, and a location's menus are displayed
+ * 		without allocating anything on every later visit. Boards on different threads may
+ * 		share the menus: the first to build a location's menus publishes them atomically.
+ * 		The menus of a map are freed with the map (or, if a Board still holds them, with the
+ * 		last such Board, which also holds the map).
+ *
+ * 		Private data members of the BoardMenus class include the following:
+ * 		- The GameMap whose menus are held and its number of locations
+ * 		- The name of the space of each type
+ * 		- A pointer to the menus of each location (nullptr until they are first built),
+ * 		  each holding the text of the choices that name spaces and the two menus, as
+ * 		  views of that text and of string literals
+ *
+ *		Public member functions include:
+ *		- A constructor (given a map and a Space of each type) and a destructor
+ *		- A static function that returns the shared menus of a map (creating them, and
+ *		  storing them in the map, the first time it is called with the map)
+ *		- Accessor methods that return the menu asking whether to enter the space at a
+ *		  location and the menu of directions from it (with or without the hint)
+ *
+ *		Private member functions include:
+ *		- A function that returns the menus of a location, building them if needed
+ ***************************************************************************************************/
+#ifndef BOARDMENUS_HPP
+#define BOARDMENUS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "GameIO.hpp"
+#include "GameMap.hpp"
+#include "Space.hpp"
+
+// Number of choices in the menu asking whether to enter a space (including the hint)
+const int ENTER_MENU_SIZE = 3;
+
+// Number of choices in the menu of directions (including the hint)
+const int MOVE_MENU_SIZE = NUM_DIRECTIONS + 1;
+
+// Menus of one location (the text of each direction and of the choice to enter the space,
+// and the two menus as views of that text; the other choices are string literals)
+struct LocationMenus
+{
+	std::string directionText[NUM_DIRECTIONS];
+	std::string enterText;
+	std::string_view enterMenu[ENTER_MENU_SIZE];
+	std::string_view moveMenu[MOVE_MENU_SIZE];
+};
+
+// BoardMenus class declaration
+class BoardMenus
+{
+	private:
+		// Private data members
+		const GameMap* map;
+		std::uint32_t numLocations;
+		std::string spaceNames[NUM_SPACE_TYPES];
+		std::unique_ptr<std::atomic<const LocationMenus*>[]> locations;
+
+		// Private member functions
+		const LocationMenus& location_menus(std::uint32_t location) const;
+
+	public:
+		// Public member functions
+		BoardMenus(const GameMap& map, Space* const spaces[NUM_SPACE_TYPES]);
+		~BoardMenus();
+		BoardMenus(const BoardMenus&) = delete;
+		BoardMenus& operator=(const BoardMenus&) = delete;
+		static std::shared_ptr<const BoardMenus> for_map(const GameMap& map, Space* const spaces[NUM_SPACE_TYPES]);
+		MenuChoices get_enter_menu(std::uint32_t location, bool withHint) const;
+		MenuChoices get_move_menu(std::uint32_t location, bool withHint) const;
+};
+#endif
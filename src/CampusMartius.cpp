@@ -12,29 +12,21 @@
  * 		prefect every game, so the player can make note of the correct answer to any 
  * 		they got wrong when playing again.) Once the player gains the prefect's
  * 		trust, he asks them to bring him 2 items from the Forum (1 expensive and 1 cheap).
- * 		The 2 particular items are randomly selected when the CampusMartius constructor is called.
+ * 		The 2 particular items are randomly selected at the start of each game.
  * 		Once the player delivers these items, they receive the permit
  * 		to see Nero.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
- *		Additional private data members of CampusMartius class include the following:		
- *		- A bool indicating whether or not the player has passed the prefect's trust test
- *		  (that way, when they revisit the space, they do not have to pass it again)
- *		- A string indicating the expensive item the prefect wants
- *		- A string indicating the cheap item the prefect wants
- *		- A bool indicating whether or not the prefect has already received
- *		  the expensive item from the user (so he does not ask for it again once given it).
- *		- A bool indicating whether or not the prefect has already
- *		  received the cheap item from the player (so he does not ask for it again).
+ *		Whether or not the player has passed the prefect's trust test, which expensive and
+ *		cheap items the prefect wants, and which of them he has already received are kept
+ *		in the GameState so that a CampusMartius never changes during a game.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -53,32 +45,16 @@
  * Description: Default constructor for DomusAurea object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  *
- * 		Also initializes private data members of CampusMartius class,
- *		randomly selecting which expensive item and which cheap item
- *		the prefect desires in the process.
+ * 		Which expensive item and which cheap item the prefect desires is
+ *		randomly selected for each game by the new_game_state function.
  ***************************************************************************************************/
 
-CampusMartius::CampusMartius() : Space("Campus Martius", 9, "CampusMartius_Description.txt")
+CampusMartius::CampusMartius() : Space("Campus Martius", 9, Asset::CAMPUS_MARTIUS_DESCRIPTION)
 {
-	// Initialize all bool data members to false
-	hasPassedTest = false;
-	hasGivenExpensive = false;
-	hasGivenCheap = false;
-
-	// Fill vectors with the names of the expensive
-	// and cheap items, and randomly select an item
-	// from each vector
-	std::vector<std::string> expensiveItems = {OLIVE_OIL, SANDALS, WINE};
-	std::vector<std::string> cheapItems = {GRAIN, SALT, TUNIC};
-	expensiveChoice = expensiveItems[getRandomInt(0, 2)];
-	cheapChoice = cheapItems[getRandomInt(0, 2)];
 }
 
 
@@ -97,25 +73,18 @@ CampusMartius::~CampusMartius()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		# - a set of strings indicating the items in the player's satchel #
- *		  - an int indicating how much money the player has 
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		# - a bool indicating whether or not the player is still alive #
- *		  - a bool indicating whether or not the player is with Nero
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- satchel: the items in the player's satchel
+ *		- stillAlive: whether or not the player is still alive
+ *		- hasPassedTest: whether or not the player has passed the prefect's test
+ *		- expensiveChoice and cheapChoice: the items the prefect wants
+ *		- hasGivenExpensive and hasGivenCheap: which of those items the player has given
  *
  *		The CampusMartius's implementation of this function does the following:
  *		- Allows the player to interact with the Praetorian Prefect (leader of bodyguards)
@@ -127,15 +96,14 @@ CampusMartius::~CampusMartius()
  *		  to see Nero.
  ***************************************************************************************************/
 
-void CampusMartius::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> CampusMartius::interact(GameIO& io, GameState& state, [[maybe_unused]] Random& rng)
 {
 	// If the user has not yet passed the prefect's trustworthiness test,
 	// call the test_user function, storing the return value
 	// in the stillAlive reference variable
-	if (!hasPassedTest)
+	if (!state.hasPassedTest)
 	{
-		stillAlive = test_user();
+		state.stillAlive = co_await test_user(io, state);
 	}
 	
 	// Otherwise, if the user has not yet obtained the permit,
@@ -144,130 +112,131 @@ void CampusMartius::interact(std::set<std::string>& satchel, int& money, int& st
 	// if they do. Note: If the user has obtained the permit,
 	// they will possess it until the end of the game.
 	// Therefore, simply check satchel for permit.
-	else if(satchel.find(PERMIT) == satchel.end())
+	else if(!state.satchel.contains(PERMIT))
 	{
-		give_items(satchel);
+		co_await give_items(io, state);
 	}
 	
 	// Otherwise, the prefect urges the user to hurry up and see Nero
 	// now that they have the permit.
 	else
 	{
-		std::cout << "I’ve already given you permission to see Nero.\n"; 
-		std::cout << "What are you waiting for? Get to the Domus Aurea at once!\n";
+		io.out() << "I’ve already given you permission to see Nero.\n"; 
+		io.out() << "What are you waiting for? Get to the Domus Aurea at once!\n";
 	}
-	pressEnter();
+	co_await io.pause();
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function that executes the prefect's test of the user
- * 		in which he asks them 3 questions to test their loyalty. Receives no parameters.
- * 		Returns a bool indicating whether or not the user has passed the test.
+ * Description: Private member coroutine that executes the prefect's test of the user
+ * 		in which he asks them 3 questions to test their loyalty. Receives the GameState
+ * 		passed by reference so that the test can be marked as passed. Returns a bool
+ * 		indicating whether or not the user has passed the test.
  ***************************************************************************************************/
 
-bool CampusMartius::test_user()
+Task<bool> CampusMartius::test_user(GameIO& io, GameState& state)
 {
 	// Prefect stops and interrogates player
-	std::cout << "Halt! Who goes there?\n";
-	std::cout << "You say you want to see Nero?\n";
-	std::cout << "Well, I, Gaius Silius, am the Prefect of the Praetorian Guard.\n";
-	std::cout << "Emperor Nero is very busy, so in order to see him, you’ll need my permission.\n";
-	std::cout << "I will ask you 3 questions to see if you are worthy of seeing the emperor.\n\n";
+	io.out() << "Halt! Who goes there?\n";
+	io.out() << "You say you want to see Nero?\n";
+	io.out() << "Well, I, Gaius Silius, am the Prefect of the Praetorian Guard.\n";
+	io.out() << "Emperor Nero is very busy, so in order to see him, you’ll need my permission.\n";
+	io.out() << "I will ask you 3 questions to see if you are worthy of seeing the emperor.\n\n";
 	
 	// Ask user first question. Return false if they answer incorrectly. Otherwise,
 	// proceed to next question.
-	std::cout << "Of what country are you a citizen?\n";
-	std::vector<std::string> question1Choices = {"The United States", "Rome", "Germany"};
-	int answerChoice = menu(question1Choices);
+	io.out() << "Of what country are you a citizen?\n";
+	const std::string_view question1Choices[] = {"The United States", "Rome", "Germany"};
+	int answerChoice = co_await io.choose(Prompt::LOYALTY_QUESTION, question1Choices);
 	
 	if (answerChoice == 2)
 	{
-		std::cout << "OK, so you are a Roman. Good thing, because I do not trust non-Romans.\n";
+		io.out() << "OK, so you are a Roman. Good thing, because I do not trust non-Romans.\n";
 	}
 	else
 	{
-		std::cout << "I don’t trust non-Romans, especially those who want an audience with the emperor.\n";
-		std::cout << "I must kill you now for the protection of the emperor.\n";
-		return false;
+		io.out() << "I don’t trust non-Romans, especially those who want an audience with the emperor.\n";
+		io.out() << "I must kill you now for the protection of the emperor.\n";
+		co_return false;
 	}
 	
 	// Ask user second question, returning false if they answer incorrectly and proceeding
 	// to the final question if they answer correctly.
-	std::cout << "\nWho is the best emperor?\n";
-	std::vector<std::string> question2Choices = {"Nero", "Caligula", "Augustus"};
-	answerChoice = menu(question2Choices);
+	io.out() << "\nWho is the best emperor?\n";
+	const std::string_view question2Choices[] = {"Nero", "Caligula", "Augustus"};
+	answerChoice = co_await io.choose(Prompt::LOYALTY_QUESTION, question2Choices);
 	
 	if (answerChoice == 1)
 	{
-		std::cout << "I agree! Nero is the best emperor! Long live Nero!\n";
+		io.out() << "I agree! Nero is the best emperor! Long live Nero!\n";
 	}
 	else
 	{
-		std::cout << "This is treason! How dare you be such a traitor to your country?\n"; 
-		std::cout << "Clearly, Nero is the best emperor ever. You must be plotting to overthrow him …\n"; 
-		std::cout << "I know some scoundrles have talked of such plans, and I am to immediately\n"; 
-		std::cout << "execute anyone on the spot who even hints at conspiracy.\n";
-		std::cout << "Time to die, traitor!\n";
-		return false;
+		io.out() << "This is treason! How dare you be such a traitor to your country?\n"; 
+		io.out() << "Clearly, Nero is the best emperor ever. You must be plotting to overthrow him …\n"; 
+		io.out() << "I know some scoundrles have talked of such plans, and I am to immediately\n"; 
+		io.out() << "execute anyone on the spot who even hints at conspiracy.\n";
+		io.out() << "Time to die, traitor!\n";
+		co_return false;
 	}
 	
 	// Ask user the final question. If they answer correctly, return true
-	// and set hasPassedTest data member to true. Otherwise,
+	// and set hasPassedTest field of the state to true. Otherwise,
 	// return false.
-	std::cout << "\nWhat was Nero’s role in the Great Fire?\n";
-	std::vector<std::string> question3Choices = {"He started it.", "He played the lyre while Rome burned.",
+	io.out() << "\nWhat was Nero’s role in the Great Fire?\n";
+	const std::string_view question3Choices[] = {"He started it.", "He played the lyre while Rome burned.",
 						    "He made improvements to Rome after the Great Fire to prevent future fires."};
-	answerChoice = menu(question3Choices);
+	answerChoice = co_await io.choose(Prompt::LOYALTY_QUESTION, question3Choices);
 	
 	if (answerChoice == 3)
 	{
-		std::cout << "I am glad you acknowledge just how much our great emperor has done\n";
-		std::cout << "to protect Rome from future fires! I can’t believe those traitors\n";
-		std::cout << "who claim he started the fire or played his lyre while Rome burned.\n\n";
+		io.out() << "I am glad you acknowledge just how much our great emperor has done\n";
+		io.out() << "to protect Rome from future fires! I can’t believe those traitors\n";
+		io.out() << "who claim he started the fire or played his lyre while Rome burned.\n\n";
 		
-		std::cout << "Clearly, you are a supporter of Nero who is worthy to see the emperor.\n";
-		std::cout << "\nI do have a favor to ask before I give you permission to visit Nero, though.\n";
-		std::cout << "Could you pick some items up for me in the Forum?\n";
-		std::cout << "I am on duty the rest of the day but could use the following items:\n";
-		std::cout << "\t- " << expensiveChoice << std::endl;
-		std::cout << "\t- " << cheapChoice << std::endl;
-		std::cout << "\nReturn here with those, and I will be happy to give you a permit to see Nero.\n";
+		io.out() << "Clearly, you are a supporter of Nero who is worthy to see the emperor.\n";
+		io.out() << "\nI do have a favor to ask before I give you permission to visit Nero, though.\n";
+		io.out() << "Could you pick some items up for me in the Forum?\n";
+		io.out() << "I am on duty the rest of the day but could use the following items:\n";
+		io.out() << "\t- " << item_name(state.expensiveChoice) << std::endl;
+		io.out() << "\t- " << item_name(state.cheapChoice) << std::endl;
+		io.out() << "\nReturn here with those, and I will be happy to give you a permit to see Nero.\n";
 		
-		hasPassedTest = true;
-		return true;
+		state.hasPassedTest = true;
+		co_return true;
 	}
 	else
 	{
-		std::cout << "How dare you insult our dear emperor like that! All honest, trustworthy Roman citizens\n";
-		std::cout << "know that Nero was deeply grieved by the Great Fire and did everything in his power\n"; 
-		std::cout << "to prevent future fires.\n";
-		std::cout << "You may have survived the Great Fire, but you will not survive my wrath.\n";
-		std::cout << "For Nero!\n";
-		return false;
+		io.out() << "How dare you insult our dear emperor like that! All honest, trustworthy Roman citizens\n";
+		io.out() << "know that Nero was deeply grieved by the Great Fire and did everything in his power\n"; 
+		io.out() << "to prevent future fires.\n";
+		io.out() << "You may have survived the Great Fire, but you will not survive my wrath.\n";
+		io.out() << "For Nero!\n";
+		co_return false;
 	}
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function that allows user to give items
+ * Description: Private member coroutine that allows user to give items
  * 		in their satchel to the prefect in order to obtain the permit
- * 		to see Nero. Receives the set of strings representing the items
- * 		in the user's satchel passed by reference. Returns nothing.
+ * 		to see Nero. Receives the GameState (which holds the user's satchel and
+ * 		which items have been given) passed by reference. Returns nothing.
  ***************************************************************************************************/
 
-void CampusMartius::give_items(std::set<std::string>& satchel)
+Task<void> CampusMartius::give_items(GameIO& io, GameState& state)
 {
 	// Check to see if the user has already given each item.
 	// For each item that the user has not given, check to see if it is available to give now
 	// and remove it from stachel if present using check_for_item function.
-	if (!hasGivenExpensive)
+	if (!state.hasGivenExpensive)
 	{
-		hasGivenExpensive = check_for_item(satchel, expensiveChoice);
+		state.hasGivenExpensive = co_await check_for_item(io, state.satchel, state.expensiveChoice);
 	}
-	if (!hasGivenCheap)
+	if (!state.hasGivenCheap)
 	{
-		hasGivenCheap = check_for_item(satchel, cheapChoice);
+		state.hasGivenCheap = co_await check_for_item(io, state.satchel, state.cheapChoice);
 	}
 
 	// Now that the user has given each item if they have it,
@@ -275,64 +244,63 @@ void CampusMartius::give_items(std::set<std::string>& satchel)
 	
 	// If the user has not given the prefect either item,
 	// request that they return with both.
-	if (hasGivenExpensive == false && hasGivenCheap == false)
+	if (state.hasGivenExpensive == false && state.hasGivenCheap == false)
 	{
-		std::cout << "I am still waiting on the " << expensiveChoice << " and " << cheapChoice << " from you.\n";
-		std::cout << "Bring them to me as soon as you have them!\n";
+		io.out() << "I am still waiting on the " << item_name(state.expensiveChoice) << " and " << item_name(state.cheapChoice) << " from you.\n";
+		io.out() << "Bring them to me as soon as you have them!\n";
 	}
 
 	// Otherwise, if the user has not given the expensive item (but has given the cheap one),
 	// respond by requesting the expensive item.
-	else if (!hasGivenExpensive)
+	else if (!state.hasGivenExpensive)
 	{
-		std::cout << "Although you have brought me the " << cheapChoice << ",\n"; 
-		std::cout << "I am still waiting on the " << expensiveChoice << " from you. Bring it to me right away!\n";
+		io.out() << "Although you have brought me the " << item_name(state.cheapChoice) << ",\n"; 
+		io.out() << "I am still waiting on the " << item_name(state.expensiveChoice) << " from you. Bring it to me right away!\n";
 	}
 
 	// Otherwise, if the user has not given the cheap item (but has given
 	// the expensive item), request that they return with the cheap item
-	else if (!hasGivenCheap)
+	else if (!state.hasGivenCheap)
 	{
-		std::cout << "Although you have brought me the " << expensiveChoice << ",\n";
-		std::cout << "I am still waiting on the " << cheapChoice << " from you.\n"; 
-		std::cout << "If you can afford to buy me the " << expensiveChoice << ",\n";
-		std::cout << "you can afford to buy me the " << cheapChoice << "! Come back as soon as you have it!\n";
+		io.out() << "Although you have brought me the " << item_name(state.expensiveChoice) << ",\n";
+		io.out() << "I am still waiting on the " << item_name(state.cheapChoice) << " from you.\n"; 
+		io.out() << "If you can afford to buy me the " << item_name(state.expensiveChoice) << ",\n";
+		io.out() << "you can afford to buy me the " << item_name(state.cheapChoice) << "! Come back as soon as you have it!\n";
 	}
 	
 	// Otherwise, since the user has given the soldier both items that
 	// he has requested, he gives them the permit to see Nero.
 	else
 	{
-		std::cout << "Since you have brought me the " << expensiveChoice << " and the " << cheapChoice; 
-		std::cout << " like I asked,\nI will give you permission to see the Great Emperor Nero.\n";
-		satchel.insert(PERMIT);
+		io.out() << "Since you have brought me the " << item_name(state.expensiveChoice) << " and the " << item_name(state.cheapChoice); 
+		io.out() << " like I asked,\nI will give you permission to see the Great Emperor Nero.\n";
+		state.satchel.insert(PERMIT);
 	}
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function called by give_items() function that checks to see whether
- * 		or not the user's satchel contains a given item. Receives the set of strings 
+ * Description: Private member coroutine called by give_items() that checks to see whether
+ * 		or not the user's satchel contains a given item. Receives the Satchel
  * 		representing the contents of the player's satchel passed by reference
- * 		as well as a string representing the name of the item sought
- * 		passed by value. Removes the item from the player's satchel if found. 
+ * 		as well as the ID of the item sought. Removes the item from the player's satchel if found. 
  * 		Returns a bool indicating whether or not the item was found.
  ***************************************************************************************************/
 
-bool CampusMartius::check_for_item(std::set<std::string>& satchel, std::string itemName)
+Task<bool> CampusMartius::check_for_item(GameIO& io, Satchel& satchel, ItemId item)
 {
 	// First, check to see if the satchel is empty,
 	// returning false if it is.
 	if (satchel.empty())
 	{
-		return false;
+		co_return false;
 	}
 	
 	// Otherwise, if the item is not in the satchel,
 	// return false.
-	else if (satchel.find(itemName) == satchel.end())
+	else if (!satchel.contains(item))
 	{
-		return false;
+		co_return false;
 	}
 	
 	// Otherwise, since the item was founc,
@@ -341,11 +309,11 @@ bool CampusMartius::check_for_item(std::set<std::string>& satchel, std::string i
 	// Return true to indicate that the item was found.
 	else
 	{
-		std::cout << "Now giving the soldier the " << itemName << "...\n";
-		satchel.erase(itemName);
+		io.out() << "Now giving the soldier the " << item_name(item) << "...\n";
+		satchel.erase(item);
 
-		pressEnter();
+		co_await io.pause();
 
-		return true;
+		co_return true;
 	}
 }
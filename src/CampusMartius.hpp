@@ -12,29 +12,21 @@
  * 		prefect every game, so the player can make note of the correct answer to any 
  * 		they got wrong when playing again.) Once the player gains the prefect's
  * 		trust, he asks them to bring him 2 items from the Forum (1 expensive and 1 cheap).
- * 		The 2 particular items are randomly selected when the CampusMartius constructor is called.
+ * 		The 2 particular items are randomly selected at the start of each game.
  * 		Once the player delivers these items, they receive the permit
  * 		to see Nero.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
- *		Additional private data members of CampusMartius class include the following:		
- *		- A bool indicating whether or not the player has passed the prefect's trust test
- *		  (that way, when they revisit the space, they do not have to pass it again)
- *		- A string indicating the expensive item the prefect wants
- *		- A string indicating the cheap item the prefect wants
- *		- A bool indicating whether or not the prefect has already received
- *		  the expensive item from the user (so he does not ask for it again once given it).
- *		- A bool indicating whether or not the prefect has already
- *		  received the cheap item from the player (so he does not ask for it again).
+ *		Whether or not the player has passed the prefect's trust test, which expensive and
+ *		cheap items the prefect wants, and which of them he has already received are kept
+ *		in the GameState so that a CampusMartius never changes during a game.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -55,23 +47,15 @@
 class CampusMartius : public Space
 {
 	private:
-		// Private data members
-		bool hasPassedTest;
-		std::string expensiveChoice;
-		std::string cheapChoice;
-		bool hasGivenExpensive;
-		bool hasGivenCheap;
-		
 		// Private member functions
-		bool test_user();
-		void give_items(std::set<std::string>& satchel);
-		bool check_for_item(std::set<std::string>& satchel, std::string itemName);
+		Task<bool> test_user(GameIO& io, GameState& state);
+		Task<void> give_items(GameIO& io, GameState& state);
+		Task<bool> check_for_item(GameIO& io, Satchel& satchel, ItemId item);
 		
 	public:
 		// Public member functions
 		CampusMartius();
 		virtual ~CampusMartius();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -7,18 +7,16 @@
  * 		coins (in-game currency) on chariot races.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Enum class declared in CircusMaximus header file
  *		lists the colors of the three diferent chariot teams
  *		on which the player can bet.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -34,15 +32,12 @@
  * Description: Default constructor for CircusMaximus object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  ***************************************************************************************************/
 
-CircusMaximus::CircusMaximus() : Space("Circus Maximus", 4, "CircusMaximus_Description.txt")
+CircusMaximus::CircusMaximus() : Space("Circus Maximus", 4, Asset::CIRCUS_MAXIMUS_DESCRIPTION)
 {
 }
 
@@ -62,25 +57,14 @@ CircusMaximus::~CircusMaximus()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		  - a set of strings indicating the items in the player's satchel 
- *		# - an int indicating how much money the player has #
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		  - a bool indicating whether or not the player is still alive
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- money: how much money the player has
  *
  *		The CircusMaximus's implementation of this function does the following:
  *		- If the user has money available to bet, asks
@@ -91,14 +75,13 @@ CircusMaximus::~CircusMaximus()
  *		  results.
  ***************************************************************************************************/
 
-void CircusMaximus::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> CircusMaximus::interact(GameIO& io, GameState& state, Random& rng)
 {
 	// If user does not have enough money to bet the lowest amount, inform them and ask them to come back again.
-	if (money < LOW_BET)
+	if (state.money < LOW_BET)
 	{
-		std::cout << "I’m sorry, but you must have at least " << LOW_BET << " coins to bet on the chariot races."; 
-		std::cout << "Please come back again!\n";
+		io.out() << "I’m sorry, but you must have at least " << LOW_BET << " coins to bet on the chariot races."; 
+		io.out() << "Please come back again!\n";
 	}
 
 	// Otherwise, ask how much the user wants to bet (user has been informed of the purpose
@@ -123,8 +106,8 @@ void CircusMaximus::interact(std::set<std::string>& satchel, int& money, int& st
 		// Use a do-while loop to get a valid bet from the user for which they have enough coins
 		do
 		{
-			std::cout << "What would you like to bet?\n";
-			int betChoiceNum = menu(betMenu);
+			io.out() << "What would you like to bet?\n";
+			int betChoiceNum = co_await io.choose(Prompt::BET_AMOUNT, betMenu);
 			
 			if (betChoiceNum == 1)	
 			{
@@ -134,54 +117,57 @@ void CircusMaximus::interact(std::set<std::string>& satchel, int& money, int& st
 			}
 			else if (betChoiceNum == 2)
 			{
-				if (money >= MEDIUM_BET)
+				if (state.money >= MEDIUM_BET)
 				{
 					bet = MEDIUM_BET;
 					validBet = true;
 				}
 				else
 				{
-					std::cout << "You don't have enough money for that bet. Please bet a lower amount.\n";
+					io.out() << "You don't have enough money for that bet. Please bet a lower amount.\n";
 				}
 			}
 			else if (betChoiceNum == 3)
 			{
-				if (money >= HIGH_BET)
+				if (state.money >= HIGH_BET)
 				{
 					bet = HIGH_BET;
 					validBet = true;
 				}
 				else
 				{
-					std::cout << "You don't have enough money for that bet. Please bet a lower amount.\n";
+					io.out() << "You don't have enough money for that bet. Please bet a lower amount.\n";
 				}
 			}
 
 		} while(!validBet);
 		
 		// Deduct the bet from the player's current amount of money.
-		money -= bet;
+		state.money -= bet;
 
 		// Call the race function, passing it the bet and adding the return value to the player's money.
 		// If the player loses, the return value is 0. If they win, it is twice what they bet.
-		money += race(bet);
+		int winnings = co_await race(io, bet, rng);
+		io.event(EventType::RACE_FINISHED, winnings);
+		state.money += winnings;
 	}
 
-	pressEnter();
+	co_await io.pause();
 }
 
 
 /*************************************************************************************************** 
- * Description: Function that simulates a chariot race. Receives an int indicating the user's bet.
+ * Description: Coroutine that simulates a chariot race. Receives an int indicating the user's bet
+ * 		and the game's Random number generator, from which the winning team is drawn.
  * 		Returns an int indicating how much money the user won (returns 0 if the user lost).
  ***************************************************************************************************/
 
-int CircusMaximus::race(int bet)
+Task<int> CircusMaximus::race(GameIO& io, int bet, Random& rng)
 {
 	// Get the user's choice for what team they think will win
-	std::cout << "On what team would you like to bet?\n";
-	std::vector<std::string> colorMenu = {"Red", "Green", "Blue"};
-	int colorChoiceNum = menu(colorMenu);
+	io.out() << "On what team would you like to bet?\n";
+	const std::string_view colorMenu[] = {"Red", "Green", "Blue"};
+	int colorChoiceNum = co_await io.choose(Prompt::BET_TEAM, colorMenu);
 	
 	// Decrement colorChoiceNum (so it corresponds to the correct enum value of the color chosen) 
 	// and static_cast to Color
@@ -189,20 +175,20 @@ int CircusMaximus::race(int bet)
 	Color betColor = static_cast<Color>(colorChoiceNum);
 
 	// Randomly select the color of the winning team
-	Color winnerColor = static_cast<Color>(getRandomInt(0, 2));
+	Color winnerColor = static_cast<Color>(rng.get_int(0, 2));
 	
 	// Report the color of the winning team
 	if (winnerColor == Color::RED)
 	{
-		std::cout << "Red wins!\n";
+		io.out() << "Red wins!\n";
 	}
 	else if (winnerColor == Color::GREEN)
 	{
-		std::cout << "Green wins!\n";
+		io.out() << "Green wins!\n";
 	}
 	else if (winnerColor == Color::BLUE)
 	{
-		std::cout << "Blue wins!\n";
+		io.out() << "Blue wins!\n";
 	}
 	
 	// Determine whether or not the user has won. Report the results.
@@ -211,13 +197,13 @@ int CircusMaximus::race(int bet)
 	if (betColor == winnerColor)
 	{
 		winnings = bet * 2;
-		std::cout << "Congratulations! Since you picked the winning team, you have earned " << winnings << " coins!\n";
+		io.out() << "Congratulations! Since you picked the winning team, you have earned " << winnings << " coins!\n";
 	}
 	else
 	{
-		std::cout << "I’m sorry, but you did not pick the winning team, so you have lost your bet.\n";
-		std::cout << "Please come back and play again!\n";
+		io.out() << "I’m sorry, but you did not pick the winning team, so you have lost your bet.\n";
+		io.out() << "Please come back and play again!\n";
 	}
 
-	return winnings;
+	co_return winnings;
 }
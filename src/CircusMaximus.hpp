@@ -7,18 +7,16 @@
  * 		coins (in-game currency) on chariot races.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Enum class declared in CircusMaximus header file
  *		lists the colors of the three diferent chariot teams
  *		on which the player can bet.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -44,11 +42,10 @@ enum class Color{RED, GREEN, BLUE};
 class CircusMaximus : public Space
 {
 	private:
-		int race(int bet);
+		Task<int> race(GameIO& io, int bet, Random& rng);
 	public:
 		CircusMaximus();
 		virtual ~CircusMaximus();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -12,11 +12,10 @@
  * 		50% chance that they die and lose the entire game.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Enum class is included within the Colosseum's header file that
  *		defines Move data type (which names 3 different moves possible
@@ -26,7 +25,6 @@
  *		indicating the user's move choices.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -40,18 +38,15 @@
  * Description: Default constructor for Colosseum object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  *
  * 		In addition, Colosseum constructor initializes
  * 		moveMenu private data member.
  ***************************************************************************************************/
 
-Colosseum::Colosseum() : Space("Colosseum", 7, "Colosseum_Description.txt")
+Colosseum::Colosseum() : Space("Colosseum", 7, Asset::COLOSSEUM_DESCRIPTION)
 {
 	moveMenu.push_back("Shield");
 	moveMenu.push_back("Net");
@@ -74,25 +69,15 @@ Colosseum::~Colosseum()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		  - a set of strings indicating the items in the player's satchel 
- *		# - an int indicating how much money the player has #
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		# - a bool indicating whether or not the player is still alive #
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- money: how much money the player has
+ *		- stillAlive: whether or not the player is still alive
  *
  *		The Colosseum's implementation of this function does the following:
  *		- Implements gladitorial battles with shield, net, sword system
@@ -104,16 +89,15 @@ Colosseum::~Colosseum()
  *		  points first loses the match.
  ***************************************************************************************************/
 
-void Colosseum::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> Colosseum::interact(GameIO& io, GameState& state, Random& rng)
 {
 	// Print rules
-	std::cout << "The gladiator battle is about to begin. You each have 5 strength points\n";
-	std::cout << "Whoever loses a turn loses a strength point. Whoever runs out of strength points first loses the match.\n";
-	std::cout << "Remember, this is like rock, paper, scissors. Shield beats sword, sword beats net, net beats shield.\n";
-	std::cout << "If you both throw the same move, that turn is a draw and no one loses strength points.\n";
+	io.out() << "The gladiator battle is about to begin. You each have 5 strength points\n";
+	io.out() << "Whoever loses a turn loses a strength point. Whoever runs out of strength points first loses the match.\n";
+	io.out() << "Remember, this is like rock, paper, scissors. Shield beats sword, sword beats net, net beats shield.\n";
+	io.out() << "If you both throw the same move, that turn is a draw and no one loses strength points.\n";
 	
-	pressEnter();
+	co_await io.pause();
 	
 	// Initialize starting strength points
 	int userStrengthPoints = 5;
@@ -121,20 +105,20 @@ void Colosseum::interact(std::set<std::string>& satchel, int& money, int& stepsS
 	
 	while (userStrengthPoints > 0 && computerStrengthPoints > 0)
 	{
-		std::system("clear");
-		std::cout << "\t\tYour strength points: " << userStrengthPoints;
-		std::cout << "\t\tYour opponent's strength points: " << computerStrengthPoints << "\n\n";
-		std::cout << "Select your move:\n";
+		io.clear_screen();
+		io.out() << "\t\tYour strength points: " << userStrengthPoints;
+		io.out() << "\t\tYour opponent's strength points: " << computerStrengthPoints << "\n\n";
+		io.out() << "Select your move:\n";
 		
 		// Get user's move choice. Decrement so it aligns with enum value of move.
 		// Static cast to move.
-		int userMoveNum = menu(moveMenu);
+		int userMoveNum = co_await io.choose(Prompt::GLADIATOR_MOVE, moveMenu);
 		userMoveNum--;
 		Move userMove = static_cast<Move>(userMoveNum);
 
 		// Randomly determine computer's move
-		int computerMoveNum = getRandomInt(0, 2);
-		std::cout << "Your opponent’s move: " << moveMenu[computerMoveNum] << std::endl;
+		int computerMoveNum = rng.get_int(0, 2);
+		io.out() << "Your opponent’s move: " << moveMenu[computerMoveNum] << std::endl;
 		Move computerMove = static_cast<Move>(computerMoveNum);
 		
 		// Determine winner of turn
@@ -142,89 +126,91 @@ void Colosseum::interact(std::set<std::string>& satchel, int& money, int& stepsS
 		{
 			if (computerMove == Move::SWORD)
 			{
-				std::cout << "You win this round!\n";
+				io.out() << "You win this round!\n";
 				computerStrengthPoints--;
 			}
 			else if (computerMove == Move::NET)
 			{
-				std::cout << "Your opponent wins this round.\n";
+				io.out() << "Your opponent wins this round.\n";
 				userStrengthPoints--;
 			}
 			else
 			{
-				std::cout << "This round is a draw.\n";
+				io.out() << "This round is a draw.\n";
 			}
 		}
 		else if (userMove == Move::NET)
 		{
 			if (computerMove == Move::SHIELD)
 			{
-				std::cout << "You win this round!\n";
+				io.out() << "You win this round!\n";
 				computerStrengthPoints--;
 			}
 			else if (computerMove == Move::SWORD)
 			{
-				std::cout << "Your opponent wins this round.\n";
+				io.out() << "Your opponent wins this round.\n";
 				userStrengthPoints--;
 			}
 			else
 			{
-				std::cout << "This round is a draw.\n";
+				io.out() << "This round is a draw.\n";
 			}
 		}
 		else if (userMove == Move::SWORD)
 		{
 			if (computerMove == Move::NET)
 			{
-				std::cout << "You win this round!\n";
+				io.out() << "You win this round!\n";
 				computerStrengthPoints--;
 			}
 			else if (computerMove == Move::SHIELD)
 			{
-				std::cout << "Your opponent wins this round.\n";
+				io.out() << "Your opponent wins this round.\n";
 				userStrengthPoints--;
 			}
 			else
 			{
-				std::cout << "This round is a draw.\n";
+				io.out() << "This round is a draw.\n";
 			}
 		}
-		pressEnter();
+		co_await io.pause();
 	}
 
 	// Determine final outcome of match
 	if (computerStrengthPoints == 0)
 	{
-		std::cout << "Congratulations, you win!\n";
-		bool computerDies = static_cast<bool>(getRandomInt(0, 1));
+		io.out() << "Congratulations, you win!\n";
+		bool computerDies = static_cast<bool>(rng.get_int(0, 1));
 		if (!computerDies)
 		{
-			std::cout << "The senator has ordered that you let your opponent live.\n";
+			io.out() << "The senator has ordered that you let your opponent live.\n";
 		}
 		else
 		{
-			std::cout << "The senator has ordered that you kill your opponent.\n";
+			io.out() << "The senator has ordered that you kill your opponent.\n";
 		}
 		
-		std::cout << "Here are 10 coins for your victory.\n";
-		money += 10;
+		io.out() << "Here are " << BATTLE_PRIZE << " coins for your victory.\n";
+		state.money += BATTLE_PRIZE;
+		io.event(EventType::BATTLE_FINISHED, 1);
 	}
 	
 	else if (userStrengthPoints == 0)
 	{
-		std::cout << "You have lost this match.\n";
-		bool userDies = static_cast<bool>(getRandomInt(0, 1));
+		io.out() << "You have lost this match.\n";
+		bool userDies = static_cast<bool>(rng.get_int(0, 1));
 		if (!userDies)
 		{
-			std::cout << "The senator has ordered your opponent to let you live.\n";
-			std::cout << "You haven’t won any money, but you leave with your life.\n";
+			io.out() << "The senator has ordered your opponent to let you live.\n";
+			io.out() << "You haven’t won any money, but you leave with your life.\n";
 		}
 		else
 		{
-			std::cout << "The senator has ordered your opponent to kill you.\n";
-			std::cout << "Thank you for your sacrifice for the entertainment of the Roman People.\n";
-			stillAlive = false;
+			io.out() << "The senator has ordered your opponent to kill you.\n";
+			io.out() << "Thank you for your sacrifice for the entertainment of the Roman People.\n";
+			state.stillAlive = false;
 		}
+		io.event(EventType::BATTLE_FINISHED, 0);
 	}
-	pressEnter();
+	co_await io.pause();
 }
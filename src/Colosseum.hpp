@@ -12,11 +12,10 @@
  * 		50% chance that they die and lose the entire game.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Enum class is included within the Colosseum's header file that
  *		defines Move data type (which names 3 different moves possible
@@ -26,7 +25,6 @@
  *		indicating the user's move choices.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -42,6 +40,9 @@
 // Enum class that defines 3 different moves possible in gladitorial battle system
 enum class Move{SHIELD, NET, SWORD};
 
+// Constant indicating the number of coins won for winning a battle
+const int BATTLE_PRIZE = 10;
+
 class Colosseum : public Space
 {
 	private:
@@ -50,7 +51,6 @@ class Colosseum : public Space
 	public:
 		Colosseum();
 		virtual ~Colosseum();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -0,0 +1,293 @@
+/***************************************************************************************************
+ * Program Name: Content.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Content class that holds all of the game's text content. The content is loaded
+ * 		once per process (from the archive embedded in the executable, from the packed
+ * 		asset archive file, or else from the text files) and shared, read-only, by every
+ * 		Game. Sections of each file and the parsed trivia questions are handed out as
+ * 		std::string_views into the loaded text (or the archive), so no strings are copied
+ * 		when the content is used.
+ **************************************************************************************************/
+#include "Content.hpp"
+#include <charconv>
+#include <fstream>
+#include <iterator>
+
+// Names of the text files, indexed by Asset
+const char* const ASSET_FILE_NAMES[NUM_ASSETS] = {"Game_Instructions.txt", "Board_Images.txt",
+	"Bibliotheca_Description.txt", "DomusAurea_Description.txt", "Ludus_Description.txt",
+	"CircusMaximus_Description.txt", "Forum_Description.txt", "Theatrum_Description.txt",
+	"Colosseum_Description.txt", "Thermae_Description.txt", "CampusMartius_Description.txt",
+	"Ludus_Questions.txt", "Thermae_Narration.txt", "Ending_Sequence.txt"};
+
+// Number of lines per trivia question in the questions file
+// (the question, the answer choices, and the number of the correct answer)
+const int LINES_PER_QUESTION = NUM_CHOICES + 2;
+
+
+/***************************************************************************************************
+ * Description: Function that receives an Asset and returns the name of the text file from which
+ * 		it is loaded.
+ ***************************************************************************************************/
+
+const char* asset_file_name(Asset asset)
+{
+	return ASSET_FILE_NAMES[static_cast<int>(asset)];
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives nothing and returns the process-wide Content. The
+ * 		Content is loaded the first time this function is called (the initialization of a
+ * 		function-local static is thread-safe, so concurrent first calls load it only once).
+ ***************************************************************************************************/
+
+const Content& Content::get()
+{
+	static const Content content(ContentSource::EMBEDDED);
+	return content;
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives the preferred ContentSource and returns a new
+ * 		Content, separate from the process-wide one, taken from that source (or the next
+ * 		available source after it). The asset compiler uses this to load the text files
+ * 		when building the archive.
+ ***************************************************************************************************/
+
+std::unique_ptr<const Content> Content::load(ContentSource preferredSource)
+{
+	return std::unique_ptr<const Content>(new Content(preferredSource));
+}
+
+
+/***************************************************************************************************
+ * Description: Private constructor that receives the preferred ContentSource. Takes the content
+ * 		from the embedded archive if it is preferred and was compiled in, or from the
+ * 		archive file if it is preferred (or the embedded archive is unavailable) and is
+ * 		present and valid. Otherwise, loads the content from the text files, throwing a
+ * 		std::runtime_error if one of them cannot be opened.
+ ***************************************************************************************************/
+
+Content::Content(ContentSource preferredSource)
+{
+#ifdef EMBED_ASSETS
+	if (preferredSource == ContentSource::EMBEDDED && archive.open_memory(EMBEDDED_ARCHIVE, EMBEDDED_ARCHIVE_SIZE))
+	{
+		contentSource = ContentSource::EMBEDDED;
+		load_archive();
+		return;
+	}
+#endif
+
+	if (preferredSource != ContentSource::TEXT_FILES && archive.open(ARCHIVE_FILE_NAME))
+	{
+		contentSource = ContentSource::ARCHIVE_FILE;
+		load_archive();
+	}
+	else
+	{
+		contentSource = ContentSource::TEXT_FILES;
+		load_text_files();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that takes the content from the opened archive, in which
+ * 		the sections are already split and the questions already parsed. Every view points
+ * 		into the archive, so no text is copied. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void Content::load_archive()
+{
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		const ArchiveAsset& entry = archive.asset(index);
+		assetText[index] = archive.view(entry.text);
+		for (std::uint32_t sectionNum = 0; sectionNum < entry.numSections; sectionNum++)
+		{
+			sectionViews[index].push_back(archive.view(archive.section(entry.firstSection + sectionNum)));
+		}
+	}
+
+	questionList.resize(NUM_QUESTIONS);
+	for (int questionNum = 0; questionNum < NUM_QUESTIONS; questionNum++)
+	{
+		const ArchiveQuestion& entry = archive.question(questionNum);
+		Question& q = questionList[questionNum];
+		q.questionText = archive.view(entry.questionText);
+		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
+		{
+			q.answerChoices[choiceNum] = archive.view(entry.answerChoices[choiceNum]);
+		}
+		q.answerNum = entry.answerNum;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that reads each text file into memory and splits it into
+ * 		sections at each delimination character. A section is created for each piece of
+ * 		text ending in a delimination character and for any text after the last one (the
+ * 		same pieces that reading the file with getline(..., DELIM) until it fails produces).
+ * 		Then parses the trivia questions. Receives and returns nothing, and throws a
+ * 		std::runtime_error naming the file if a text file cannot be opened or read (or the
+ * 		questions file is not valid, see parse_questions).
+ ***************************************************************************************************/
+
+void Content::load_text_files()
+{
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		// Read the whole file at once
+		std::ifstream inputFile(ASSET_FILE_NAMES[index], std::ios::binary);
+		if (!inputFile)
+		{
+			throw std::runtime_error(std::string("Could not open ") + ASSET_FILE_NAMES[index] +
+						 " (the game must be run from the directory holding its text files)");
+		}
+		text[index].assign(std::istreambuf_iterator<char>(inputFile), std::istreambuf_iterator<char>());
+		if (inputFile.bad())
+		{
+			throw std::runtime_error(std::string("Could not read ") + ASSET_FILE_NAMES[index]);
+		}
+		inputFile.close();
+		assetText[index] = text[index];
+
+		// Split the text into sections
+		std::string_view fileText = assetText[index];
+		size_t start = 0;
+		while (start < fileText.size())
+		{
+			size_t delim = fileText.find(DELIM, start);
+			if (delim == std::string_view::npos)
+			{
+				sectionViews[index].push_back(fileText.substr(start));
+				break;
+			}
+			sectionViews[index].push_back(fileText.substr(start, delim - start));
+			start = delim + 1;
+		}
+	}
+
+	parse_questions();
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that splits the trivia questions file into questions.
+ * 		Each question takes up LINES_PER_QUESTION lines: the question, each answer choice,
+ * 		and the number of the correct answer choice. Receives and returns nothing. Throws a
+ * 		std::runtime_error naming the file and the question if the file holds fewer than
+ * 		NUM_QUESTIONS questions (every position in a game's question order must refer to a
+ * 		question) or if the number of a question's correct answer choice is not a number
+ * 		from 1 to NUM_CHOICES.
+ ***************************************************************************************************/
+
+void Content::parse_questions()
+{
+	// Split the file into lines
+	std::string_view fileText = assetText[static_cast<int>(Asset::LUDUS_QUESTIONS)];
+	std::vector<std::string_view> lines;
+	size_t start = 0;
+	while (start < fileText.size())
+	{
+		size_t newline = fileText.find('\n', start);
+		if (newline == std::string_view::npos)
+		{
+			newline = fileText.size();
+		}
+		lines.push_back(fileText.substr(start, newline - start));
+		start = newline + 1;
+	}
+
+	// Build a question from each group of lines
+	questionList.resize(NUM_QUESTIONS);
+	for (int questionNum = 0; questionNum < NUM_QUESTIONS; questionNum++)
+	{
+		Question& q = questionList[questionNum];
+		std::string questionName = std::string(asset_file_name(Asset::LUDUS_QUESTIONS)) + " (question " +
+					   std::to_string(questionNum + 1) + " of " + std::to_string(NUM_QUESTIONS) + ")";
+
+		size_t firstLine = static_cast<size_t>(questionNum) * LINES_PER_QUESTION;
+		if (firstLine + LINES_PER_QUESTION > lines.size())
+		{
+			throw std::runtime_error("The questions end early in " + questionName);
+		}
+
+		q.questionText = lines[firstLine];
+		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
+		{
+			q.answerChoices[choiceNum] = lines[firstLine + 1 + choiceNum];
+		}
+		std::string_view answerLine = lines[firstLine + 1 + NUM_CHOICES];
+		std::from_chars_result result = std::from_chars(answerLine.data(), answerLine.data() + answerLine.size(), q.answerNum);
+		if (result.ec != std::errc() || result.ptr != answerLine.data() + answerLine.size() || q.answerNum < 1 ||
+		    q.answerNum > NUM_CHOICES)
+		{
+			throw std::runtime_error("The number of the correct answer is not a number from 1 to " +
+						 std::to_string(NUM_CHOICES) + " in " + questionName);
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the ContentSource from which the
+ * 		content was taken.
+ ***************************************************************************************************/
+
+ContentSource Content::source() const
+{
+	return this->contentSource;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives an Asset and returns the entire text of that asset.
+ ***************************************************************************************************/
+
+std::string_view Content::asset_text(Asset asset) const
+{
+	return this->assetText[static_cast<int>(asset)];
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives an Asset and returns the sections of that asset.
+ ***************************************************************************************************/
+
+const std::vector<std::string_view>& Content::sections(Asset asset) const
+{
+	return this->sectionViews[static_cast<int>(asset)];
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives an Asset and the index of a section. Returns that
+ * 		section of the asset (or an empty view if the asset has no such section).
+ ***************************************************************************************************/
+
+std::string_view Content::section(Asset asset, int index) const
+{
+	const std::vector<std::string_view>& assetSections = sections(asset);
+	if (index < 0 || index >= static_cast<int>(assetSections.size()))
+	{
+		return std::string_view();
+	}
+	return assetSections[index];
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the trivia questions (in the
+ * 		order in which they appear in the file).
+ ***************************************************************************************************/
+
+const std::vector<Question>& Content::questions() const
+{
+	return this->questionList;
+}
@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Program Name: Content.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Content class that holds all of the game's text content (instructions, board
+ * 		images, space descriptions, trivia questions, Thermae narration, and the ending
+ * 		sequence). The content is loaded once per process, the first time Content::get()
+ * 		is called, and is never changed afterwards. Every Game shares the same Content, so
+ * 		constructing a Game does no file I/O.
+ *
+ * 		The content is taken from the first of the following sources that is available:
+ * 		- The asset archive embedded in the executable (only in the embedded build mode,
+ * 		  "make embedded"), which needs no file I/O at all
+ * 		- The packed asset archive built by the asset compiler (Game_Assets.bin), if it is
+ * 		  present and valid, which is mapped into memory without reading or parsing any text
+ * 		  file
+ * 		- The text files, which are read and parsed. If a text file cannot be opened, a
+ * 		  std::runtime_error naming the file is thrown (the game used to carry on with an
+ * 		  empty description instead). The same is done, naming the question, if the trivia
+ * 		  questions file is cut short or a question's correct answer is not valid.
+ *
+ * 		Each text file is identified by an Asset. The text of each file is split into
+ * 		sections at the delimination character '#' (the same sections that reading the
+ * 		file with getline(..., DELIM) produces), and each section is handed out as a
+ * 		std::string_view into the loaded text. The trivia questions are parsed once into
+ * 		Question structs whose strings are also views into the loaded text.
+ *
+ * 		Private data members of the Content class include the following:
+ * 		- The AssetArchive from which the content was taken (if any)
+ * 		- An array holding the text of each asset read from a text file
+ * 		- An array holding a view of the text of each asset
+ * 		- An array holding the sections of each asset
+ * 		- A vector of Question structs
+ *
+ * 		Public member functions of the Content class include the following:
+ * 		- A static function that returns the process-wide Content (loading it if needed)
+ * 		- A static function that loads a separate Content from a given source or the next
+ * 		  available source after it (used by the asset compiler, which must only ever read
+ * 		  the text files, and to benchmark loading)
+ * 		- Accessors for the text of an asset, the sections of an asset, a single section of
+ * 		  an asset, and the trivia questions, and one returning the source of the content
+ *
+ * 		A private constructor loads the content, and private member functions take it from
+ * 		the archive or from the text files and split the trivia questions file into questions.
+ **************************************************************************************************/
+#ifndef CONTENT_HPP
+#define CONTENT_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "AssetArchive.hpp"
+#include "GameState.hpp"
+
+const char DELIM = '#';			// delimination character separating the sections of a text file
+const int NUM_CHOICES = 4;		// number of answer choices per trivia question
+
+// Enum class identifying each text file used by the game
+enum class Asset{GAME_INSTRUCTIONS, BOARD_IMAGES, BIBLIOTHECA_DESCRIPTION, DOMUS_AUREA_DESCRIPTION,
+		 LUDUS_DESCRIPTION, CIRCUS_MAXIMUS_DESCRIPTION, FORUM_DESCRIPTION, THEATRUM_DESCRIPTION,
+		 COLOSSEUM_DESCRIPTION, THERMAE_DESCRIPTION, CAMPUS_MARTIUS_DESCRIPTION, LUDUS_QUESTIONS,
+		 THERMAE_NARRATION, ENDING_SEQUENCE};
+const int NUM_ASSETS = 14;
+
+// Function that returns the name of the text file from which an asset is loaded
+const char* asset_file_name(Asset asset);
+
+// Enum class identifying where the content is taken from (in the order in which the
+// sources are tried, each one falling back to the sources listed before it)
+enum class ContentSource{TEXT_FILES, ARCHIVE_FILE, EMBEDDED};
+
+// Struct that defines a trivia Question: the text of the question, the text of its
+// answer choices, and an int indicating the number of the correct answer choice.
+struct Question
+{
+	std::string_view questionText;
+	std::string_view answerChoices[NUM_CHOICES];
+	int answerNum;
+};
+
+class Content
+{
+	private:
+		// Private data members
+		AssetArchive archive;
+		ContentSource contentSource;
+		std::string text[NUM_ASSETS];
+		std::string_view assetText[NUM_ASSETS];
+		std::vector<std::string_view> sectionViews[NUM_ASSETS];
+		std::vector<Question> questionList;
+
+		// Private member functions
+		Content(ContentSource preferredSource);
+		void load_archive();
+		void load_text_files();
+		void parse_questions();
+
+	public:
+		// Public member functions
+		static const Content& get();
+		static std::unique_ptr<const Content> load(ContentSource preferredSource);
+		ContentSource source() const;
+		std::string_view asset_text(Asset asset) const;
+		const std::vector<std::string_view>& sections(Asset asset) const;
+		std::string_view section(Asset asset, int index) const;
+		const std::vector<Question>& questions() const;
+
+		// The Content is shared, so it can never be copied
+		Content(const Content&) = delete;
+		Content& operator=(const Content&) = delete;
+};
+#endif
@@ -11,14 +11,12 @@
  * 		sequence is triggered by the Game class.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -31,12 +29,14 @@
 
 #include "Space.hpp"
 
+// Constant indicating the most steps the player can take after bathing and still be let in
+const int MAX_STEPS_SINCE_BATHING = 2;
+
 class DomusAurea : public Space
 {
 	public:
 		DomusAurea();
 		virtual ~DomusAurea();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -0,0 +1,425 @@
+/***************************************************************************************************
+ * Program Name: Expectimax.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Expectimax class that computes the exact probability of winning a game with the
+ * 		best play, remembering the value of every state in a hash table shared by several
+ * 		threads and kept from one evaluation to the next. See Expectimax.hpp.
+ **************************************************************************************************/
+#include "Expectimax.hpp"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Number of bits of a key used for the steps left (enough for MAX_STEPS)
+const int STEPS_LEFT_BITS = 7;
+static_assert(MAX_STEPS < (1 << STEPS_LEFT_BITS), "MAX_STEPS must fit in the steps left of a key");
+
+// Key of the empty slots of the hash table (never the key of a state, since keys leave the
+// highest bit unused)
+const std::uint64_t EMPTY_KEY = ~std::uint64_t(0);
+
+// Number of shards of the hash table (as a power of 2), each with its own lock
+const int SHARD_BITS = 8;
+
+// Fewest states a few turns ahead to share among each thread (so that the threads finish
+// at about the same time), and most turns ahead to look for them
+const std::size_t STATES_PER_THREAD = 64;
+const int MAX_LOOKAHEAD = 4;
+
+
+/***************************************************************************************************
+ * Description: Helper class holding the value of every state evaluated: a hash table split into
+ * 		shards (chosen by the highest bits of a key's hash), each an open-addressing table
+ * 		(with linear probing) with its own lock, doubled in size whenever it becomes half
+ * 		full. Any number of threads can look up and add values at the same time.
+ ***************************************************************************************************/
+
+class ValueTable
+{
+	private:
+		struct Slot
+		{
+			std::uint64_t key;
+			double value;
+		};
+		struct Shard
+		{
+			std::mutex lock;
+			std::vector<Slot> slots = std::vector<Slot>(1024, Slot{EMPTY_KEY, 0.0});
+			std::size_t count = 0;
+		};
+		std::vector<Shard> shards = std::vector<Shard>(1 << SHARD_BITS);
+
+		// Return the shard holding a key, and the slot holding it (or the empty slot where
+		// it belongs) in that shard
+		static Shard& shard_of(std::vector<Shard>& shards, std::uint64_t hash)
+		{
+			return shards[hash >> (64 - SHARD_BITS)];
+		}
+		static std::size_t find_slot(const std::vector<Slot>& slots, std::uint64_t key, std::uint64_t hash)
+		{
+			std::size_t mask = slots.size() - 1;
+			std::size_t index = hash & mask;
+			while (slots[index].key != key && slots[index].key != EMPTY_KEY)
+			{
+				index = (index + 1) & mask;
+			}
+			return index;
+		}
+
+	public:
+		// Look up the value of a key. Returns true (and stores the value in "value") if
+		// the key is in the table, or false if it is not.
+		bool find(std::uint64_t key, double& value)
+		{
+			std::uint64_t hash = hash_model_key(key);
+			Shard& shard = shard_of(shards, hash);
+			std::lock_guard<std::mutex> guard(shard.lock);
+			const Slot& slot = shard.slots[find_slot(shard.slots, key, hash)];
+			value = slot.value;
+			return slot.key == key;
+		}
+
+		// Add the value of a key (if another thread has already added the same key, the
+		// value, being computed the same way, is the same)
+		void insert(std::uint64_t key, double value)
+		{
+			std::uint64_t hash = hash_model_key(key);
+			Shard& shard = shard_of(shards, hash);
+			std::lock_guard<std::mutex> guard(shard.lock);
+			std::size_t index = find_slot(shard.slots, key, hash);
+			if (shard.slots[index].key == key)
+			{
+				return;
+			}
+
+			if (2 * (shard.count + 1) > shard.slots.size())
+			{
+				std::vector<Slot> oldSlots(shard.slots.size() * 2, Slot{EMPTY_KEY, 0.0});
+				oldSlots.swap(shard.slots);
+				for (const Slot& slot : oldSlots)
+				{
+					if (slot.key != EMPTY_KEY)
+					{
+						shard.slots[find_slot(shard.slots, slot.key, hash_model_key(slot.key))] = slot;
+					}
+				}
+				index = find_slot(shard.slots, key, hash);
+			}
+			shard.slots[index] = {key, value};
+			shard.count++;
+		}
+
+		// Return the number of values in the table
+		std::size_t size()
+		{
+			std::size_t total = 0;
+			for (Shard& shard : shards)
+			{
+				std::lock_guard<std::mutex> guard(shard.lock);
+				total += shard.count;
+			}
+			return total;
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Helper class that computes the values of states for one evaluation: it holds the
+ * 		GameModel of the game, the shared ValueTable, and the number of moves from every
+ * 		space to the nearest Domus Aurea, below which the value of a state is 0.
+ ***************************************************************************************************/
+
+class StateEvaluator
+{
+	private:
+		const GameMap& map;
+		const GameModel& model;
+		ValueTable& table;
+		const std::vector<std::uint32_t>& goalDistances;
+
+	public:
+		StateEvaluator(const GameMap& map, const GameModel& model, ValueTable& table, const std::vector<std::uint32_t>& goalDistances) :
+			map(map), model(model), table(table), goalDistances(goalDistances)
+		{
+		}
+
+		// Return the key of a state with a number of steps left
+		std::uint64_t key(const ModelState& state, int stepsLeft) const
+		{
+			return (static_cast<std::uint64_t>(stepsLeft) << model.packed_bits()) | model.pack(state);
+		}
+
+		// Return the value of an option: the expected value, over its outcomes, of the best
+		// move afterwards
+		double option_value(const ModelOption& option, std::uint32_t location, int stepsLeft)
+		{
+			if (stepsLeft == 0)
+			{
+				return 0.0;
+			}
+			double expected = 0.0;
+			std::uint8_t validMask = map.get_valid_mask(location);
+			for (int outcomeNum = 0; outcomeNum < option.numOutcomes; outcomeNum++)
+			{
+				const ModelOutcome& outcome = option.outcomes[outcomeNum];
+				if (outcome.dies)
+				{
+					continue;
+				}
+				double bestMove = 0.0;
+				for (int dirNum = 0; dirNum < NUM_DIRECTIONS && bestMove < 1.0; dirNum++)
+				{
+					if (validMask & (1 << dirNum))
+					{
+						double moveValue = value(model.move(outcome.after, static_cast<Direction>(dirNum)), stepsLeft - 1);
+						bestMove = (moveValue > bestMove) ? moveValue : bestMove;
+					}
+				}
+				expected += outcome.probability * bestMove;
+			}
+			return expected;
+		}
+
+		// Return the value of a state at the start of a turn with a number of steps left
+		double value(const ModelState& state, int stepsLeft)
+		{
+			if (model.wins_on_entering(state))
+			{
+				return 1.0;
+			}
+			if (goalDistances[state.location] > static_cast<std::uint32_t>(stepsLeft))
+			{
+				return 0.0;
+			}
+
+			std::uint64_t stateKey = key(state, stepsLeft);
+			double best = 0.0;
+			if (table.find(stateKey, best))
+			{
+				return best;
+			}
+
+			ModelOption options[MAX_OPTIONS];
+			int numOptions = model.list_options(state, options);
+			for (int optionNum = 0; optionNum < numOptions && best < 1.0; optionNum++)
+			{
+				double optionValue = option_value(options[optionNum], state.location, stepsLeft);
+				best = (optionValue > best) ? optionValue : best;
+			}
+			table.insert(stateKey, best);
+			return best;
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the map on which the games are played and the number of
+ * 		threads with which to evaluate them (0, the default, uses every hardware thread).
+ * 		Creates the empty table of values and finds the number of moves from every space to
+ * 		the nearest Domus Aurea with a breadth-first search from all of them at once.
+ ***************************************************************************************************/
+
+Expectimax::Expectimax(std::shared_ptr<const GameMap> map, int numThreads)
+{
+	this->map = std::move(map);
+	set_num_threads(numThreads);
+	this->table = std::make_shared<ValueTable>();
+
+	goalDistances.assign(this->map->num_spaces(), NO_SPACE);
+	std::vector<std::uint32_t> queue;
+	for (std::uint32_t location = 0; location < this->map->num_spaces(); location++)
+	{
+		if (this->map->get_type(location) == SpaceType::DOMUS_AUREA)
+		{
+			goalDistances[location] = 0;
+			queue.push_back(location);
+		}
+	}
+	for (std::size_t index = 0; index < queue.size(); index++)
+	{
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+		{
+			std::uint32_t neighbor = this->map->get_neighbor(queue[index], static_cast<Direction>(dirNum));
+			if (neighbor != NO_SPACE && goalDistances[neighbor] == NO_SPACE)
+			{
+				goalDistances[neighbor] = goalDistances[queue[index]] + 1;
+				queue.push_back(neighbor);
+			}
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Mutator method that receives the number of threads with which to evaluate games
+ * 		from now on (0 uses every hardware thread). Must not be called while another thread
+ * 		is evaluating a game. Returns nothing.
+ ***************************************************************************************************/
+
+void Expectimax::set_num_threads(int numThreads)
+{
+	if (numThreads <= 0)
+	{
+		numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	}
+	this->numThreads = numThreads;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn and the number of steps left.
+ * 		With more than one thread, finds the states a few turns ahead and has every thread
+ * 		compute their values. Then computes the value of each option on this turn. Returns
+ * 		the ExpectimaxResult: the probability of winning with the best play, the best option
+ * 		on this turn, and the number of states whose values are in the table. Throws
+ * 		std::runtime_error if the map is too large for the keys of the hash table.
+ ***************************************************************************************************/
+
+ExpectimaxResult Expectimax::evaluate(const GameState& state, int stepsLeft) const
+{
+	ExpectimaxResult result;
+	if (state.withNero)
+	{
+		result.winProbability = 1.0;
+		return result;
+	}
+	if (state.gameOver || !state.stillAlive || stepsLeft < 0)
+	{
+		return result;
+	}
+
+	GameModel model(map, state.expensiveChoice, state.cheapChoice);
+	if (model.packed_bits() + STEPS_LEFT_BITS >= 64)
+	{
+		throw std::runtime_error("The map is too large to be evaluated by the Expectimax engine");
+	}
+	StateEvaluator evaluator(*map, model, *table, goalDistances);
+	ModelState start = model.model_state(state);
+
+	// Find the distinct states a few turns ahead (enough for every thread to have many,
+	// and none at all with only one thread)
+	std::vector<std::pair<ModelState, int>> ahead = {{start, stepsLeft}};
+	ModelOption options[MAX_OPTIONS];
+	for (int turns = 0; numThreads > 1 && turns < MAX_LOOKAHEAD && ahead.size() < STATES_PER_THREAD * numThreads; turns++)
+	{
+		std::vector<std::pair<ModelState, int>> next;
+		std::unordered_set<std::uint64_t> seen;
+		for (const std::pair<ModelState, int>& entry : ahead)
+		{
+			if (entry.second == 0 || model.wins_on_entering(entry.first))
+			{
+				continue;
+			}
+			int numOptions = model.list_options(entry.first, options);
+			std::uint8_t validMask = map->get_valid_mask(entry.first.location);
+			for (int optionNum = 0; optionNum < numOptions; optionNum++)
+			{
+				for (int outcomeNum = 0; outcomeNum < options[optionNum].numOutcomes; outcomeNum++)
+				{
+					const ModelOutcome& outcome = options[optionNum].outcomes[outcomeNum];
+					for (int dirNum = 0; dirNum < NUM_DIRECTIONS && !outcome.dies; dirNum++)
+					{
+						if (!(validMask & (1 << dirNum)))
+						{
+							continue;
+						}
+						ModelState moved = model.move(outcome.after, static_cast<Direction>(dirNum));
+						if (seen.insert(evaluator.key(moved, entry.second - 1)).second)
+						{
+							next.push_back({moved, entry.second - 1});
+						}
+					}
+				}
+			}
+		}
+		ahead.swap(next);
+	}
+
+	// Share those states among the threads, all filling the same table
+	std::atomic<std::size_t> nextState(0);
+	auto work = [&]()
+	{
+		StateEvaluator threadEvaluator(*map, model, *table, goalDistances);
+		for (std::size_t index = nextState++; index < ahead.size(); index = nextState++)
+		{
+			threadEvaluator.value(ahead[index].first, ahead[index].second);
+		}
+	};
+	std::vector<std::thread> threads;
+	for (int threadNum = 1; threadNum < numThreads; threadNum++)
+	{
+		threads.emplace_back(work);
+	}
+	if (numThreads > 1)
+	{
+		work();
+	}
+	for (std::thread& worker : threads)
+	{
+		worker.join();
+	}
+
+	// Compute the value of each option on this turn from the values in the table
+	if (model.wins_on_entering(start))
+	{
+		result.winProbability = 1.0;
+		result.action = TurnAction::ENTER;
+	}
+	else
+	{
+		int numOptions = model.list_options(start, options);
+		for (int optionNum = 0; optionNum < numOptions; optionNum++)
+		{
+			double optionValue = evaluator.option_value(options[optionNum], start.location, stepsLeft);
+			if (optionValue > result.winProbability)
+			{
+				result.winProbability = optionValue;
+				result.action = options[optionNum].action;
+				result.items = options[optionNum].items;
+				result.bet = options[optionNum].bet;
+			}
+		}
+	}
+	result.statesEvaluated = table->size();
+	return result;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn. Returns the ExpectimaxResult
+ * 		with the steps the player has left before reaching MAX_STEPS (see above).
+ ***************************************************************************************************/
+
+ExpectimaxResult Expectimax::evaluate(const GameState& state) const
+{
+	return evaluate(state, MAX_STEPS - state.stepsTaken);
+}
+
+
+
+/***************************************************************************************************
+ * Description: Receives the GameModel of a game, a ModelState at the start of a turn, and the
+ * 		number of steps left. Computes the value of the state on the calling thread, using
+ * 		and filling the table. Returns the probability of winning from the state with the
+ * 		best play. Throws std::runtime_error if the map is too large for the keys of the
+ * 		hash table.
+ ***************************************************************************************************/
+
+double Expectimax::value(const GameModel& model, const ModelState& state, int stepsLeft) const
+{
+	if (model.packed_bits() + STEPS_LEFT_BITS >= 64)
+	{
+		throw std::runtime_error("The map is too large to be evaluated by the Expectimax engine");
+	}
+	if (stepsLeft < 0)
+	{
+		return 0.0;
+	}
+	StateEvaluator evaluator(*map, model, *table, goalDistances);
+	return evaluator.value(state, stepsLeft);
+}
@@ -0,0 +1,92 @@
+/***************************************************************************************************
+ * Program Name: Expectimax.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Expectimax class that computes the exact probability of winning a game within
+ * 		MAX_STEPS from any point in the game, when the player plays as well as possible
+ * 		(choosing, on every turn, what to do at the space and where to move so as to make
+ * 		winning as likely as possible), and the best thing to do on the current turn. This
+ * 		gives the chance of winning directly, instead of estimating it from many games.
+ *
+ * 		The engine plays by the rules described by the GameModel (see GameModel.hpp), with
+ * 		every random outcome (the student's answers at the Ludus, the opponent's moves and
+ * 		the senator's verdict at the Colosseum, the winner of the chariot race) weighted by
+ * 		its probability. The value of a state at the start of a turn with a given number of
+ * 		steps left is 1 if entering the space wins the game, and otherwise the highest, over
+ * 		the options on the turn, of the expected value (over the option's outcomes) of the
+ * 		best move afterwards, with one step fewer left. Dying, or having no steps left after
+ * 		the turn, is worth 0, as is any state from which no Domus Aurea can be reached in the
+ * 		steps left.
+ *
+ * 		The value of every state reached is remembered in a hash table keyed by the packed
+ * 		ModelState and the steps left, so that each is computed only once. The table is
+ * 		split into shards, each with its own lock, so that many threads can use it at once.
+ * 		The states a few turns ahead of the state being evaluated are shared among the
+ * 		threads, each of which computes their values (filling the shared table), and the
+ * 		value of the state itself is then computed from them.
+ *
+ * 		The table is kept for the life of the Expectimax object, so later evaluations (of
+ * 		any game on the same map, since packed ModelStates do not depend on the items the
+ * 		prefect wants) reuse every value already computed. Once the start of a game has
+ * 		been evaluated, evaluating any state reached in it is a few lookups, which is what
+ * 		lets a player (such as the optimal policy of the simulator) ask the engine what to
+ * 		do on every turn. An Expectimax object may be used by many threads at once.
+ *
+ *		Private data members of the Expectimax class include:
+ *		- The map on which the games are played
+ *		- The number of threads to use
+ *		- The table of the values of the states evaluated so far
+ *		- The number of moves from every space to the nearest Domus Aurea
+ *
+ *		Public member functions of the Expectimax class include:
+ *		- A constructor that receives the map and (optionally) the number of threads
+ *		- A mutator method for the number of threads (for example, to evaluate the start
+ *		  of a game with every thread and then every turn of it with only one)
+ *		- Functions that evaluate a game from a given state (with a given number of steps
+ *		  left, or with the steps left before MAX_STEPS)
+ *		- A function that returns the value of a ModelState at the start of a turn (for
+ *		  programs that walk through the states of the model themselves, such as the hint
+ *		  compiler)
+ *
+ *		The ExpectimaxResult struct is also declared in this header file.
+ **************************************************************************************************/
+#ifndef EXPECTIMAX_HPP
+#define EXPECTIMAX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Game.hpp"
+#include "GameModel.hpp"
+
+// Hash table of the values of states (defined in Expectimax.cpp)
+class ValueTable;
+
+// Struct describing the result of evaluating a game
+struct ExpectimaxResult
+{
+	double winProbability = 0.0;				// chance of winning with the best play
+	TurnAction action = TurnAction::KEEP_MOVING;		// the best thing to do on this turn
+	Satchel items;						// the items bought or donated (BUY and DONATE)
+	int bet = 0;						// the coins bet (at the Circus Maximus)
+	std::size_t statesEvaluated = 0;			// number of states whose values are known
+};
+
+class Expectimax
+{
+	private:
+		// Private data members
+		std::shared_ptr<const GameMap> map;
+		int numThreads;
+		std::shared_ptr<ValueTable> table;
+		std::vector<std::uint32_t> goalDistances;
+
+	public:
+		// Public member functions
+		Expectimax(std::shared_ptr<const GameMap> map, int numThreads = 0);
+		void set_num_threads(int numThreads);
+		ExpectimaxResult evaluate(const GameState& state, int stepsLeft) const;
+		ExpectimaxResult evaluate(const GameState& state) const;
+		double value(const GameModel& model, const ModelState& state, int stepsLeft) const;
+};
+#endif
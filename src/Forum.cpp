@@ -8,14 +8,13 @@
  * 		by the soldier in the Campus Martius (one exensive item and one cheap item).
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Item struct is declared as a private member of Forum class.
- *		The Item struct keeps track of the name and price of each item.
+ *		The Item struct keeps track of the ID and price of each item.
  *
  *		Private data members include the following:
  *		- A vector of items that contains all goods for sale
@@ -23,7 +22,6 @@
  *		  to create a purchase menu
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -40,19 +38,16 @@
  * Description: Default constructor for Forum object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  *
  * 		Forum constructor also initializes private data members (vectors),
  * 		calling private make_purchase_menu() function for
  * 		assistance with making the menu.
  ***************************************************************************************************/
 
-Forum::Forum() : Space("Forum", 5, "Forum_Description.txt")
+Forum::Forum() : Space("Forum", 5, Asset::FORUM_DESCRIPTION)
 {
 	// Initialize 6 different items for purchase
 	Item good1(OLIVE_OIL, EXPENSIVE_PRICE);
@@ -87,7 +82,7 @@ void Forum::make_purchase_menu()
 	for (int index = 0; index < 6; index++)
 	{
 		// Get the item's name
-		std::string menuChoice = goodsForSale[index].itemName;
+		std::string menuChoice = item_name(goodsForSale[index].item);
 		
 		// Add the item's price (converted from int to string) to its menu choice
 		menuChoice += " (" + std::to_string(goodsForSale[index].price) + " coins)";
@@ -114,25 +109,15 @@ Forum::~Forum()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		# - a set of strings indicating the items in the player's satchel #
- *		# - an int indicating how much money the player has #
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		  - a bool indicating whether or not the player is still alive
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- satchel: the items in the player's satchel
+ *		- money: how much money the player has
  *
  *		The Forum's implementation of this function does the following:
  *		- Allows the user to purchase items if they have enough money
@@ -141,15 +126,14 @@ Forum::~Forum()
  *		- User can buy multiple items in one stop. They must choose to exit the Forum.
  ***************************************************************************************************/
 
-void Forum::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> Forum::interact(GameIO& io, GameState& state, [[maybe_unused]] Random& rng)
 {	
 	int purchaseChoiceNum = 0;
 	do
  	{
 		// Ask the user what they would like to buy
-		std::cout << "What would you like to buy?\n";
-		purchaseChoiceNum = menu(purchaseMenu);
+		io.out() << "What would you like to buy?\n";
+		purchaseChoiceNum = co_await io.choose(Prompt::PURCHASE, purchaseMenu);
  		
 		// If the user has not chosen to exit, process their purchase choice
 		if (purchaseChoiceNum != 7)
@@ -157,46 +141,46 @@ void Forum::interact(std::set<std::string>& satchel, int& money, int& stepsSince
 			// Determine the index of the item in the goodsForSale vector
 			int itemNum = (purchaseChoiceNum-1);
 			
-			// Determine the name and cost of the item
-			std::string itemName = goodsForSale[itemNum].itemName;
+			// Determine the ID and cost of the item
+			ItemId item = goodsForSale[itemNum].item;
 			int price = goodsForSale[itemNum].price;
  			
 			// If the user's satchel has reached max capacity, inform them
-			if (satchel.size() == SATCHEL_CAPACITY)
+			if (state.satchel.full())
 			{
-				std::cout << "I’m sorry, but your satchel is at max capacity.\n";
-				std::cout << "Please go to the theater. They are taking collections for a local orphanage\n";
-				std::cout << "Once you have freed up room in your satchel, please come back here.\n";
+				io.out() << "I’m sorry, but your satchel is at max capacity.\n";
+				io.out() << "Please go to the theater. They are taking collections for a local orphanage\n";
+				io.out() << "Once you have freed up room in your satchel, please come back here.\n";
 			}
 			
 			// Otherwise, if the user already has the requested item, inform them that they cannot buy the item
 			// again until they have gotten rid of the first of that item.
-			else if (satchel.find(itemName) != satchel.end())
+			else if (state.satchel.contains(item))
 			{
-				std::cout << "You already have this item. Please come back when you need more of this item,\n"; 
-				std::cout << "or choose a different item.\n";
+				io.out() << "You already have this item. Please come back when you need more of this item,\n"; 
+				io.out() << "or choose a different item.\n";
 			}
 
 			// Otherwise, if the user does not have enough money to purchase they item,
 			// inform them.
-			else if (money < price)
+			else if (state.money < price)
 			{
-				std::cout << "You do not have enough money to purchase this item.\n";
-				std::cout << "Please choose a different item or come back later.\n";
+				io.out() << "You do not have enough money to purchase this item.\n";
+				io.out() << "Please choose a different item or come back later.\n";
 			}
 			
 			// Otherwise, the user can purchase the item. Add the item to their satchel
 			// and deduct its cost from their money.
 			else
 			{
-				std::cout << "Here is your " << itemName << "!\n";
-				satchel.insert(itemName);
-				money -= price;
+				io.out() << "Here is your " << item_name(item) << "!\n";
+				state.satchel.insert(item);
+				state.money -= price;
 			}
 		} 
-		std::cout << std::endl;
+		io.out() << std::endl;
 	} while (purchaseChoiceNum != 7);
 	
-	std::cout << "Have a great day!\n";
-	pressEnter();
+	io.out() << "Have a great day!\n";
+	co_await io.pause();
 }
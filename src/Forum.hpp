@@ -8,14 +8,13 @@
  * 		by the soldier in the Campus Martius (one exensive item and one cheap item).
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
  *		Item struct is declared as a private member of Forum class.
- *		The Item struct keeps track of the name and price of each item.
+ *		The Item struct keeps track of the ID and price of each item.
  *
  *		Private data members include the following:
  *		- A vector of items that contains all goods for sale
@@ -23,7 +22,6 @@
  *		  to create a purchase menu
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -49,16 +47,16 @@ class Forum : public Space
 		// Struct that is private member of Forum class
 		struct Item
 		{	
-			// Data members of struct include string for item's name and
+			// Data members of struct include the item's ID and
 			// int for item's price
-			std::string itemName;
+			ItemId item;
 			int price;
 
 			// Constructor initializes data members of item
 			// to values of received parameters
-			Item(std::string itemName, int price)
+			Item(ItemId item, int price)
 			{	
-				this->itemName = itemName;
+				this->item = item;
 				this->price = price;
 			}
 		};
@@ -74,7 +72,6 @@ class Forum : public Space
 		// Public member functions
 		Forum();
 		virtual ~Forum();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
@@ -6,158 +6,203 @@
  * 		an individual game of the Ancient Rome-themed board game.
  *
  * 		Private data members include the following:
+ * 		- A reference to the GameIO object through which all input and output is performed
+ * 		- The seed of the game and the Random number generator created from it, from which
+ * 		  every random outcome of the game is drawn (so a game can be reproduced from its
+ * 		  seed and the player's choices)
  * 		- A Board object representing the game's board
- * 		- A set of strings representing the items the player is carrying in their satchel
- * 		- An integer representing how many coins (in-game currency) the user has
- * 		- An integer representing the number of steps the player has taken since the start 
- * 		  of the game
- * 		- An integer representing the number of steps the player has taken since bathing
- * 		- A bool representing whether or not the player has bathed at the Thermae space
- * 		- A bool indicating whether or not the player knows about the scroll
- * 		  that the librarian wants the school teacher to return
- * 		- A bool indicating whether or not the player is still alive
- * 		- A bool indicating whether or not the player is with Nero (tiggers winning ending 
- * 		  sequence when its value is true)
- * 		- A bool indicating whether or not the game is over (set to true when the
- * 		  player wins, dies, or runs out of time steps; accessor method
- * 		  allows outside functions to check whether or not the game is over)
+ * 		- A GameState holding everything that can change during the game, including the
+ * 		  player's location, satchel, coins (in-game currency), steps taken, bathing status,
+ * 		  whether or not they know about the scroll, are still alive, or are with Nero (which
+ * 		  triggers the winning ending sequence), whether or not the game is over (set to true
+ * 		  when the player wins, dies, or runs out of time steps), and the state of each space
  *		
  *		Public member functions include the following:
- *		- A constructor
+ *		- Constructors that receive the GameIO object to use and (optionally) the game's seed
+ *		  and the GameMap on which it is played
+ *		- An accessor function that returns the game's seed
  *		- A function that executs a turn in the game
  *		- An accessor function that returns a bool to indicate whether or not the game is 
  *		  over
+ *		- Functions that take a snapshot of the game's state and restore the game to a
+ *		  snapshot (a snapshot is a copy of the GameState, so both take constant time)
+ *		- Accessor and mutator functions for the state of the Random number generator
+ *		  (together with a snapshot, these allow a turn to be played again exactly)
+ *		- A mutator function that sets the table of hints (see HintTable.hpp), after which
+ *		  the menus of each turn offer the player a hint
  *
  *		Private member functions include the following:
+ *		- A function that prints the status line, satchel contents, and board image
+ *		- A function that prints a hint of what to do at the current space
  *		- A function that prints the current contents of the player's satchel
  *		  (or a message indicating that the satchel is empty)
+ *		- A function that moves the player and counts the step
+ *		- A function that ends the game when the player runs out of steps
  *		- A function that reads in and displays the end-of-game messages and text-based
  *		  images from a text file that are displayed when the player wins the game
  *		  (by gaining access to Nero at the Domus Aurea)
  ***************************************************************************************************/
 #include "Game.hpp"
+#include <stdexcept>
+#include "HintTable.hpp"
 
 
 /***************************************************************************************************** 
- * Description: Default constructor that initializes the data members of the Game.
- * 		
- * 		The Board is not explicitly initialized in the constructor
- * 		because it is initialized by its default constructor
- * 		when a Game object is instantiated.
+ * Description: Constructor that receives the GameIO object through which the game performs all
+ * 		input and output. The game is given an unpredictable seed (see the constructor
+ * 		below), so every game played this way is different.
+ ****************************************************************************************************/
+
+Game::Game(GameIO& io) : Game(io, Random::random_seed())
+{
+}
+
+
+/***************************************************************************************************** 
+ * Description: Constructor that receives the GameIO object through which the game performs all
+ * 		input and output and the seed of the game, and initializes the data members of
+ * 		the Game. The Random number generator is created from the seed, so two games with
+ * 		the same seed in which the player makes the same choices play out identically.
+ * 		The game is played on the map of Rome (see the constructor below).
+ ****************************************************************************************************/
+
+Game::Game(GameIO& io, std::uint64_t seed) : Game(io, seed, GameMap::rome())
+{
+}
+
+
+/***************************************************************************************************** 
+ * Description: Constructor that receives the GameIO object through which the game performs all
+ * 		input and output, the seed of the game, and the GameMap on which the game is played
+ * 		(shared with any other games using it), and initializes the data members of the
+ * 		Game. The Board is created with the map received.
  *
- * 		The player's satchel starts out empty, so no strings are added to the set in this
- * 		constructor.
+ * 		The state is set to the state at the start of a new game (see new_game_state), with
+ * 		the player at the start of the map.
+ ****************************************************************************************************/
+
+Game::Game(GameIO& io, std::uint64_t seed, std::shared_ptr<const GameMap> map) :
+	io(io), seed(seed), rng(seed), gameBoard(std::move(map))
+{
+	state = new_game_state(rng);
+	state.location = gameBoard.get_map().get_start();
+}
+
+
+/*************************************************************************************************** 
+ * Description: Function that executes a turn in the game with a GameIO that answers every prompt
+ * 		right away (such as TerminalIO or HeadlessIO), returning once the turn is over.
+ * 		Runs play_turn (below), which is never suspended with such a GameIO. Receives and
+ * 		returns nothing.
  ****************************************************************************************************/
 
-Game::Game()
+void Game::take_turn()
 {
-	money = 0;
-	stepsTaken = 0;
-	stepsSinceBathing = 0;
-	hasBathed = false;
-	knowsAboutScroll = false;
-	stillAlive = true;
-	withNero = false;
-	gameOver = false;
+	Task<void> turn = play_turn();
+	turn.start();
+	if (!turn.done())
+	{
+		throw std::logic_error("Game::take_turn needs a GameIO that answers right away; use play_turn");
+	}
+	turn.get();
 }
 
 
 /*************************************************************************************************** 
- * Description: Function that executes a turn in the game. First, the user is asked
+ * Description: Coroutine that executes a turn in the game. First, the user is asked
  * 		if they would like to "enter" the space at which they are currently
  * 		located (if they choose yes, the space's "interact" function is called).
  * 		After the user is done with the interaction (or if they choose not
  * 		to enter the space), it is determined whether or not the game is over (based
  * 		on whether or not the player is still alive, whether they have steps remaining, and
- * 		whether or not they are with Nero and have therefore won the game). Receives and
- * 		returns nothing.
+ * 		whether or not they are with Nero and have therefore won the game). Receives
+ * 		nothing and returns a Task that finishes when the turn is over (the Task is
+ * 		suspended whenever the GameIO must wait for the player's answer).
  ****************************************************************************************************/
 
-void Game::take_turn()
+Task<void> Game::play_turn()
 {	
 	// Determine the user's current space and save in a pointer variable to be referred to again
 	// throughout this function
-	Space* currentSpace = gameBoard.get_player_location();
+	Space* currentSpace = gameBoard.get_space(state.location);
+	io.event(EventType::TURN_STARTED, state.stepsTaken);
 		
 	// Clear the screen for the new turn. At the top of the new screen,
 	// print steps taken of steps allowed, number of coins, satchel contents, and the board image indicating
 	// where the player is located.
-	std::system("clear");
-	std::cout << "\tSteps Taken: " << stepsTaken << " of " << MAX_STEPS;
-	std::cout << "\tCoins: " << money;
-	std::cout << "\tCurrent Space: " << currentSpace->get_name() << std::endl << std::endl;
-	print_satchel_contents();
-	gameBoard.print_board();
+	io.clear_screen();
+	print_status(currentSpace);
 
 	// Display the description of the space at which the player is located
-	std::cout << "Space Description: " << currentSpace->get_description();
+	io.out() << "Space Description: " << currentSpace->get_description();
 	
 	// Determine whether the user wants to enter (i.e. interact with) the current space
-	// or keep moving.
-	std::string enterSpace = "Enter " + currentSpace->get_name();
-	std::vector<std::string> enterMenu = {enterSpace, "Keep moving"};
-	int enterChoice = menu(enterMenu);
+	// or keep moving. If there is a table of hints, the user can also ask for a hint (as
+	// often as they like) before choosing. The menu was built when the board was created.
+	MenuChoices enterMenu = gameBoard.get_enter_menu(state.location);
+	int enterChoice = co_await io.choose(Prompt::ENTER_SPACE, enterMenu);
+	while (enterChoice == 3)
+	{
+		print_hint(currentSpace);
+		enterChoice = co_await io.choose(Prompt::ENTER_SPACE, enterMenu);
+	}
 
 	// If the user has chosen to enter the space, call the space's "interact" function,
-	// and process any outcomes based on changed values of reference variables
+	// and process any outcomes based on changed values in the state
 	if (enterChoice == 1)
 	{
 		// Clear screen, print the space name, the number of coins the user has, and the satchel contents
-		std::system("clear");
-		std::cout << "\t\tCurrent Space: " << currentSpace->get_name();
-		std::cout << "\t\tCoins: " << money << std::endl << std::endl;
+		io.clear_screen();
+		io.out() << "\t\tCurrent Space: " << currentSpace->get_name();
+		io.out() << "\t\tCoins: " << state.money << std::endl << std::endl;
 		print_satchel_contents();
-		std::cout << std::endl << std::endl;
+		io.out() << std::endl << std::endl;
+
+		// Remember the money and satchel contents before the interaction so that
+		// any changes can be reported as events afterwards
+		io.event(EventType::SPACE_ENTERED, state.location + 1);
+		int moneyBefore = state.money;
+		Satchel satchelBefore = state.satchel;
 
 		// Call the current space's interact function
-		currentSpace->interact(satchel, money, stepsSinceBathing, hasBathed, knowsAboutScroll, stillAlive, withNero);
+		co_await currentSpace->interact(io, state, rng);
 		
+		if (state.money != moneyBefore)
+		{
+			io.event(EventType::MONEY_CHANGED, state.money - moneyBefore);
+		}
+		if (state.satchel != satchelBefore)
+		{
+			io.event(EventType::SATCHEL_CHANGED, state.satchel.size());
+		}
+
 		// If the user is with Nero after interacting with this space,
 		// they have won the game. Call ending_sequence to print the ending.
-		if (withNero)
+		if (state.withNero)
 		{
-			ending_sequence();
+			io.event(EventType::WON, state.stepsTaken);
+			co_await ending_sequence();
 		}
 
 		// Otherwise, test to see if the player is still alive (if they are with Nero in the condition above,
 		// then they are definitely alive).
-		else if (stillAlive)
+		else if (state.stillAlive)
 		{
 			// If the player has taken the maximum number of steps and is not with Nero (i.e. they have not won
-			// the game in the last turn allowed), set gameOver to true and print
-			// a corresponding message
-			if (stepsTaken == MAX_STEPS)
+			// the game in the last turn allowed), end the game.
+			if (state.stepsTaken == MAX_STEPS)
 			{
-				std::cout << "You have reached the maximum number of steps, and you are not with Nero.\n"; 
-				std::cout << "We are now going to bring you back to the present since we don’t want you alone\n";
-				std::cout << "in the city of Rome without the emperor’s protection at night.\n";
-				
-				gameOver = true;
-				pressEnter();
+				co_await out_of_steps();
 			}
 			
 			// Otherwise, if the user has not reached the maximum number of steps,
-			// call the move function so they can move to a new space.
+			// clear the screen and print the same info as at the beginning of the turn
+			// before having the player move to a new space.
 			else
 			{
-				// clear screen and print same info as at beginning of turn before having player move
-				
-				std::system("clear");
-				std::cout << "\tSteps Taken: " << stepsTaken << " of " << MAX_STEPS;
-				std::cout << "\tCoins: " << money;
-				std::cout << "\tCurrent Space: " << currentSpace->get_name() << std::endl << std::endl;
-				print_satchel_contents();
-				gameBoard.print_board();
-				
-				// Call the board's move function, and increment the number of steps taken
-				gameBoard.move();
-				stepsTaken++;
-				
-				// If the player has bathed, increment the stepsSinceBathing variable
-				if (hasBathed)
-				{
-					stepsSinceBathing++;
-				}
+				io.clear_screen();
+				print_status(currentSpace);
+				co_await move_player();
 			}
 		}
 		
@@ -166,7 +211,8 @@ void Game::take_turn()
 		// printed in the interact function in which the player died.
 		else
 		{
-			gameOver = true;
+			io.event(EventType::DIED);
+			state.gameOver = true;
 		}
 	}
 
@@ -175,46 +221,37 @@ void Game::take_turn()
 	// and end the game. If it is not, allow them to move to a new space.
 	else if (enterChoice == 2)
 	{
-		// If the player has taken the maximum number of steps and is not with Nero (i.e. they have not won
-		// the game in the last turn allowed), set gameOver to true and print
-		// a corresponding message
-		if (stepsTaken == MAX_STEPS)
+		if (state.stepsTaken == MAX_STEPS)
 		{
-			std::cout << "You have reached the maximum number of steps, and you are not with Nero.\n"; 
-			std::cout << "We are now going to bring you back to the present since we don’t want you alone\n";
-			std::cout << "in the city of Rome without the emperor’s protection at night.\n";
-				
-			gameOver = true;
-			pressEnter();
+			co_await out_of_steps();
 		}
-			
-		// Otherwise, if the user has not reached the maximum number of steps,
-		// call the move function so they can move to a new space.
 		else
 		{
-			// clear screen and print same info as at beginning of turn before having player move
-				
-			std::system("clear");
-			std::cout << "\tSteps Taken: " << stepsTaken << " of " << MAX_STEPS;
-			std::cout << "\tCoins: " << money;
-			std::cout << "\tCurrent Space: " << currentSpace->get_name() << std::endl << std::endl;
-			print_satchel_contents();
-			gameBoard.print_board();
-				
-			// Call the board's move function, and increment the number of steps taken
-			gameBoard.move();
-			stepsTaken++;
-				
-			// If the player has bathed, increment the stepsSinceBathing variable
-			if (hasBathed)
-			{
-				stepsSinceBathing++;
-			}
+			io.clear_screen();
+			print_status(currentSpace);
+			co_await move_player();
 		}
 	}
 }
 
 
+/*************************************************************************************************** 
+ * Description: Private member function that prints the steps taken of steps allowed, the number
+ * 		of coins, the name of the current space, the satchel contents, and the board image
+ * 		indicating where the player is located. Receives a pointer to the player's current
+ * 		space and returns nothing.
+ ****************************************************************************************************/
+
+void Game::print_status(Space* currentSpace)
+{
+	io.out() << "\tSteps Taken: " << static_cast<int>(state.stepsTaken) << " of " << MAX_STEPS;
+	io.out() << "\tCoins: " << state.money;
+	io.out() << "\tCurrent Space: " << currentSpace->get_name() << std::endl << std::endl;
+	print_satchel_contents();
+	gameBoard.print_board(io, state.location);
+}
+
+
 /*************************************************************************************************** 
  * Description: Private member function that prints the contents of the player's satchel.
  * 		Receives and returns nothing.
@@ -223,62 +260,154 @@ void Game::take_turn()
 void Game::print_satchel_contents()
 {
 	// If the satchel is empty, inform the user
-	if (satchel.empty())
+	if (state.satchel.empty())
 	{
-		std::cout << "Your satchel is currently empty";
+		io.out() << "Your satchel is currently empty";
 	}
 
-	// Otherwise, print the current contents of the satchel
+	// Otherwise, print the current contents of the satchel.
+	// Item IDs are only converted to names here, when they are displayed.
 	else
 	{
-		std::set<std::string>::iterator iter;
-		std::cout << "Satchel Contents: ";
-		for (iter = satchel.begin(); iter != satchel.end(); iter++)
+		io.out() << "Satchel Contents: ";
+		int itemsPrinted = 0;
+		for (ItemId item = 0; item < NUM_ITEMS; item++)
 		{
-			// Print the name of the item to which the iterator points
-			std::cout << *iter;
-			
-			// Print a comma after the item name if it is not the last item in the satchel.
-			// Test to see if this is the last element by incrementing iter,
-			// seeing if it equals satchel.end(), and then decrementing it to get it back to current value.
-			iter++;
-			if (iter != satchel.end())
+			if (state.satchel.contains(item))
 			{
-				std::cout << ", ";
+				// Print a comma before the item name if it is not the first item printed
+				if (itemsPrinted > 0)
+				{
+					io.out() << ", ";
+				}
+				io.out() << item_name(item);
+				itemsPrinted++;
 			}
-			iter--;
 		}
 	}
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function called when the player has been received by Nero. Prints
- * 		a series of messages and text-based images as the ending to the game.
- * 		Receives and returns nothing.
+ * Description: Private member function that receives the Space at the player's location and prints
+ * 		a hint of what to do there: the best option on this turn, looked up in the board's
+ * 		table of hints (whether to enter the space, and the items to buy or donate or the
+ * 		coins to bet), or that there is no hint. Returns nothing.
+ ****************************************************************************************************/
+
+void Game::print_hint(Space* currentSpace)
+{
+	ModelOption option;
+	if (!gameBoard.get_hints()->best_option(state, option))
+	{
+		io.out() << "Hint: there is no hint here (you may no longer be able to reach Nero in the steps you have left).\n";
+		return;
+	}
+	if (option.action == TurnAction::KEEP_MOVING)
+	{
+		io.out() << "Hint: keep moving.\n";
+		return;
+	}
+
+	io.out() << "Hint: enter the " << currentSpace->get_name();
+	if (option.action == TurnAction::BUY || option.action == TurnAction::DONATE)
+	{
+		io.out() << ((option.action == TurnAction::BUY) ? " and buy " : " and donate ");
+		int itemsPrinted = 0;
+		for (ItemId item = 0; item < NUM_ITEMS; item++)
+		{
+			if (option.items.contains(item))
+			{
+				io.out() << (itemsPrinted > 0 ? " and " : "") << item_name(item);
+				itemsPrinted++;
+			}
+		}
+	}
+	else if (option.action == TurnAction::BATHE)
+	{
+		io.out() << " and bathe";
+	}
+	if (option.bet > 0)
+	{
+		io.out() << " and bet " << option.bet << " coins";
+	}
+	io.out() << ".\n";
+}
+
+
+/*************************************************************************************************** 
+ * Description: Private member coroutine that awaits the board's move coroutine, increments the
+ * 		number of steps taken, and (if the player has bathed) increments the number of
+ * 		steps taken since bathing. Receives and returns nothing.
  ****************************************************************************************************/
 
-void Game::ending_sequence()
+Task<void> Game::move_player()
 {
-	std::system("clear");
+	co_await gameBoard.move(io, state);
+	state.stepsTaken++;
+	io.event(EventType::MOVED, state.location + 1);
+				
+	// If the player has bathed, increment the stepsSinceBathing variable
+	if (state.hasBathed)
+	{
+		state.stepsSinceBathing++;
+	}
+}
+
+
+/*************************************************************************************************** 
+ * Description: Private member coroutine called when the player has taken the maximum number of
+ * 		steps without being received by Nero. Prints a message and sets gameOver to true.
+ * 		Receives and returns nothing.
+ ****************************************************************************************************/
 
-	// Read in the ending sequence from text file
-	std::ifstream inputFile("Ending_Sequence.txt");
-	std::string text;
+Task<void> Game::out_of_steps()
+{
+	io.out() << "You have reached the maximum number of steps, and you are not with Nero.\n"; 
+	io.out() << "We are now going to bring you back to the present since we don’t want you alone\n";
+	io.out() << "in the city of Rome without the emperor’s protection at night.\n";
 	
-	while (getline(inputFile, text, DELIM))
+	io.event(EventType::OUT_OF_STEPS);
+	state.gameOver = true;
+	co_await io.pause();
+}
+
+
+/*************************************************************************************************** 
+ * Description: Private member coroutine called when the player has been received by Nero. Prints
+ * 		a series of messages and text-based images as the ending to the game (loaded once
+ * 		per process by the Content class).
+ * 		Receives and returns nothing.
+ ****************************************************************************************************/
+
+Task<void> Game::ending_sequence()
+{
+	io.clear_screen();
+
+	// Print each section of the ending sequence
+	for (std::string_view text : Content::get().sections(Asset::ENDING_SEQUENCE))
 	{
-		std::cout << text;
+		io.out() << text;
 	}
 	
-	// Close the input file and set gameOver to true
-	inputFile.close();
-	gameOver = true;
+	// Set gameOver to true
+	state.gameOver = true;
 	
-	pressEnter();
-	std::cout << "Congratulations, time traveler! You win!\n";
-	std::cout << "Thank you for your hard work in getting us this muusical score and recording from Rome!\n";
-	pressEnter();
+	co_await io.pause();
+	io.out() << "Congratulations, time traveler! You win!\n";
+	io.out() << "Thank you for your hard work in getting us this muusical score and recording from Rome!\n";
+	co_await io.pause();
+}
+
+
+/***************************************************************************************************** 
+ * Description: Accessor method that receives nothing and returns the seed of the game (which,
+ * 		with the player's choices, is all that is needed to play the same game again).
+ ****************************************************************************************************/
+
+std::uint64_t Game::get_seed() const
+{
+	return this->seed;
 }
 
 
@@ -289,5 +418,63 @@ void Game::ending_sequence()
 
 bool Game::game_over() const
 {
-	return this->gameOver;
+	return this->state.gameOver;
+}
+
+
+/***************************************************************************************************** 
+ * Description: Accessor method that receives nothing and returns a copy of the game's state. The
+ * 		copy can later be passed to restore() to return the game to this exact point.
+ ****************************************************************************************************/
+
+GameState Game::snapshot() const
+{
+	return this->state;
+}
+
+
+/***************************************************************************************************** 
+ * Description: Mutator method that receives a snapshot previously returned by snapshot() and
+ * 		restores the game to the point at which the snapshot was taken. Returns nothing.
+ ****************************************************************************************************/
+
+void Game::restore(const GameState& snapshot)
+{
+	this->state = snapshot;
+}
+
+
+/***************************************************************************************************** 
+ * Description: Accessor method that receives nothing and returns a copy of the game's Random number
+ * 		generator in its current state.
+ ****************************************************************************************************/
+
+Random Game::get_rng() const
+{
+	return this->rng;
+}
+
+
+/***************************************************************************************************** 
+ * Description: Mutator method that receives a copy of a Random number generator previously returned
+ * 		by get_rng() and puts the game's generator back in that state, so the random outcomes
+ * 		drawn afterwards are the same ones drawn after the copy was taken. Returns nothing.
+ ****************************************************************************************************/
+
+void Game::set_rng(const Random& rng)
+{
+	this->rng = rng;
+}
+
+
+/***************************************************************************************************** 
+ * Description: Mutator method that receives a table of hints for the game's map (shared with any
+ * 		other games using it), or nullptr to stop offering hints. From the next menu on, the
+ * 		player can ask for a hint of what to do at a space and of where to move. Returns
+ * 		nothing.
+ ****************************************************************************************************/
+
+void Game::set_hints(std::shared_ptr<const HintTable> hints)
+{
+	gameBoard.set_hints(std::move(hints));
 }
@@ -6,31 +6,38 @@
  * 		an individual game of the Ancient Rome-themed board game.
  *
  * 		Private data members include the following:
+ * 		- A reference to the GameIO object through which all input and output is performed
+ * 		- The seed of the game and the Random number generator created from it, from which
+ * 		  every random outcome of the game is drawn (so a game can be reproduced from its
+ * 		  seed and the player's choices)
  * 		- A Board object representing the game's board
- * 		- A set of strings representing the items the player is carrying in their satchel
- * 		- An integer representing how many coins (in-game currency) the user has
- * 		- An integer representing the number of steps the player has taken since the start 
- * 		  of the game
- * 		- An integer representing the number of steps the player has taken since bathing
- * 		- A bool representing whether or not the player has bathed at the Thermae space
- * 		- A bool indicating whether or not the player knows about the scroll
- * 		  that the librarian wants the school teacher to return
- * 		- A bool indicating whether or not the player is still alive
- * 		- A bool indicating whether or not the player is with Nero (tiggers winning ending 
- * 		  sequence when its value is true)
- * 		- A bool indicating whether or not the game is over (set to true when the
- * 		  player wins, dies, or runs out of time steps; accessor method
- * 		  allows outside functions to check whether or not the game is over)
+ * 		- A GameState holding everything that can change during the game, including the
+ * 		  player's location, satchel, coins (in-game currency), steps taken, bathing status,
+ * 		  whether or not they know about the scroll, are still alive, or are with Nero (which
+ * 		  triggers the winning ending sequence), whether or not the game is over (set to true
+ * 		  when the player wins, dies, or runs out of time steps), and the state of each space
  *		
  *		Public member functions include the following:
- *		- A constructor
+ *		- Constructors that receive the GameIO object to use and (optionally) the game's seed
+ *		  and the GameMap on which it is played
+ *		- An accessor function that returns the game's seed
  *		- A function that executs a turn in the game
  *		- An accessor function that returns a bool to indicate whether or not the game is 
  *		  over
+ *		- Functions that take a snapshot of the game's state and restore the game to a
+ *		  snapshot (a snapshot is a copy of the GameState, so both take constant time)
+ *		- Accessor and mutator functions for the state of the Random number generator
+ *		  (together with a snapshot, these allow a turn to be played again exactly)
+ *		- A mutator function that sets the table of hints (see HintTable.hpp), after which
+ *		  the menus of each turn offer the player a hint
  *
  *		Private member functions include the following:
+ *		- A function that prints the status line, satchel contents, and board image
+ *		- A function that prints a hint of what to do at the current space
  *		- A function that prints the current contents of the player's satchel
  *		  (or a message indicating that the satchel is empty)
+ *		- A function that moves the player and counts the step
+ *		- A function that ends the game when the player runs out of steps
  *		- A function that reads in and displays the end-of-game messages and text-based
  *		  images from a text file that are displayed when the player wins the game
  *		  (by gaining access to Nero at the Domus Aurea)
@@ -47,25 +54,33 @@ class Game
 {
 	private:
 		// Private data members
+		GameIO& io;
+		std::uint64_t seed;
+		Random rng;
 		Board gameBoard;
-		std::set<std::string> satchel;
-		int money;
-		int stepsTaken;
-		int stepsSinceBathing;
-		bool hasBathed;
-		bool knowsAboutScroll;
-		bool stillAlive;
-		bool withNero;
-		bool gameOver;
+		GameState state;
 		
 		// Private member functions
+		void print_status(Space* currentSpace);
 		void print_satchel_contents();
-		void ending_sequence();
+		void print_hint(Space* currentSpace);
+		Task<void> move_player();
+		Task<void> out_of_steps();
+		Task<void> ending_sequence();
 
 	public:
 		// Public member functions
-		Game();
+		Game(GameIO& io);
+		Game(GameIO& io, std::uint64_t seed);
+		Game(GameIO& io, std::uint64_t seed, std::shared_ptr<const GameMap> map);
+		std::uint64_t get_seed() const;
 		void take_turn();
+		Task<void> play_turn();
 		bool game_over() const;
+		GameState snapshot() const;
+		void restore(const GameState& snapshot);
+		Random get_rng() const;
+		void set_rng(const Random& rng);
+		void set_hints(std::shared_ptr<const HintTable> hints);
 };
 #endif
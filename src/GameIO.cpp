@@ -0,0 +1,237 @@
+/***************************************************************************************************
+ * Program Name: GameIO.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Abstract class that defines every way in which the game engine communicates
+ * 		with the outside world. The Game, the Board, and every Space's interact function
+ * 		perform all input and output through a GameIO object instead of
+ * 		using std::cin, std::cout, or std::system directly. This allows the same
+ * 		engine to be driven either by a person at a terminal (TerminalIO) or by a
+ * 		program that supplies decisions and consumes structured events (HeadlessIO).
+ *
+ *		The game engine asks for input with co_await io.choose(...) (a menu) and
+ *		co_await io.pause() (a pause), so that a frontend can suspend the coroutine asking
+ *		(see Task.hpp) until the player answers. By default, the awaiters simply call the
+ *		blocking menu and press_enter functions and never suspend, which is what TerminalIO
+ *		and HeadlessIO do. A frontend that does suspend (SessionIO) overrides the virtual
+ *		functions that begin a prompt, suspend the awaiting coroutine, and hand over the
+ *		answer once it has arrived.
+ *
+ *		Member functions of this class include:
+ *		- A virtual destructor
+ *		- A pure virtual function that returns the stream to which game text is written
+ *		- A pure virtual function that displays a menu and returns the validated choice
+ *		- A pure virtual function that pauses until the player is ready to continue
+ *		- A pure virtual function that starts a new screen
+ *		- A pure virtual function that receives structured events
+ *		- Functions that return awaiters for a menu (of string_views or of strings) and for
+ *		  a pause
+ *		- Virtual functions used by the awaiters to begin a prompt (answering it at once if
+ *		  possible), suspend the awaiting coroutine, and take the answer when it is resumed
+ *
+ *		The MenuAwaiter and PauseAwaiter classes are also implemented in this file.
+ **************************************************************************************************/
+#include "GameIO.hpp"
+#include "ReplayLog.hpp"
+
+
+/***************************************************************************************************
+ * Description: Virtual destructor for GameIO class. Body of destructor is empty since the
+ * 		abstract class owns no resources, but it is virtual so that child class
+ * 		destructors are called in the proper order.
+ ***************************************************************************************************/
+
+GameIO::~GameIO()
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt and the menu choices and returns an awaiter that displays the
+ * 		menu. co_await on the awaiter evaluates to the validated choice, suspending the
+ * 		awaiting coroutine until the player answers if the frontend needs to.
+ ***************************************************************************************************/
+
+MenuAwaiter GameIO::choose(Prompt prompt, MenuChoices menuChoices)
+{
+	return MenuAwaiter(*this, prompt, menuChoices);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt and the menu choices as a vector of strings. Views the strings
+ * 		through the GameIO's vector of string_views (which keeps its memory from one menu to
+ * 		the next) and returns an awaiter that displays the menu, as above.
+ ***************************************************************************************************/
+
+MenuAwaiter GameIO::choose(Prompt prompt, const std::vector<std::string>& menuChoices)
+{
+	menuViews.assign(menuChoices.begin(), menuChoices.end());
+	return MenuAwaiter(*this, prompt, menuViews);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns an awaiter that pauses until the player is ready to
+ * 		continue, suspending the awaiting coroutine if the frontend needs to.
+ ***************************************************************************************************/
+
+PauseAwaiter GameIO::pause()
+{
+	return PauseAwaiter(*this);
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual function that begins a menu. Receives the prompt, the menu choices, and an
+ * 		int in which to store the choice if it is known right away. Returns true if the
+ * 		choice was stored (the awaiting coroutine carries on without being suspended) or
+ * 		false if the awaiting coroutine must be suspended until the player answers. By
+ * 		default, displays the menu with the blocking menu function and returns true.
+ ***************************************************************************************************/
+
+bool GameIO::begin_menu(Prompt prompt, MenuChoices menuChoices, int& choice)
+{
+	choice = menu(prompt, menuChoices);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual function that begins a pause. Receives nothing. Returns true if the player
+ * 		is already ready to continue or false if the awaiting coroutine must be suspended
+ * 		until they are. By default, pauses with the blocking press_enter function and
+ * 		returns true.
+ ***************************************************************************************************/
+
+bool GameIO::begin_pause()
+{
+	press_enter();
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual function that receives the coroutine awaiting a prompt that could not be
+ * 		answered right away. A frontend that suspends keeps the handle and resumes it once
+ * 		the player has answered. By default, does nothing (the default begin_menu and
+ * 		begin_pause always answer right away, so this is never called). Returns nothing.
+ ***************************************************************************************************/
+
+void GameIO::suspend([[maybe_unused]] std::coroutine_handle<> waiting)
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual function called when a suspended coroutine is resumed. Receives nothing and
+ * 		returns the player's answer to the prompt it was waiting on (the menu choice, or 0
+ * 		for a pause). By default, returns 0.
+ ***************************************************************************************************/
+
+int GameIO::take_answer()
+{
+	return 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the ReplayLog into which to record every choice made from now on, or
+ * 		nullptr to stop recording. Returns nothing.
+ ***************************************************************************************************/
+
+void GameIO::set_replay_log(ReplayLog* replayLog)
+{
+	this->replayLog = replayLog;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a validated menu choice and adds it to the ReplayLog, if one is set.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void GameIO::record_choice(int choice)
+{
+	if (replayLog != nullptr)
+	{
+		replayLog->add_choice(choice);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor for MenuAwaiter that receives the GameIO, the prompt, and the menu
+ * 		choices (which must stay valid until the co_await expression finishes, as they do
+ * 		when they are local variables or temporaries of the awaiting coroutine).
+ ***************************************************************************************************/
+
+MenuAwaiter::MenuAwaiter(GameIO& io, Prompt prompt, MenuChoices menuChoices) :
+	io(io), prompt(prompt), menuChoices(menuChoices)
+{
+	choice = 0;
+	answered = false;
+}
+
+
+/***************************************************************************************************
+ * Description: Awaiter functions for a menu. await_ready() begins the menu and returns whether or
+ * 		not the choice is already known. await_suspend() receives the awaiting coroutine and
+ * 		hands it to the GameIO to resume later. await_resume() records the choice (see
+ * 		record_choice) and returns it.
+ ***************************************************************************************************/
+
+bool MenuAwaiter::await_ready()
+{
+	answered = io.begin_menu(prompt, menuChoices, choice);
+	return answered;
+}
+
+void MenuAwaiter::await_suspend(std::coroutine_handle<> waiting)
+{
+	io.suspend(waiting);
+}
+
+int MenuAwaiter::await_resume()
+{
+	int validChoice = answered ? choice : io.take_answer();
+	io.record_choice(validChoice);
+	return validChoice;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor for PauseAwaiter that receives the GameIO.
+ ***************************************************************************************************/
+
+PauseAwaiter::PauseAwaiter(GameIO& io) : io(io)
+{
+	answered = false;
+}
+
+
+/***************************************************************************************************
+ * Description: Awaiter functions for a pause. await_ready() begins the pause and returns whether or
+ * 		not the player is already ready to continue. await_suspend() receives the awaiting
+ * 		coroutine and hands it to the GameIO to resume later. await_resume() lets the GameIO
+ * 		finish the pause if the coroutine was suspended.
+ ***************************************************************************************************/
+
+bool PauseAwaiter::await_ready()
+{
+	answered = io.begin_pause();
+	return answered;
+}
+
+void PauseAwaiter::await_suspend(std::coroutine_handle<> waiting)
+{
+	io.suspend(waiting);
+}
+
+void PauseAwaiter::await_resume()
+{
+	if (!answered)
+	{
+		io.take_answer();
+	}
+}
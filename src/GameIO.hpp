@@ -0,0 +1,150 @@
+/***************************************************************************************************
+ * Program Name: GameIO.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Abstract class that defines every way in which the game engine communicates
+ * 		with the outside world. The Game, the Board, and every Space's interact function
+ * 		perform all input and output through a GameIO object instead of
+ * 		using std::cin, std::cout, or std::system directly. This allows the same
+ * 		engine to be driven either by a person at a terminal (TerminalIO) or by a
+ * 		program that supplies decisions and consumes structured events (HeadlessIO).
+ *
+ * 		Two enum classes are declared in this header file:
+ * 		- Prompt (identifies which decision point of the game a menu belongs to so that
+ * 		  programs driving the game know what is being asked without parsing menu text)
+ * 		- EventType (identifies a structured event emitted by the engine)
+ *
+ * 		A GameEvent struct pairs an EventType with an int value whose meaning
+ * 		depends on the type of event (see comments next to each EventType).
+ *
+ *		The game engine asks for input with co_await io.choose(...) (a menu) and
+ *		co_await io.pause() (a pause), so that a frontend can suspend the coroutine asking
+ *		(see Task.hpp) until the player answers. By default, the awaiters simply call the
+ *		blocking menu and press_enter functions and never suspend, which is what TerminalIO
+ *		and HeadlessIO do. A frontend that does suspend (SessionIO) overrides the virtual
+ *		functions that begin a prompt, suspend the awaiting coroutine, and hand over the
+ *		answer once it has arrived.
+ *
+ *		Member functions of this class include:
+ *		- A virtual destructor
+ *		- A pure virtual function that returns the stream to which game text is written
+ *		- A pure virtual function that displays a menu and returns the validated choice
+ *		- A pure virtual function that pauses until the player is ready to continue
+ *		- A pure virtual function that starts a new screen
+ *		- A pure virtual function that receives structured events
+ *		- Functions that return awaiters for a menu (of string_views or of strings) and for
+ *		  a pause
+ *		- Virtual functions used by the awaiters to begin a prompt (answering it at once if
+ *		  possible), suspend the awaiting coroutine, and take the answer when it is resumed
+ *		- Functions that set the ReplayLog (see ReplayLog.hpp) into which the choices made
+ *		  are recorded, and record a choice (called by the menu awaiter with every choice)
+ *
+ *		A menu's choices are passed as MenuChoices, a view of string_views that owns none of
+ *		them, so that a menu whose text never changes (such as each space's menu of
+ *		directions, built once per map by BoardMenus) is displayed without copying or allocating
+ *		anything. A menu built as a vector of strings can still be passed to choose(),
+ *		which views it through a vector of string_views kept by the GameIO for the purpose
+ *		(only one menu of a GameIO is ever waiting for an answer at a time).
+ *
+ *		The MenuAwaiter and PauseAwaiter classes (returned by choose() and pause()) are also
+ *		declared in this header file.
+ **************************************************************************************************/
+#ifndef GAMEIO_HPP
+#define GAMEIO_HPP
+
+#include <coroutine>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Enum class identifying each decision point at which the player is asked to pick from a menu
+enum class Prompt{ENTER_SPACE, MOVE, PLAY_AGAIN, TRIVIA_CHALLENGE, TRIVIA_ANSWER, BET_AMOUNT, BET_TEAM,
+		  PURCHASE, DONATION, BATHE, GLADIATOR_MOVE, LOYALTY_QUESTION};
+
+// Enum class identifying each structured event emitted by the engine
+enum class EventType
+{
+	TURN_STARTED,		// value: number of steps taken so far
+	SPACE_ENTERED,		// value: number of the space entered
+	MOVED,			// value: number of the space moved to
+	MONEY_CHANGED,		// value: change in the player's coins (may be negative)
+	SATCHEL_CHANGED,	// value: number of items now in the satchel
+	BATHED,			// value: unused
+	TRIVIA_FINISHED,	// value: coins won in the trivia game
+	BATTLE_FINISHED,	// value: 1 if the player won the gladiator battle, 0 if they lost
+	RACE_FINISHED,		// value: coins won in the chariot race
+	DIED,			// value: unused
+	WON,			// value: number of steps taken
+	OUT_OF_STEPS		// value: unused
+};
+
+// Struct pairing an event type with its value
+struct GameEvent
+{
+	EventType type;
+	int value;
+};
+
+// Non-owning view of the choices of a menu (passed by value, like a string_view)
+typedef std::span<const std::string_view> MenuChoices;
+
+class GameIO;
+class ReplayLog;
+
+// Awaiter for a menu: co_await evaluates to the validated choice
+class MenuAwaiter
+{
+	private:
+		GameIO& io;
+		Prompt prompt;
+		MenuChoices menuChoices;
+		int choice;
+		bool answered;
+
+	public:
+		MenuAwaiter(GameIO& io, Prompt prompt, MenuChoices menuChoices);
+		bool await_ready();
+		void await_suspend(std::coroutine_handle<> waiting);
+		int await_resume();
+};
+
+// Awaiter for a pause until the player is ready to continue
+class PauseAwaiter
+{
+	private:
+		GameIO& io;
+		bool answered;
+
+	public:
+		PauseAwaiter(GameIO& io);
+		bool await_ready();
+		void await_suspend(std::coroutine_handle<> waiting);
+		void await_resume();
+};
+
+class GameIO
+{
+	private:
+		ReplayLog* replayLog = nullptr;
+		std::vector<std::string_view> menuViews;
+
+	public:
+		virtual ~GameIO();
+		virtual std::ostream& out() = 0;
+		virtual int menu(Prompt prompt, MenuChoices menuChoices) = 0;
+		virtual void press_enter() = 0;
+		virtual void clear_screen() = 0;
+		virtual void event(EventType type, int value = 0) = 0;
+		MenuAwaiter choose(Prompt prompt, MenuChoices menuChoices);
+		MenuAwaiter choose(Prompt prompt, const std::vector<std::string>& menuChoices);
+		PauseAwaiter pause();
+		virtual bool begin_menu(Prompt prompt, MenuChoices menuChoices, int& choice);
+		virtual bool begin_pause();
+		virtual void suspend(std::coroutine_handle<> waiting);
+		virtual int take_answer();
+		void set_replay_log(ReplayLog* replayLog);
+		void record_choice(int choice);
+};
+#endif
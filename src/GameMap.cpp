@@ -0,0 +1,601 @@
+/***************************************************************************************************
+ * Program Name: GameMap.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameMap class that describes the layout of a board, with the neighbors of every
+ * 		space stored in compressed sparse row form. This file builds the map of Rome, builds
+ * 		maps from lists of neighbors, and reads and writes map files. See GameMap.hpp for
+ * 		the layout of a map and the format of map files.
+ **************************************************************************************************/
+#include "GameMap.hpp"
+#include <array>
+#include <charconv>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "GameState.hpp"
+#include "HashBytes.hpp"
+
+const char* const SPACE_TYPE_NAMES[NUM_SPACE_TYPES] = {"Bibliotheca", "DomusAurea", "Ludus", "CircusMaximus",
+						      "Forum", "Theatrum", "Colosseum", "Thermae", "CampusMartius"};
+
+// Names of the directions used in map files, indexed by Direction
+static constexpr std::array<std::string_view, NUM_DIRECTIONS> DIRECTION_TAGS = {"N", "NE", "E", "SE", "S", "SW", "W", "NW"};
+
+// Names of the space types as views (so that the length of each name is not
+// recomputed every time a word of a map file is compared with it)
+static const std::array<std::string_view, NUM_SPACE_TYPES> TYPE_NAME_VIEWS = {SPACE_TYPE_NAMES[0], SPACE_TYPE_NAMES[1],
+	SPACE_TYPE_NAMES[2], SPACE_TYPE_NAMES[3], SPACE_TYPE_NAMES[4], SPACE_TYPE_NAMES[5], SPACE_TYPE_NAMES[6],
+	SPACE_TYPE_NAMES[7], SPACE_TYPE_NAMES[8]};
+
+// Table of the position of the edge in each direction among the edges of a space with a
+// given bitmask of valid directions (the number of bits of the bitmask below the bit of
+// that direction), so that finding a neighbor takes a single lookup instead of a count
+static constexpr std::array<std::array<std::uint8_t, NUM_DIRECTIONS>, 256> EDGE_RANK = []()
+{
+	std::array<std::array<std::uint8_t, NUM_DIRECTIONS>, 256> rank = {};
+	for (int mask = 0; mask < 256; mask++)
+	{
+		std::uint8_t below = 0;
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+		{
+			rank[mask][dirNum] = below;
+			below += (mask >> dirNum) & 1;
+		}
+	}
+	return rank;
+}();
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a direction and returns the opposite direction (the
+ * 		direction of the move back). Directions are listed clockwise, so the opposite
+ * 		direction is four places further on.
+ ***************************************************************************************************/
+
+static int opposite(int dirNum)
+{
+	return (dirNum + NUM_DIRECTIONS / 2) % NUM_DIRECTIONS;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a location and a direction. Throws std::runtime_error
+ * 		reporting that the space at the location has two different neighbors in the
+ * 		direction. Returns nothing.
+ ***************************************************************************************************/
+
+static void throw_two_neighbors(std::uint32_t location, int dirNum)
+{
+	throw std::runtime_error("Space " + std::to_string(location + 1) + " of the map has two neighbors to the " +
+				 DIRECTION_NAMES[dirNum]);
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a line of a map file and the position within it at
+ * 		which to start. Returns the next word of the line (the characters up to the next
+ * 		space or tab), or an empty view if there are no more words, and moves the position
+ * 		past the word.
+ ***************************************************************************************************/
+
+static std::string_view next_word(std::string_view line, std::size_t& position)
+{
+	while (position < line.size() && (line[position] == ' ' || line[position] == '\t'))
+	{
+		position++;
+	}
+	std::size_t wordStart = position;
+	while (position < line.size() && line[position] != ' ' && line[position] != '\t')
+	{
+		position++;
+	}
+	return line.substr(wordStart, position - wordStart);
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the text of a number. Stores the number in the
+ * 		unsigned int received by reference and returns true if the whole text is a number
+ * 		that fits, or returns false if it is not.
+ ***************************************************************************************************/
+
+static bool parse_number(std::string_view text, std::uint32_t& number)
+{
+	std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), number);
+	return !text.empty() && result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that creates an empty map (with no spaces).
+ ***************************************************************************************************/
+
+GameMap::GameMap()
+{
+	start = 0;
+	firstEdge.push_back(0);
+	mapFingerprint = hash_tables();
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives nothing and returns the map of Rome used by the
+ * 		original game (the 3 x 3 grid described by ROME_ADJACENCY, with the space at each
+ * 		location being the type of space whose number it has). The map is built the first
+ * 		time this function is called and then shared by every caller.
+ ***************************************************************************************************/
+
+std::shared_ptr<const GameMap> GameMap::rome()
+{
+	static const std::shared_ptr<const GameMap> romeMap = []()
+	{
+		std::vector<SpaceType> spaceTypes;
+		std::vector<MapEdge> edges;
+		for (int location = 0; location < NUM_SPACES; location++)
+		{
+			spaceTypes.push_back(static_cast<SpaceType>(location));
+
+			// List each pair of neighbors once, from the space with the lower location
+			for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+			{
+				std::uint8_t neighbor = ROME_ADJACENCY.neighbor[location][dirNum];
+				if (neighbor != NO_NEIGHBOR && neighbor > location)
+				{
+					edges.push_back({static_cast<std::uint32_t>(location), neighbor, static_cast<Direction>(dirNum)});
+				}
+			}
+		}
+
+		std::shared_ptr<GameMap> map = std::make_shared<GameMap>();
+		map->build(spaceTypes, edges, START_LOCATION);
+		return std::shared_ptr<const GameMap>(map);
+	}();
+	return romeMap;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the type of each space (indexed by location), a list of pairs of
+ * 		neighbors (each pair needs to be listed only once, as the move back is added
+ * 		automatically, but a pair listed again, from either space, is allowed), and the
+ * 		location at which the player starts. Replaces the map with the map they describe.
+ * 		Throws std::runtime_error if the start or an edge lies outside the map, if a space
+ * 		is its own neighbor, or if a space would have two different neighbors in the same
+ * 		direction.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void GameMap::build(std::vector<SpaceType> spaceTypes, const std::vector<MapEdge>& edges, std::uint32_t startLocation)
+{
+	std::size_t numSpaces = spaceTypes.size();
+	if (startLocation >= numSpaces)
+	{
+		throw std::runtime_error("The start of the map (space " + std::to_string(startLocation + 1) +
+					 ") is not one of its spaces");
+	}
+
+	// Mark the direction of each edge at both of its ends. An edge whose directions are both
+	// marked already may be a pair of neighbors listed again from the other space (or from
+	// the same space), which is allowed, so it is set aside and checked once the edges
+	// listed first have been placed.
+	std::vector<std::uint8_t> masks(numSpaces, 0);
+	std::vector<std::size_t> repeated;
+	for (std::size_t edgeNum = 0; edgeNum < edges.size(); edgeNum++)
+	{
+		const MapEdge& edge = edges[edgeNum];
+		int dirNum = static_cast<int>(edge.dir);
+		if (edge.from >= numSpaces || edge.to >= numSpaces || edge.from == edge.to || dirNum < 0 || dirNum >= NUM_DIRECTIONS)
+		{
+			throw std::runtime_error("The map has an invalid neighbor of space " + std::to_string(edge.from + 1));
+		}
+		bool fromMarked = (masks[edge.from] >> dirNum & 1);
+		bool toMarked = (masks[edge.to] >> opposite(dirNum) & 1);
+		if (fromMarked && toMarked)
+		{
+			repeated.push_back(edgeNum);
+		}
+		else if (fromMarked || toMarked)
+		{
+			throw_two_neighbors(fromMarked ? edge.from : edge.to, fromMarked ? dirNum : opposite(dirNum));
+		}
+		masks[edge.from] |= 1 << dirNum;
+		masks[edge.to] |= 1 << opposite(dirNum);
+	}
+
+	// Each space's edges start where the previous space's edges end
+	std::vector<std::uint32_t> first(numSpaces + 1);
+	first[0] = 0;
+	for (std::size_t location = 0; location < numSpaces; location++)
+	{
+		std::uint8_t mask = masks[location];
+		first[location + 1] = first[location] + EDGE_RANK[mask][NUM_DIRECTIONS - 1] + (mask >> (NUM_DIRECTIONS - 1));
+	}
+
+	// Place each edge (and the move back) at its position among its space's edges, except
+	// for the edges set aside above
+	std::vector<std::uint32_t> targets(first[numSpaces]);
+	std::size_t nextRepeated = 0;
+	for (std::size_t edgeNum = 0; edgeNum < edges.size(); edgeNum++)
+	{
+		if (nextRepeated < repeated.size() && repeated[nextRepeated] == edgeNum)
+		{
+			nextRepeated++;
+			continue;
+		}
+		const MapEdge& edge = edges[edgeNum];
+		int dirNum = static_cast<int>(edge.dir);
+		int backNum = opposite(dirNum);
+		targets[first[edge.from] + EDGE_RANK[masks[edge.from]][dirNum]] = edge.to;
+		targets[first[edge.to] + EDGE_RANK[masks[edge.to]][backNum]] = edge.from;
+	}
+
+	// An edge set aside must be the same as the one already placed in its direction (the
+	// move back then matches too, since it was placed with it)
+	for (std::size_t edgeNum : repeated)
+	{
+		const MapEdge& edge = edges[edgeNum];
+		int dirNum = static_cast<int>(edge.dir);
+		if (targets[first[edge.from] + EDGE_RANK[masks[edge.from]][dirNum]] != edge.to)
+		{
+			throw_two_neighbors(edge.from, dirNum);
+		}
+	}
+
+	start = startLocation;
+	types = std::move(spaceTypes);
+	validMasks = std::move(masks);
+	firstEdge = std::move(first);
+	edgeTargets = std::move(targets);
+	mapFingerprint = hash_tables();
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a map file and replaces the map with the map it describes
+ * 		(see GameMap.hpp for the format). The file is mapped into memory and read in a
+ * 		single pass. Throws std::runtime_error naming the file (and the line, if the
+ * 		problem is with a line of the file) if it cannot be opened or is not a valid map.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void GameMap::load(const char* fileName)
+{
+	std::string name(fileName);
+	int fd = ::open(fileName, O_RDONLY);
+	if (fd < 0)
+	{
+		throw std::runtime_error("Could not open map file " + name);
+	}
+
+	struct stat fileInfo;
+	if (fstat(fd, &fileInfo) != 0)
+	{
+		::close(fd);
+		throw std::runtime_error("Could not read map file " + name);
+	}
+
+	// An empty file cannot be mapped, and is not a valid map either
+	std::size_t size = static_cast<std::size_t>(fileInfo.st_size);
+	void* mapping = (size > 0) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		throw std::runtime_error("Could not read map file " + name);
+	}
+	std::string_view text(static_cast<const char*>(mapping), size);
+
+	std::vector<SpaceType> spaceTypes;
+	std::vector<MapEdge> edges;
+	std::uint32_t numSpaces = 0;
+	std::uint32_t startNum = 0;
+	int lineNum = 0;
+	std::size_t lineStart = 0;
+
+	// Reads the next line that is not empty or a comment into "line", returning
+	// false at the end of the file
+	std::string_view line;
+	auto nextLine = [&]()
+	{
+		while (lineStart < text.size())
+		{
+			std::size_t lineEnd = text.find('\n', lineStart);
+			if (lineEnd == std::string_view::npos)
+			{
+				lineEnd = text.size();
+			}
+			line = text.substr(lineStart, lineEnd - lineStart);
+			lineStart = lineEnd + 1;
+			lineNum++;
+
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.remove_suffix(1);
+			}
+			if (!line.empty() && line[0] != '#')
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Unmaps the file and throws an error about the current line
+	auto fail = [&](const std::string& problem)
+	{
+		if (mapping != nullptr)
+		{
+			munmap(mapping, size);
+		}
+		throw std::runtime_error("Map file " + name + ", line " + std::to_string(lineNum) + ": " + problem);
+	};
+
+	// Read the number of spaces and the start
+	std::size_t position = 0;
+	if (!nextLine() || next_word(line, position) != "spaces" || !parse_number(next_word(line, position), numSpaces) ||
+	    numSpaces == 0 || numSpaces == NO_SPACE)
+	{
+		fail("expected \"spaces\" followed by the number of spaces");
+	}
+	position = 0;
+	if (!nextLine() || next_word(line, position) != "start" || !parse_number(next_word(line, position), startNum) ||
+	    startNum < 1 || startNum > numSpaces)
+	{
+		fail("expected \"start\" followed by the number of a space of the map");
+	}
+
+	// Read the line of each space
+	spaceTypes.reserve(numSpaces);
+	edges.reserve(static_cast<std::size_t>(numSpaces) * 2);
+	for (std::uint32_t location = 0; location < numSpaces; location++)
+	{
+		if (!nextLine())
+		{
+			fail("expected " + std::to_string(numSpaces) + " spaces but found " + std::to_string(location));
+		}
+
+		position = 0;
+		std::string_view typeName = next_word(line, position);
+		int typeNum = 0;
+		while (typeNum < NUM_SPACE_TYPES && typeName != TYPE_NAME_VIEWS[typeNum])
+		{
+			typeNum++;
+		}
+		if (typeNum == NUM_SPACE_TYPES)
+		{
+			fail("unknown type of space \"" + std::string(typeName) + "\"");
+		}
+		spaceTypes.push_back(static_cast<SpaceType>(typeNum));
+
+		for (std::string_view word = next_word(line, position); !word.empty(); word = next_word(line, position))
+		{
+			std::size_t equals = word.find('=');
+			std::string_view tag = word.substr(0, equals);
+			int dirNum = 0;
+			while (dirNum < NUM_DIRECTIONS && tag != DIRECTION_TAGS[dirNum])
+			{
+				dirNum++;
+			}
+
+			std::uint32_t neighborNum = 0;
+			if (equals == std::string_view::npos || dirNum == NUM_DIRECTIONS ||
+			    !parse_number(word.substr(equals + 1), neighborNum))
+			{
+				fail("expected a neighbor such as SE=5 but found \"" + std::string(word) + "\"");
+			}
+			if (neighborNum < 1 || neighborNum > numSpaces || neighborNum == location + 1)
+			{
+				fail("space " + std::to_string(neighborNum) + " cannot be a neighbor of space " + std::to_string(location + 1));
+			}
+			edges.push_back({location, neighborNum - 1, static_cast<Direction>(dirNum)});
+		}
+	}
+
+	if (nextLine())
+	{
+		fail("expected the end of the file after " + std::to_string(numSpaces) + " spaces");
+	}
+	munmap(mapping, size);
+
+	try
+	{
+		build(std::move(spaceTypes), edges, startNum - 1);
+	}
+	catch (const std::runtime_error& error)
+	{
+		throw std::runtime_error("Map file " + name + ": " + error.what());
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a file and writes the map to it in the map file format (each
+ * 		pair of neighbors is written once, on the line of the space with the lower number).
+ * 		Throws std::runtime_error if the file cannot be written. Returns nothing.
+ ***************************************************************************************************/
+
+void GameMap::write(const char* fileName) const
+{
+	std::string text = "spaces " + std::to_string(num_spaces()) + "\nstart " + std::to_string(start + 1) + "\n";
+
+	char number[16];
+	for (std::uint32_t location = 0; location < num_spaces(); location++)
+	{
+		text += SPACE_TYPE_NAMES[static_cast<int>(types[location])];
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+		{
+			std::uint32_t neighbor = get_neighbor(location, static_cast<Direction>(dirNum));
+			if (neighbor != NO_SPACE && neighbor > location)
+			{
+				std::to_chars_result result = std::to_chars(number, number + sizeof(number), neighbor + 1);
+				text += ' ';
+				text += DIRECTION_TAGS[dirNum];
+				text += '=';
+				text.append(number, result.ptr);
+			}
+		}
+		text += '\n';
+	}
+
+	std::ofstream outputFile(fileName, std::ios::binary);
+	outputFile.write(text.data(), static_cast<std::streamsize>(text.size()));
+	if (!outputFile)
+	{
+		throw std::runtime_error(std::string("Could not write map file ") + fileName);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods for the map. num_spaces() and num_edges() return the number of
+ * 		spaces and of edges (counting the move in each direction between two neighbors),
+ * 		get_start() returns the location at which the player starts, and get_type() and
+ * 		get_valid_mask() return the type and the bitmask of valid directions of the space
+ * 		at a given location.
+ ***************************************************************************************************/
+
+std::uint32_t GameMap::num_spaces() const
+{
+	return static_cast<std::uint32_t>(this->types.size());
+}
+
+std::size_t GameMap::num_edges() const
+{
+	return this->edgeTargets.size();
+}
+
+std::uint32_t GameMap::get_start() const
+{
+	return this->start;
+}
+
+SpaceType GameMap::get_type(std::uint32_t location) const
+{
+	return this->types[location];
+}
+
+std::uint8_t GameMap::get_valid_mask(std::uint32_t location) const
+{
+	return this->validMasks[location];
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a location and a direction. Returns whether or not the space at that
+ * 		location has a neighbor in that direction (a single test of a bit of its bitmask).
+ ***************************************************************************************************/
+
+bool GameMap::is_valid_move(std::uint32_t location, Direction dir) const
+{
+	return (validMasks[location] >> static_cast<int>(dir)) & 1;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a location and a direction. Returns the location of the neighbor of the
+ * 		space at that location in that direction, or NO_SPACE if it has none. The neighbor
+ * 		is found at the space's first edge plus the number of valid directions that come
+ * 		before the direction received (looked up in the EDGE_RANK table).
+ ***************************************************************************************************/
+
+std::uint32_t GameMap::get_neighbor(std::uint32_t location, Direction dir) const
+{
+	int dirNum = static_cast<int>(dir);
+	std::uint8_t mask = validMasks[location];
+	if ((mask >> dirNum & 1) == 0)
+	{
+		return NO_SPACE;
+	}
+	return edgeTargets[firstEdge[location] + EDGE_RANK[mask][dirNum]];
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a location. Returns the least number of moves needed to get from the
+ * 		space at that location to the space at every location (NO_SPACE for spaces that
+ * 		cannot be reached), found with a breadth-first search.
+ ***************************************************************************************************/
+
+std::vector<std::uint32_t> GameMap::distances_from(std::uint32_t location) const
+{
+	std::vector<std::uint32_t> distances(num_spaces(), NO_SPACE);
+	std::vector<std::uint32_t> queue;
+	queue.reserve(num_spaces());
+
+	distances[location] = 0;
+	queue.push_back(location);
+	for (std::size_t next = 0; next < queue.size(); next++)
+	{
+		std::uint32_t current = queue[next];
+		for (std::uint32_t edge = firstEdge[current]; edge < firstEdge[current + 1]; edge++)
+		{
+			std::uint32_t neighbor = edgeTargets[edge];
+			if (distances[neighbor] == NO_SPACE)
+			{
+				distances[neighbor] = distances[current] + 1;
+				queue.push_back(neighbor);
+			}
+		}
+	}
+	return distances;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the number of bytes taken up by the map's tables.
+ ***************************************************************************************************/
+
+std::size_t GameMap::memory_bytes() const
+{
+	return types.size() * sizeof(SpaceType) + validMasks.size() * sizeof(std::uint8_t) +
+	       firstEdge.size() * sizeof(std::uint32_t) + edgeTargets.size() * sizeof(std::uint32_t);
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives nothing and returns a hash of the map's
+ * 		start and of every byte of its tables of types, directions, and neighbors (the first
+ * 		edge of each space follows from its directions, so it is not hashed).
+ ***************************************************************************************************/
+
+std::uint64_t GameMap::hash_tables() const
+{
+	const std::uint64_t parts[] = {start, hash_bytes(types.data(), types.size() * sizeof(SpaceType)),
+		hash_bytes(validMasks.data(), validMasks.size() * sizeof(std::uint8_t)),
+		hash_bytes(edgeTargets.data(), edgeTargets.size() * sizeof(std::uint32_t))};
+	return hash_bytes(parts, sizeof(parts));
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the fingerprint of the map (the
+ * 		hash of its tables computed when it was built). Maps that are equal have the same
+ * 		fingerprint, and different maps all but never do.
+ ***************************************************************************************************/
+
+std::uint64_t GameMap::fingerprint() const
+{
+	return this->mapFingerprint;
+}
+
+
+/***************************************************************************************************
+ * Description: Equality operators that compare two maps space by space. Each receives the map to
+ * 		compare with and returns whether or not the maps are equal (or not equal).
+ ***************************************************************************************************/
+
+bool GameMap::operator==(const GameMap& other) const
+{
+	return start == other.start && types == other.types && validMasks == other.validMasks &&
+	       edgeTargets == other.edgeTargets;
+}
+
+bool GameMap::operator!=(const GameMap& other) const
+{
+	return !(*this == other);
+}
@@ -0,0 +1,145 @@
+/***************************************************************************************************
+ * Program Name: GameMap.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameMap class that describes the layout of a board: how many spaces it has, which
+ * 		type of space (Forum, Thermae, etc.) each one is, which spaces border each other and
+ * 		in which direction, and where the player starts. The map of Rome used by the
+ * 		original game is built in, and maps of any size (up to millions of spaces) can be
+ * 		loaded from map files.
+ *
+ * 		The neighbors are stored in compressed sparse row form: the neighbors of every space
+ * 		are stored one after another in a single array of edges, in the order of their
+ * 		directions, and each space stores the index of its first edge and a bitmask of the
+ * 		directions in which it has a neighbor. The neighbor in a given direction is found at
+ * 		the index of the space's first edge plus the number of bits of the bitmask below
+ * 		that direction's bit. A map therefore takes 6 bytes per space and 4 bytes per edge.
+ *
+ * 		A map never changes once it has been built, so a single map is shared (through a
+ * 		shared_ptr) by every Board that uses it, and so are the menus of its locations (see
+ * 		BoardMenus.hpp), which the map holds once the first Board that uses it creates them.
+ *
+ * 		Map files are text files. Lines that are empty or begin with '#' are ignored. The
+ * 		first two lines read "spaces N" (the number of spaces) and "start S" (the number of
+ * 		the space at which the player starts), followed by one line for each space, in
+ * 		order of space number (starting from 1). Each space's line holds the name of its
+ * 		type (the name of its Space class, such as CircusMaximus) and then any number of
+ * 		neighbors written as DIRECTION=NUMBER (such as SE=5), where DIRECTION is one of N,
+ * 		NE, E, SE, S, SW, W, or NW. Every move can be made in both directions, so each pair
+ * 		of neighbors needs to be listed only once, from either space (the move back, in the
+ * 		opposite direction, is added automatically). Listing a pair again (such as 1 E=2 and
+ * 		2 W=1) is allowed, but a space with two different neighbors in the same direction is
+ * 		an error. For example, the map of Rome is:
+ *
+ * 			spaces 9
+ * 			start 5
+ * 			Bibliotheca E=2 SE=5 S=4
+ * 			DomusAurea E=3 SE=6 S=5 SW=4
+ * 			Ludus S=6 SW=5
+ * 			CircusMaximus E=5 SE=8 S=7
+ * 			Forum E=6 SE=9 S=8 SW=7
+ * 			Theatrum S=9 SW=8
+ * 			Colosseum E=8
+ * 			Thermae E=9
+ * 			CampusMartius
+ *
+ *		Private data members of the GameMap class include:
+ *		- The location (space number - 1) at which the player starts
+ *		- The type and the bitmask of valid directions of each space
+ *		- The index of the first edge of each space (and one past the last edge)
+ *		- The location of the neighbor at the end of each edge
+ *		- A fingerprint of the map (a hash of all of the above, computed when it is built)
+ *		- The menus of the map's locations (created once, by BoardMenus::for_map, when the
+ *		  first Board uses the map) and the flag ensuring they are created only once
+ *
+ *		Public member functions of the GameMap class include:
+ *		- A constructor that creates an empty map
+ *		- A static function that returns the shared map of Rome
+ *		- A function that builds a map from the type of each space and a list of neighbors
+ *		- Functions that load a map from a map file and write a map to a map file
+ *		- Accessors for the number of spaces and edges, the start, the type of a space, its
+ *		  bitmask of valid directions, and its neighbor in a given direction
+ *		- A function that returns the number of moves from a space to every other space
+ *		- A function that returns the number of bytes the map takes up
+ *		- An accessor for the fingerprint of the map, which tells apart different maps (so
+ *		  that a table of hints or a replay log made for one map is never used with another)
+ *		- Equality operators
+ *
+ *		The SpaceType enum class, the names of the space types, and the MapEdge struct
+ *		(one pair of neighbors, used to build a map) are also declared in this header file.
+ **************************************************************************************************/
+#ifndef GAMEMAP_HPP
+#define GAMEMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Adjacency.hpp"
+
+// Menus of every location on a map (see BoardMenus.hpp)
+class BoardMenus;
+
+// Enum class identifying each type of space (each subclass of Space)
+// (the order matches the locations of the spaces on the map of Rome)
+enum class SpaceType : std::uint8_t {BIBLIOTHECA, DOMUS_AUREA, LUDUS, CIRCUS_MAXIMUS, FORUM, THEATRUM,
+				     COLOSSEUM, THERMAE, CAMPUS_MARTIUS};
+
+// Constant indicating the number of types of space
+const int NUM_SPACE_TYPES = 9;
+
+// Value returned for the neighbor in a direction in which there is no space
+const std::uint32_t NO_SPACE = 0xFFFFFFFF;
+
+// Names of the space types used in map files, indexed by SpaceType
+extern const char* const SPACE_TYPE_NAMES[NUM_SPACE_TYPES];
+
+// Struct describing one pair of neighbors: the space at location "from" has the
+// space at location "to" as its neighbor in direction "dir" (and so the space at
+// "to" has the space at "from" as its neighbor in the opposite direction)
+struct MapEdge
+{
+	std::uint32_t from;
+	std::uint32_t to;
+	Direction dir;
+};
+
+class GameMap
+{
+	private:
+		std::uint32_t start;
+		std::vector<SpaceType> types;
+		std::vector<std::uint8_t> validMasks;
+		std::vector<std::uint32_t> firstEdge;
+		std::vector<std::uint32_t> edgeTargets;
+		std::uint64_t mapFingerprint;
+		mutable std::once_flag menusOnce;
+		mutable std::shared_ptr<const BoardMenus> menus;
+
+		// BoardMenus::for_map creates the menus of the map
+		friend class BoardMenus;
+
+		// Private member functions
+		std::uint64_t hash_tables() const;
+
+	public:
+		GameMap();
+		static std::shared_ptr<const GameMap> rome();
+		void build(std::vector<SpaceType> spaceTypes, const std::vector<MapEdge>& edges, std::uint32_t startLocation);
+		void load(const char* fileName);
+		void write(const char* fileName) const;
+		std::uint32_t num_spaces() const;
+		std::size_t num_edges() const;
+		std::uint32_t get_start() const;
+		SpaceType get_type(std::uint32_t location) const;
+		std::uint8_t get_valid_mask(std::uint32_t location) const;
+		bool is_valid_move(std::uint32_t location, Direction dir) const;
+		std::uint32_t get_neighbor(std::uint32_t location, Direction dir) const;
+		std::vector<std::uint32_t> distances_from(std::uint32_t location) const;
+		std::size_t memory_bytes() const;
+		std::uint64_t fingerprint() const;
+		bool operator==(const GameMap& other) const;
+		bool operator!=(const GameMap& other) const;
+};
+#endif
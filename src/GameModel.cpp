@@ -0,0 +1,398 @@
+/***************************************************************************************************
+ * Program Name: GameModel.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameModel class that describes the rules of the game compactly for the engines
+ * 		that search through the moves of a game. This file holds the model of what entering
+ * 		each type of space does, which follows the interact functions of the spaces. See
+ * 		GameModel.hpp.
+ **************************************************************************************************/
+#include "GameModel.hpp"
+
+// Chance that the player loses a game of trivia after answering every question correctly: the
+// student must also answer all 5 questions and all 5 tie-breakers correctly (each with a chance
+// of one half), and the game then ends in a tie
+const double TRIVIA_TIE_CHANCE = 1.0 / 1024.0;
+
+// Chances of the outcomes of a battle. Every round is won, lost, or drawn with a chance of one
+// third whatever move the player makes, so the player wins the match half the time, and the
+// senator orders the death of the loser half the time.
+const double BATTLE_WIN_CHANCE = 0.5;
+const double BATTLE_DEATH_CHANCE = 0.25;
+
+// Chance that the team the player bets on wins the chariot race (one of three teams)
+const double RACE_WIN_CHANCE = 1.0 / 3.0;
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the map on which the game is played and the expensive
+ * 		and cheap items the prefect wants.
+ ***************************************************************************************************/
+
+GameModel::GameModel(std::shared_ptr<const GameMap> map, ItemId expensiveChoice, ItemId cheapChoice)
+{
+	this->map = std::move(map);
+	this->expensiveChoice = expensiveChoice;
+	this->cheapChoice = cheapChoice;
+
+	// Use as many bits for the location as the largest location needs
+	locationBits = 1;
+	while (locationBits < 32 && (static_cast<std::uint64_t>(this->map->num_spaces()) - 1) >> locationBits)
+	{
+		locationBits++;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a ModelState (passed by reference) and
+ * 		lowers its coins to the number the player still needs if they have more: the price
+ * 		of each item the prefect wants that they have neither bought nor given him, and the
+ * 		cost of a bath. Returns nothing.
+ ***************************************************************************************************/
+
+void GameModel::cap_money(ModelState& state) const
+{
+	int needed = BATH_COST;
+	if (!state.satchel.contains(PERMIT))
+	{
+		if (!(state.flags & GAVE_EXPENSIVE) && !state.satchel.contains(expensiveChoice))
+		{
+			needed += EXPENSIVE_PRICE;
+		}
+		if (!(state.flags & GAVE_CHEAP) && !state.satchel.contains(cheapChoice))
+		{
+			needed += CHEAP_PRICE;
+		}
+	}
+	if (state.money > needed)
+	{
+		state.money = needed;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the bits of a satchel and returns them with
+ * 		the expensive item the prefect wants trading places with Olive Oil, and the cheap
+ * 		item he wants trading places with Grain (see pack). Relabeling twice gives back the
+ * 		bits received.
+ ***************************************************************************************************/
+
+std::uint8_t GameModel::relabel(std::uint8_t satchelBits) const
+{
+	const ItemId swaps[2][2] = {{OLIVE_OIL, expensiveChoice}, {GRAIN, cheapChoice}};
+	for (int swapNum = 0; swapNum < 2; swapNum++)
+	{
+		// Swapping two bits that differ is flipping both
+		if (((satchelBits >> swaps[swapNum][0]) & 1) != ((satchelBits >> swaps[swapNum][1]) & 1))
+		{
+			satchelBits ^= static_cast<std::uint8_t>((1 << swaps[swapNum][0]) | (1 << swaps[swapNum][1]));
+		}
+	}
+	return satchelBits;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the GameState of a game at the start of a turn. Returns the ModelState
+ * 		holding the parts of it that matter to winning.
+ ***************************************************************************************************/
+
+ModelState GameModel::model_state(const GameState& state) const
+{
+	ModelState modelState;
+	modelState.location = state.location;
+	modelState.money = state.money < 0 ? 0 : state.money;
+	modelState.satchel = state.satchel;
+	modelState.stepsSinceBathing = 0;
+	if (state.hasBathed)
+	{
+		modelState.stepsSinceBathing = (state.stepsSinceBathing > MAX_STEPS_SINCE_BATHING) ? MAX_STEPS_SINCE_BATHING + 1 :
+												     state.stepsSinceBathing;
+	}
+	modelState.gamesPlayed = state.gamesPlayed;
+	modelState.flags = (state.hasBathed ? HAS_BATHED : 0) | (state.knowsAboutScroll ? KNOWS_ABOUT_SCROLL : 0) |
+			   (state.returnedScroll ? RETURNED_SCROLL : 0) | (state.hasPassedTest ? PASSED_TEST : 0) |
+			   (state.hasGivenExpensive ? GAVE_EXPENSIVE : 0) | (state.hasGivenCheap ? GAVE_CHEAP : 0) |
+			   (state.obtainedScroll ? OBTAINED_SCROLL : 0);
+	cap_money(modelState);
+	return modelState;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a ModelState. Returns true if entering the space at its location wins the
+ * 		game: the space is a Domus Aurea and the player has the permit and bathed no more
+ * 		than MAX_STEPS_SINCE_BATHING steps ago (see DomusAurea::interact).
+ ***************************************************************************************************/
+
+bool GameModel::wins_on_entering(const ModelState& state) const
+{
+	return map->get_type(state.location) == SpaceType::DOMUS_AUREA && state.satchel.contains(PERMIT) &&
+	       (state.flags & HAS_BATHED) && state.stepsSinceBathing <= MAX_STEPS_SINCE_BATHING;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a ModelState at the start of a turn and an array of at least MAX_OPTIONS
+ * 		ModelOptions. Fills the array with the options worth considering on the turn
+ * 		(keeping moving, and whatever entering the space can do, as done by the space's
+ * 		interact function) and the outcomes of each. Winning by entering the Domus Aurea is
+ * 		not listed (see wins_on_entering). Returns the number of options.
+ ***************************************************************************************************/
+
+int GameModel::list_options(const ModelState& state, ModelOption options[]) const
+{
+	int numOptions = 0;
+	options[numOptions++] = {TurnAction::KEEP_MOVING, Satchel(), 1, {{1.0, false, state}}};
+
+	ModelOption entering = {TurnAction::ENTER, Satchel(), 1, {{1.0, false, state}}};
+	ModelState& after = entering.outcomes[0].after;
+
+	switch (map->get_type(state.location))
+	{
+		// The librarian asks for the scroll, or takes it and gives a reward
+		case SpaceType::BIBLIOTHECA:
+			if (!(state.flags & KNOWS_ABOUT_SCROLL))
+			{
+				after.flags |= KNOWS_ABOUT_SCROLL;
+			}
+			else if (!(state.flags & RETURNED_SCROLL) && state.satchel.contains(SCROLL))
+			{
+				after.money += SCROLL_REWARD;
+				after.satchel.erase(SCROLL);
+				after.flags |= RETURNED_SCROLL;
+			}
+			break;
+
+		// Winning is checked separately (see wins_on_entering)
+		case SpaceType::DOMUS_AUREA:
+			break;
+
+		// The magister hands over the scroll (only once), and the player plays trivia
+		case SpaceType::LUDUS:
+			if ((state.flags & KNOWS_ABOUT_SCROLL) && !(state.flags & OBTAINED_SCROLL) && !state.satchel.full())
+			{
+				after.satchel.insert(SCROLL);
+				after.flags |= OBTAINED_SCROLL;
+			}
+			if (state.gamesPlayed < NUM_GAMES)
+			{
+				after.gamesPlayed++;
+				entering.outcomes[1] = entering.outcomes[0];
+				entering.outcomes[0].probability = 1.0 - TRIVIA_TIE_CHANCE;
+				entering.outcomes[0].after.money += TRIVIA_WIN_PRIZE;
+				entering.outcomes[1].probability = TRIVIA_TIE_CHANCE;
+				entering.outcomes[1].after.money += TRIVIA_TIE_PRIZE;
+				entering.numOutcomes = 2;
+			}
+			break;
+
+		// The player makes any bet they can afford, and wins or loses it
+		case SpaceType::CIRCUS_MAXIMUS:
+			for (int bet : {HIGH_BET, MEDIUM_BET, LOW_BET})
+			{
+				if (state.money >= bet)
+				{
+					ModelOption betting = {TurnAction::ENTER, Satchel(), 2, {{RACE_WIN_CHANCE, false, state},
+						{1.0 - RACE_WIN_CHANCE, false, state}}};
+					betting.outcomes[0].after.money += bet;
+					betting.outcomes[1].after.money -= bet;
+					betting.bet = bet;
+					cap_money(betting.outcomes[0].after);
+					options[numOptions++] = betting;
+				}
+			}
+			return numOptions;
+
+		// The player buys any of the items the prefect wants that they can afford and carry
+		case SpaceType::FORUM:
+			for (int choice = 1; choice < 4; choice++)
+			{
+				bool buyExpensive = (choice & 1);
+				bool buyCheap = (choice & 2);
+				int cost = (buyExpensive ? EXPENSIVE_PRICE : 0) + (buyCheap ? CHEAP_PRICE : 0);
+				bool needed = !state.satchel.contains(PERMIT) &&
+					      (!buyExpensive || (!(state.flags & GAVE_EXPENSIVE) && !state.satchel.contains(expensiveChoice))) &&
+					      (!buyCheap || (!(state.flags & GAVE_CHEAP) && !state.satchel.contains(cheapChoice)));
+				if (!needed || cost > state.money || state.satchel.size() + buyExpensive + buyCheap > SATCHEL_CAPACITY)
+				{
+					continue;
+				}
+
+				ModelOption buying = {TurnAction::BUY, Satchel(), 1, {{1.0, false, state}}};
+				buying.outcomes[0].after.money -= cost;
+				if (buyExpensive)
+				{
+					buying.items.insert(expensiveChoice);
+					buying.outcomes[0].after.satchel.insert(expensiveChoice);
+				}
+				if (buyCheap)
+				{
+					buying.items.insert(cheapChoice);
+					buying.outcomes[0].after.satchel.insert(cheapChoice);
+				}
+				options[numOptions++] = buying;
+			}
+			return numOptions;
+
+		// The player donates every item that is of no use to them
+		case SpaceType::THEATRUM:
+			entering.action = TurnAction::DONATE;
+			for (ItemId item = 0; item < NUM_ITEMS; item++)
+			{
+				bool wanted = (item == expensiveChoice && !(state.flags & GAVE_EXPENSIVE)) ||
+					      (item == cheapChoice && !(state.flags & GAVE_CHEAP));
+				if (state.satchel.contains(item) && item != SCROLL && item != PERMIT && !wanted)
+				{
+					entering.items.insert(item);
+					after.satchel.erase(item);
+				}
+			}
+			break;
+
+		// The player wins the battle, loses it and is spared, or loses it and dies
+		case SpaceType::COLOSSEUM:
+			entering.outcomes[0].probability = BATTLE_WIN_CHANCE;
+			entering.outcomes[0].after.money += BATTLE_PRIZE;
+			entering.outcomes[1] = {1.0 - BATTLE_WIN_CHANCE - BATTLE_DEATH_CHANCE, false, state};
+			entering.outcomes[2] = {BATTLE_DEATH_CHANCE, true, state};
+			entering.numOutcomes = 3;
+			break;
+
+		// The player bathes
+		case SpaceType::THERMAE:
+			entering.action = TurnAction::BATHE;
+			if (state.money >= BATH_COST)
+			{
+				after.money -= BATH_COST;
+				after.flags |= HAS_BATHED;
+				after.stepsSinceBathing = 0;
+			}
+			break;
+
+		// The player passes the prefect's test, or gives him the items he wants and
+		// receives the permit once he has both
+		case SpaceType::CAMPUS_MARTIUS:
+			if (!(state.flags & PASSED_TEST))
+			{
+				after.flags |= PASSED_TEST;
+			}
+			else if (!state.satchel.contains(PERMIT))
+			{
+				if (!(state.flags & GAVE_EXPENSIVE) && state.satchel.contains(expensiveChoice))
+				{
+					after.satchel.erase(expensiveChoice);
+					after.flags |= GAVE_EXPENSIVE;
+				}
+				if (!(state.flags & GAVE_CHEAP) && state.satchel.contains(cheapChoice))
+				{
+					after.satchel.erase(cheapChoice);
+					after.flags |= GAVE_CHEAP;
+				}
+				if ((after.flags & GAVE_EXPENSIVE) && (after.flags & GAVE_CHEAP))
+				{
+					after.satchel.insert(PERMIT);
+				}
+			}
+			break;
+	}
+
+	// Leave out entering the space if it would change nothing
+	for (int outcomeNum = 0; outcomeNum < entering.numOutcomes; outcomeNum++)
+	{
+		cap_money(entering.outcomes[outcomeNum].after);
+	}
+	const ModelState& first = entering.outcomes[0].after;
+	if (entering.numOutcomes > 1 || first.money != state.money || first.satchel != state.satchel ||
+	    first.stepsSinceBathing != state.stepsSinceBathing || first.gamesPlayed != state.gamesPlayed || first.flags != state.flags)
+	{
+		options[numOptions++] = entering;
+	}
+	return numOptions;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a ModelState and a direction in which the player can move. Returns the
+ * 		state after moving in that direction, counting the step since bathing if the player
+ * 		has bathed (see Game::move_player).
+ ***************************************************************************************************/
+
+ModelState GameModel::move(const ModelState& state, Direction dir) const
+{
+	ModelState moved = state;
+	moved.location = map->get_neighbor(state.location, dir);
+	if ((moved.flags & HAS_BATHED) && moved.stepsSinceBathing <= MAX_STEPS_SINCE_BATHING)
+	{
+		moved.stepsSinceBathing++;
+	}
+	return moved;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a ModelState and returns it packed into a single 64-bit number (see
+ * 		GameModel.hpp), which uses only the lowest packed_bits() bits. The satchel is
+ * 		relabeled first, so that the number is the same whichever items the prefect wants.
+ ***************************************************************************************************/
+
+std::uint64_t GameModel::pack(const ModelState& state) const
+{
+	std::uint64_t fields = static_cast<std::uint64_t>(state.money) |
+			       (static_cast<std::uint64_t>(relabel(state.satchel.get_bits())) << 6) |
+			       (static_cast<std::uint64_t>(state.stepsSinceBathing) << 14) |
+			       (static_cast<std::uint64_t>(state.gamesPlayed) << 18) |
+			       (static_cast<std::uint64_t>(state.flags) << 22);
+	return (fields << locationBits) | state.location;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a ModelState packed by pack() and returns it unpacked.
+ ***************************************************************************************************/
+
+ModelState GameModel::unpack(std::uint64_t key) const
+{
+	ModelState state;
+	state.location = static_cast<std::uint32_t>(key & ((std::uint64_t(1) << locationBits) - 1));
+	std::uint64_t fields = key >> locationBits;
+	state.money = static_cast<int>(fields & 0x3F);
+	std::uint8_t satchelBits = relabel(static_cast<std::uint8_t>(fields >> 6));
+	for (ItemId item = 0; item < NUM_ITEMS; item++)
+	{
+		if ((satchelBits >> item) & 1)
+		{
+			state.satchel.insert(item);
+		}
+	}
+	state.stepsSinceBathing = static_cast<int>((fields >> 14) & 0xF);
+	state.gamesPlayed = static_cast<int>((fields >> 18) & 0xF);
+	state.flags = static_cast<std::uint8_t>(fields >> 22);
+	return state;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of bits a packed
+ * 		ModelState takes up on this map.
+ ***************************************************************************************************/
+
+int GameModel::packed_bits() const
+{
+	return this->locationBits + PACKED_FIELD_BITS;
+}
+
+
+/***************************************************************************************************
+ * Description: Function that receives a packed ModelState and returns a well-mixed hash of it (the
+ * 		finalizer of SplitMix64), for finding its slot in a hash table.
+ ***************************************************************************************************/
+
+std::uint64_t hash_model_key(std::uint64_t key)
+{
+	key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+	return key ^ (key >> 31);
+}
@@ -0,0 +1,150 @@
+/***************************************************************************************************
+ * Program Name: GameModel.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameModel class that describes the rules of the game compactly, for the engines
+ * 		that search through the moves of a game (the Solver and the Expectimax engine)
+ * 		instead of playing it through the Spaces. It lists what the player can do on a
+ * 		turn, every outcome of each choice with its probability, and the state each outcome
+ * 		leaves the player in, following the interact functions of the spaces and using the
+ * 		constants they use (prices, prizes, bets, the cost of a bath, the steps allowed
+ * 		after bathing, and so on). If the rules of a space change, its part of the model
+ * 		(see GameModel.cpp) must change with it.
+ *
+ * 		Only the parts of the GameState that matter to winning are kept in a ModelState: the
+ * 		location, coins, satchel, whether and how long ago the player bathed, the state of
+ * 		the scroll (including whether the magister has handed it over, since a player may
+ * 		have donated it at the Theatrum, and he never hands it over twice), the number of
+ * 		trivia games played, and the prefect's test and items. stepsSinceBathing is counted
+ * 		up to one more than the most allowed, and coins are counted up to the number the
+ * 		player still needs (the price of each item the prefect wants that they have not yet
+ * 		bought, and a bath), since a player with that many coins can do everything left
+ * 		without earning more.
+ *
+ * 		A ModelState can be packed into a single 64-bit number (for use as a key in hash
+ * 		tables): the location takes as many of the lowest bits as the size of the map needs,
+ * 		followed by the coins, satchel, stepsSinceBathing, number of trivia games played, and
+ * 		flags (PACKED_FIELD_BITS bits in all). The satchel is packed as if the prefect
+ * 		wanted Olive Oil and Grain (the items he wants trading places with those two), so
+ * 		that states of games in which he wants different items, which are alike in every
+ * 		other way, pack to the same number and can share one table of results.
+ *
+ * 		Choices that can never make winning more likely or quicker are left out: the player
+ * 		only buys the items the prefect wants, donates every other item at once, always
+ * 		accepts a trivia challenge, answers every question correctly (trivia, and the
+ * 		prefect's test), and never enters a space where doing so would change nothing.
+ *
+ *		Private data members of the GameModel class include:
+ *		- The map on which the game is played
+ *		- The expensive and cheap items the prefect wants
+ *		- The number of bits taken by the location in a packed ModelState
+ *
+ *		Public member functions of the GameModel class include:
+ *		- A constructor that receives the map and the items the prefect wants
+ *		- A function that returns the ModelState of a GameState
+ *		- A function that returns whether entering the current space wins the game
+ *		- A function that lists the options on a turn and their outcomes
+ *		- A function that moves the player in a direction
+ *		- Functions that pack and unpack a ModelState and return the number of bits it
+ *		  takes up when packed
+ *
+ *		The TurnAction enum class, the bits of the flags of a ModelState, and the ModelState,
+ *		ModelOutcome, and ModelOption structs, and a function that hashes a packed ModelState,
+ *		are also declared in this header file.
+ **************************************************************************************************/
+#ifndef GAMEMODEL_HPP
+#define GAMEMODEL_HPP
+
+#include <cstdint>
+#include <memory>
+#include "Board.hpp"
+
+// Enum class identifying what the player does at a space during a turn (ENTER is entering a
+// space other than the Forum, Theatrum, or Thermae, where the player buys, donates, or bathes)
+enum class TurnAction : std::uint8_t {KEEP_MOVING, ENTER, BUY, DONATE, BATHE};
+
+// Bits of the flags of a ModelState
+const std::uint8_t HAS_BATHED = 1;
+const std::uint8_t KNOWS_ABOUT_SCROLL = 2;
+const std::uint8_t RETURNED_SCROLL = 4;
+const std::uint8_t PASSED_TEST = 8;
+const std::uint8_t GAVE_EXPENSIVE = 16;
+const std::uint8_t GAVE_CHEAP = 32;
+const std::uint8_t OBTAINED_SCROLL = 64;
+const int NUM_MODEL_FLAGS = 7;
+
+// Most coins a ModelState ever holds (enough for both items and a bath)
+const int MONEY_CAP = EXPENSIVE_PRICE + CHEAP_PRICE + BATH_COST;
+
+// Number of bits taken by the fields of a packed ModelState other than the location
+// (6 for the coins, 8 for the satchel, 4 each for stepsSinceBathing and the trivia games
+// played, and the flags)
+const int PACKED_FIELD_BITS = 22 + NUM_MODEL_FLAGS;
+static_assert(MONEY_CAP < (1 << 6), "The coins of a ModelState must fit in 6 bits");
+static_assert(MAX_STEPS_SINCE_BATHING + 1 < (1 << 4), "stepsSinceBathing must fit in 4 bits");
+static_assert(NUM_GAMES < (1 << 4), "The number of trivia games played must fit in 4 bits");
+
+// Most options on a turn and most outcomes of an option
+const int MAX_OPTIONS = 4;
+const int MAX_OUTCOMES = 3;
+
+// Struct holding the parts of the GameState that matter to winning
+struct ModelState
+{
+	std::uint32_t location;
+	int money;
+	Satchel satchel;
+	int stepsSinceBathing;
+	int gamesPlayed;
+	std::uint8_t flags;
+};
+
+// Struct describing one outcome of an option: its probability, whether the player dies,
+// and the state it leaves the player in (before they move)
+struct ModelOutcome
+{
+	double probability;
+	bool dies;
+	ModelState after;
+};
+
+// Struct describing one option on a turn: what the player does, the items bought or donated
+// (for BUY and DONATE), its outcomes (listed from the most to the least favourable), and the
+// coins bet (at the Circus Maximus, 0 otherwise)
+struct ModelOption
+{
+	TurnAction action;
+	Satchel items;
+	int numOutcomes;
+	ModelOutcome outcomes[MAX_OUTCOMES];
+	int bet = 0;
+};
+
+class GameModel
+{
+	private:
+		// Private data members
+		std::shared_ptr<const GameMap> map;
+		ItemId expensiveChoice;
+		ItemId cheapChoice;
+		int locationBits;
+
+		// Private member functions
+		void cap_money(ModelState& state) const;
+		std::uint8_t relabel(std::uint8_t satchelBits) const;
+
+	public:
+		// Public member functions
+		GameModel(std::shared_ptr<const GameMap> map, ItemId expensiveChoice, ItemId cheapChoice);
+		ModelState model_state(const GameState& state) const;
+		bool wins_on_entering(const ModelState& state) const;
+		int list_options(const ModelState& state, ModelOption options[]) const;
+		ModelState move(const ModelState& state, Direction dir) const;
+		std::uint64_t pack(const ModelState& state) const;
+		ModelState unpack(std::uint64_t key) const;
+		int packed_bits() const;
+};
+
+// Function that returns a well-mixed hash of a packed ModelState
+std::uint64_t hash_model_key(std::uint64_t key);
+#endif
@@ -0,0 +1,434 @@
+/***************************************************************************************************
+ * Program Name: GameServer.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameServer class that hosts many players' games in one process, with a fixed pool
+ * 		of worker threads sharing one epoll instance and every socket registered with
+ * 		EPOLLONESHOT so that each connection is served by one worker at a time. See
+ * 		GameServer.hpp.
+ **************************************************************************************************/
+#include "GameServer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Most events a worker takes from the epoll instance at once
+const int MAX_EVENTS = 32;
+
+// Milliseconds a worker waits for events before checking whether the server is stopping
+const int WAIT_TIMEOUT_MS = 100;
+
+// Bytes read from a socket at once
+const int READ_SIZE = 4096;
+
+// Bytes of unwritten output above which a connection's input is no longer read
+// (a player who does not read their output cannot make the server hold unlimited output)
+const size_t MAX_UNWRITTEN = 1 << 20;
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the number of worker threads to use, the table of hints
+ * 		to offer in every game (nullptr, the default, for none), and the name of the log file
+ * 		to which to append the record of every game (empty, the default, for none), and
+ * 		creates the epoll instance. The server does not listen or serve until told to.
+ ***************************************************************************************************/
+
+GameServer::GameServer(int numWorkers, std::shared_ptr<const HintTable> hints, const std::string& replayFileName) : running(false),
+	openConnections(0), acceptedConnections(0), answersGiven(0), hints(std::move(hints)), replayFileName(replayFileName)
+{
+	this->numWorkers = (numWorkers > 0) ? numWorkers : 1;
+	epollFd = epoll_create1(EPOLL_CLOEXEC);
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor that stops the workers, closes every connection and listening socket,
+ * 		and removes the Unix domain socket file (if one was created).
+ ***************************************************************************************************/
+
+GameServer::~GameServer()
+{
+	stop();
+
+	for (Connection* connection : connections)
+	{
+		close(connection->fd);
+		delete connection;
+	}
+	for (Connection* listener : listeners)
+	{
+		close(listener->fd);
+		delete listener;
+	}
+	if (!unixPath.empty())
+	{
+		unlink(unixPath.c_str());
+	}
+	if (epollFd >= 0)
+	{
+		close(epollFd);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the path of a Unix domain socket. Creates the socket (replacing any file
+ * 		left at the path by an earlier server) and listens on it. Returns a bool indicating
+ * 		whether or not the server is now listening on the socket.
+ ***************************************************************************************************/
+
+bool GameServer::listen_unix(const std::string& path)
+{
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	if (path.size() >= sizeof(address.sun_path))
+	{
+		return false;
+	}
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, path.c_str(), path.size());
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		return false;
+	}
+	unlink(path.c_str());
+	if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	unixPath = path;
+	return add_listener(fd);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a port number. Listens on that TCP port of the loopback interface only
+ * 		(the server is meant for players on the same machine). Returns a bool indicating
+ * 		whether or not the server is now listening on the port.
+ ***************************************************************************************************/
+
+bool GameServer::listen_tcp(int port)
+{
+	sockaddr_in address;
+	std::memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(static_cast<uint16_t>(port));
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		return false;
+	}
+	int reuse = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	return add_listener(fd);
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a listening socket and registers it with the
+ * 		epoll instance. Returns a bool indicating whether or not it was registered.
+ ***************************************************************************************************/
+
+bool GameServer::add_listener(int fd)
+{
+	Connection* listener = new Connection{fd, true, nullptr, std::string()};
+
+	epoll_event event;
+	event.events = EPOLLIN | EPOLLONESHOT;
+	event.data.ptr = listener;
+	if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+	{
+		close(fd);
+		delete listener;
+		return false;
+	}
+
+	listeners.push_back(listener);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Starts the worker threads, which serve connections until stop() is called.
+ * 		Receives and returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::start()
+{
+	if (running.exchange(true))
+	{
+		return;
+	}
+	for (int workerNum = 0; workerNum < numWorkers; workerNum++)
+	{
+		workers.emplace_back(&GameServer::worker_loop, this);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Tells the worker threads to stop and waits for each of them to finish serving the
+ * 		events it has already taken. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::stop()
+{
+	running = false;
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	workers.clear();
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function run by each worker thread. Waits on the shared epoll
+ * 		instance and handles each event it is given: accepting new connections on a listening
+ * 		socket or serving a player's connection. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::worker_loop()
+{
+	epoll_event events[MAX_EVENTS];
+	while (running)
+	{
+		int numEvents = epoll_wait(epollFd, events, MAX_EVENTS, WAIT_TIMEOUT_MS);
+		for (int index = 0; index < numEvents; index++)
+		{
+			Connection* connection = static_cast<Connection*>(events[index].data.ptr);
+			if (connection->listening)
+			{
+				accept_connections(connection);
+			}
+			else
+			{
+				serve(connection, events[index].events);
+			}
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a listening socket that is ready. Accepts
+ * 		every pending connection, starts a Session for each one and sends its first screen,
+ * 		then registers the connection with the epoll instance. Finally re-arms the listening
+ * 		socket. Returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::accept_connections(Connection* listener)
+{
+	int fd = accept4(listener->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+	while (fd >= 0)
+	{
+		int noDelay = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+		Connection* connection = new Connection{fd, false, std::unique_ptr<Session>(new Session(hints, replayFileName)), std::string()};
+		connection->session->start(connection->unwritten);
+		acceptedConnections++;
+		openConnections++;
+		{
+			std::lock_guard<std::mutex> lock(connectionsMutex);
+			connections.insert(connection);
+		}
+
+		// The connection is registered only once its first screen has been written (as
+		// much of it as the socket accepts), with every event it waits for, in a single
+		// call. As soon as that call succeeds, another worker may be serving the
+		// connection (or may even have closed it), so it must not be touched afterwards.
+		if (!write_output(connection))
+		{
+			close_connection(connection);
+		}
+		else
+		{
+			epoll_event event;
+			event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+			if (!connection->unwritten.empty())
+			{
+				event.events |= EPOLLOUT;
+			}
+			event.data.ptr = connection;
+			if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+			{
+				close_connection(connection);
+			}
+		}
+
+		fd = accept4(listener->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+	}
+
+	epoll_event event;
+	event.events = EPOLLIN | EPOLLONESHOT;
+	event.data.ptr = listener;
+	epoll_ctl(epollFd, EPOLL_CTL_MOD, listener->fd, &event);
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a player's connection and the events
+ * 		reported for it. Reads all available input and hands it to the connection's Session,
+ * 		then writes as much of the output as the socket accepts. Closes the connection if the
+ * 		player disconnected, an error occurred, a line of input was too long (see
+ * 		Session::receive), or the player chose to exit (once their output has been
+ * 		written). Otherwise, re-arms the connection, asking to be told when
+ * 		it becomes writable if output is still waiting. Returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::serve(Connection* connection, unsigned int events)
+{
+	Session& session = *connection->session;
+	bool disconnected = (events & EPOLLERR) != 0;
+
+	// Read input while there is room for the output it produces
+	if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) && !disconnected)
+	{
+		long answersBefore = session.get_answers_given();
+		char buffer[READ_SIZE];
+		while (connection->unwritten.size() < MAX_UNWRITTEN && !session.finished())
+		{
+			ssize_t bytesRead = read(connection->fd, buffer, sizeof(buffer));
+			if (bytesRead > 0)
+			{
+				// A player whose line never ends is disconnected
+				if (!session.receive(std::string_view(buffer, bytesRead), connection->unwritten))
+				{
+					disconnected = true;
+					break;
+				}
+			}
+			else if (bytesRead == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+			{
+				disconnected = true;
+				break;
+			}
+			else if (errno != EINTR)
+			{
+				break;
+			}
+		}
+		answersGiven += session.get_answers_given() - answersBefore;
+	}
+
+	if (!write_output(connection))
+	{
+		disconnected = true;
+	}
+
+	if (disconnected || (session.finished() && connection->unwritten.empty()))
+	{
+		close_connection(connection);
+		return;
+	}
+
+	epoll_event event;
+	event.events = EPOLLONESHOT;
+	if (!session.finished() && connection->unwritten.size() < MAX_UNWRITTEN)
+	{
+		event.events |= EPOLLIN | EPOLLRDHUP;
+	}
+	if (!connection->unwritten.empty())
+	{
+		event.events |= EPOLLOUT;
+	}
+	event.data.ptr = connection;
+	if (epoll_ctl(epollFd, EPOLL_CTL_MOD, connection->fd, &event) != 0)
+	{
+		close_connection(connection);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a player's connection and writes as much of
+ * 		its unwritten output as the socket accepts without blocking. Returns false if the
+ * 		socket failed (the player is gone), or true otherwise.
+ ***************************************************************************************************/
+
+bool GameServer::write_output(Connection* connection)
+{
+	size_t written = 0;
+	while (written < connection->unwritten.size())
+	{
+		ssize_t bytesWritten = send(connection->fd, connection->unwritten.data() + written,
+					    connection->unwritten.size() - written, MSG_NOSIGNAL);
+		if (bytesWritten > 0)
+		{
+			written += bytesWritten;
+		}
+		else if (bytesWritten < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (bytesWritten < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		{
+			break;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	connection->unwritten.erase(0, written);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a player's connection, closes its socket
+ * 		(which also removes it from the epoll instance), and destroys it with its Session.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void GameServer::close_connection(Connection* connection)
+{
+	{
+		std::lock_guard<std::mutex> lock(connectionsMutex);
+		connections.erase(connection);
+	}
+	close(connection->fd);
+	delete connection;
+	openConnections--;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing and return the number of connections that
+ * 		are open, the number accepted since the server started, and the number of valid
+ * 		answers players have given.
+ ***************************************************************************************************/
+
+long GameServer::get_open_connections() const
+{
+	return this->openConnections;
+}
+
+long GameServer::get_accepted_connections() const
+{
+	return this->acceptedConnections;
+}
+
+long GameServer::get_answers_given() const
+{
+	return this->answersGiven;
+}
@@ -0,0 +1,104 @@
+/***************************************************************************************************
+ * Program Name: GameServer.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameServer class that hosts many players' games in one process. Players connect
+ * 		over a Unix domain socket or a TCP socket on the loopback interface, and each
+ * 		connection gets its own Session (see Session.hpp).
+ *
+ * 		Every socket is registered with a single epoll instance shared by a fixed pool of
+ * 		worker threads, each of which waits on it. Sockets are registered with EPOLLONESHOT,
+ * 		so each readiness event is delivered to exactly one worker, and the socket is not
+ * 		reported again until that worker re-arms it. A connection is therefore only ever
+ * 		handled by one worker at a time, and its Session needs no locking. A player who is
+ * 		thinking about their next answer costs no thread at all: their Session simply waits,
+ * 		suspended, until the next readiness event for their socket.
+ *
+ * 		All sockets are non-blocking. Output that cannot be written right away is kept with
+ * 		the connection and written when the socket becomes writable again.
+ *
+ * 		A Connection struct (the socket, its Session, and its unwritten output) is also
+ * 		declared in this header file.
+ *
+ *		Private data members of the GameServer class include:
+ *		- The epoll instance and the listening sockets (and the path of the Unix socket)
+ *		- The number of worker threads and the threads themselves
+ *		- A flag that tells the workers to stop
+ *		- Counters of open connections, connections accepted, and answers given
+ *		- The table of hints offered in every game (if any), shared by every session
+ *		- The name of the log file to which every session appends its games (if any)
+ *
+ *		Public member functions of the GameServer class include:
+ *		- A constructor (which receives the number of workers and, optionally, the table of
+ *		  hints and the name of the log file) and a destructor (which stops the workers and
+ *		  closes every socket)
+ *		- Functions that listen on a Unix domain socket and on a loopback TCP port
+ *		- Functions that start and stop the workers
+ *		- Accessors for the counters
+ *
+ *		Private member functions wait for events, accept connections, serve a connection,
+ *		write a connection's output, and close a connection.
+ **************************************************************************************************/
+#ifndef GAMESERVER_HPP
+#define GAMESERVER_HPP
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "Session.hpp"
+
+// Struct holding one socket: either a listening socket (with no Session) or a player's connection
+struct Connection
+{
+	int fd;
+	bool listening;
+	std::unique_ptr<Session> session;
+	std::string unwritten;
+};
+
+class GameServer
+{
+	private:
+		// Private data members
+		int epollFd;
+		std::vector<Connection*> listeners;
+		std::string unixPath;
+		int numWorkers;
+		std::vector<std::thread> workers;
+		std::atomic<bool> running;
+		std::atomic<long> openConnections;
+		std::atomic<long> acceptedConnections;
+		std::atomic<long> answersGiven;
+		std::mutex connectionsMutex;
+		std::unordered_set<Connection*> connections;
+		std::shared_ptr<const HintTable> hints;
+		std::string replayFileName;
+
+		// Private member functions
+		bool add_listener(int fd);
+		void worker_loop();
+		void accept_connections(Connection* listener);
+		void serve(Connection* connection, unsigned int events);
+		bool write_output(Connection* connection);
+		void close_connection(Connection* connection);
+
+	public:
+		// Public member functions
+		GameServer(int numWorkers, std::shared_ptr<const HintTable> hints = nullptr, const std::string& replayFileName = "");
+		~GameServer();
+		bool listen_unix(const std::string& path);
+		bool listen_tcp(int port);
+		void start();
+		void stop();
+		long get_open_connections() const;
+		long get_accepted_connections() const;
+		long get_answers_given() const;
+
+		// The server owns its sockets and threads, so it can never be copied
+		GameServer(const GameServer&) = delete;
+		GameServer& operator=(const GameServer&) = delete;
+};
+#endif
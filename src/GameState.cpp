@@ -0,0 +1,84 @@
+/***************************************************************************************************
+ * Program Name: GameState.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameState struct that holds everything that can change during a game. Copying a
+ * 		GameState takes a snapshot of a game, and assigning one back restores it. This
+ * 		file implements the function that creates the state at the start of a new game
+ * 		and the hashing and equality functions that allow states to be used as keys in
+ * 		hash tables.
+ **************************************************************************************************/
+#include "GameState.hpp"
+#include <cstring>
+#include "HashBytes.hpp"
+#include "Random.hpp"
+
+
+/***************************************************************************************************
+ * Description: Function that receives the game's Random number generator and returns the state
+ * 		at the start of a new game.
+ * 		The player starts in the Forum with no coins and an empty satchel. The random parts
+ * 		of each game are chosen here: the order in which the Ludus asks its trivia questions
+ * 		(shuffled with a Fisher-Yates shuffle) and which expensive item and which cheap item
+ * 		the prefect at the Campus Martius wants.
+ ***************************************************************************************************/
+
+GameState new_game_state(Random& rng)
+{
+	// Zero every member first (the state has no padding, so this zeroes every byte) so
+	// that states that are equal field by field are also equal byte by byte
+	GameState state{};
+
+	state.location = START_LOCATION;
+	state.satchel = Satchel();
+	state.stillAlive = true;
+
+	// Shuffle the order in which the trivia questions are asked
+	for (int index = 0; index < NUM_QUESTIONS; index++)
+	{
+		state.questionOrder[index] = index;
+	}
+	for (int index = NUM_QUESTIONS - 1; index > 0; index--)
+	{
+		int swapIndex = rng.get_int(0, index);
+		std::uint8_t question = state.questionOrder[index];
+		state.questionOrder[index] = state.questionOrder[swapIndex];
+		state.questionOrder[swapIndex] = question;
+	}
+
+	// Randomly select the expensive item and the cheap item the prefect wants
+	const ItemId expensiveItems[] = {OLIVE_OIL, SANDALS, WINE};
+	const ItemId cheapItems[] = {GRAIN, SALT, TUNIC};
+	state.expensiveChoice = expensiveItems[rng.get_int(0, 2)];
+	state.cheapChoice = cheapItems[rng.get_int(0, 2)];
+
+	return state;
+}
+
+
+/***************************************************************************************************
+ * Description: Function that receives a state and returns a hash of all of its bytes (see
+ * 		hash_bytes).
+ ***************************************************************************************************/
+
+std::size_t hash_state(const GameState& state)
+{
+	return hash_bytes(&state, sizeof(GameState));
+}
+
+
+/***************************************************************************************************
+ * Description: Equality operators that receive another state and return whether or not the two
+ * 		states are identical. Since a GameState has no padding, comparing the bytes compares
+ * 		every field.
+ ***************************************************************************************************/
+
+bool GameState::operator==(const GameState& other) const
+{
+	return std::memcmp(this, &other, sizeof(GameState)) == 0;
+}
+
+bool GameState::operator!=(const GameState& other) const
+{
+	return !(*this == other);
+}
@@ -0,0 +1,112 @@
+/***************************************************************************************************
+ * Program Name: GameState.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: GameState struct that holds everything that can change during a game. The Game,
+ * 		the Board, and the Spaces hold no other changing data, so copying a GameState is
+ * 		all it takes to take a snapshot of a game, and assigning one back restores the
+ * 		game to that exact point (without reconstructing the Board or rereading any files).
+ *
+ * 		The struct contains only fixed-size fields (laid out so that none needs padding
+ * 		before it, with the few bytes left over at the end declared explicitly), so it has
+ * 		no padding, can be copied with memcpy, fits in two cache lines, and can be hashed
+ * 		and compared byte by byte. Equality operators and a std::hash specialization
+ * 		allow states to be used as keys in hash tables (such as transposition tables
+ * 		used by solvers and bots).
+ *
+ * 		Data members of the struct include the following:
+ * 		- An int indicating how many coins the player has
+ * 		- Ints indicating the number of steps taken and the number of steps taken since bathing
+ * 		- An int indicating the index (space number - 1) of the space where the player is
+ * 		  (32 bits wide so that maps loaded from map files can have millions of spaces)
+ * 		- A Satchel representing the items the player is carrying
+ * 		- Bools indicating whether or not the player has bathed, knows about the scroll, is
+ * 		  still alive, is with Nero, and whether or not the game is over
+ * 		- The Ludus's state: whether the scroll has been given to the player, the number of
+ * 		  trivia games played, the number of questions asked, and the (shuffled) order in
+ * 		  which questions are asked
+ * 		- The Bibliotheca's state: whether the scroll has been returned
+ * 		- The Campus Martius's state: whether the player has passed the prefect's test, which
+ * 		  expensive and cheap items the prefect wants, and which of them have been given
+ *
+ * 		A function that returns the state at the start of a new game is also declared.
+ **************************************************************************************************/
+#ifndef GAMESTATE_HPP
+#define GAMESTATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "Satchel.hpp"
+
+// Total number of questions in the Ludus questions file (and in the question order of each game)
+const int NUM_QUESTIONS = 50;
+
+// Location (space number - 1) at which the player starts each game on the map of Rome (the Forum)
+const int START_LOCATION = 4;
+
+struct GameState
+{
+	// Player
+	std::uint32_t location;
+	std::int16_t money;
+	std::uint8_t stepsTaken;
+	std::uint8_t stepsSinceBathing;
+	Satchel satchel;
+	bool hasBathed;
+	bool knowsAboutScroll;
+	bool stillAlive;
+	bool withNero;
+	bool gameOver;
+
+	// Ludus
+	bool obtainedScroll;
+	std::uint8_t gamesPlayed;
+	std::uint8_t questionsAsked;
+	std::uint8_t questionOrder[NUM_QUESTIONS];
+
+	// Bibliotheca
+	bool returnedScroll;
+
+	// Campus Martius
+	bool hasPassedTest;
+	ItemId expensiveChoice;
+	ItemId cheapChoice;
+	bool hasGivenExpensive;
+	bool hasGivenCheap;
+
+	// Bytes left over at the end of the struct (always zero), declared so
+	// that the compiler does not add padding of its own
+	std::uint8_t unused[3];
+
+	bool operator==(const GameState& other) const;
+	bool operator!=(const GameState& other) const;
+};
+
+// The state must stay a small plain struct without padding so that it can be
+// copied with memcpy and hashed and compared byte by byte
+static_assert(std::is_trivially_copyable<GameState>::value, "GameState must be trivially copyable");
+static_assert(sizeof(GameState) == 26 + NUM_QUESTIONS, "GameState must not contain padding");
+static_assert(sizeof(GameState) <= 128, "GameState must fit in two cache lines");
+
+// Function that returns the state at the start of a new game
+// (with its random parts drawn from the game's Random number generator)
+class Random;
+GameState new_game_state(Random& rng);
+
+// Function that returns a hash of all bytes of a state
+std::size_t hash_state(const GameState& state);
+
+namespace std
+{
+	template <>
+	struct hash<GameState>
+	{
+		std::size_t operator()(const GameState& state) const
+		{
+			return hash_state(state);
+		}
+	};
+}
+#endif
@@ -0,0 +1,44 @@
+/***************************************************************************************************
+ * Program Name: HashBytes.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Function that hashes a block of bytes. See HashBytes.hpp.
+ **************************************************************************************************/
+#include "HashBytes.hpp"
+#include <cstdint>
+#include <cstring>
+
+
+/***************************************************************************************************
+ * Description: Function that receives a pointer to a block of bytes and its size and returns a hash
+ * 		of all of the bytes. The bytes are read eight at a time, and each word is mixed into
+ * 		the hash with a multiply and xor-shift so that every bit of the block affects every
+ * 		bit of the hash.
+ ***************************************************************************************************/
+
+std::size_t hash_bytes(const void* data, std::size_t size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	std::uint64_t hash = 0x9E3779B97F4A7C15ULL ^ size;
+
+	std::size_t offset = 0;
+	while (offset < size)
+	{
+		// Read the next (up to) eight bytes as one word
+		std::uint64_t word = 0;
+		std::size_t count = size - offset;
+		if (count > sizeof(word))
+		{
+			count = sizeof(word);
+		}
+		std::memcpy(&word, bytes + offset, count);
+		offset += count;
+
+		hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 32;
+	}
+
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 29;
+	return static_cast<std::size_t>(hash);
+}
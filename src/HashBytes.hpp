@@ -0,0 +1,19 @@
+/***************************************************************************************************
+ * Program Name: HashBytes.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Function that hashes a block of bytes, shared by the types that are hashed byte by
+ * 		byte (the GameState and the Adjacency table, see hash_state and hash_adjacency, and
+ * 		the tables of a GameMap, see GameMap::fingerprint). Such types contain only bytes
+ * 		and no padding, so two values that are equal field by field have the same bytes and
+ * 		therefore the same hash.
+ **************************************************************************************************/
+#ifndef HASHBYTES_HPP
+#define HASHBYTES_HPP
+
+#include <cstddef>
+
+// Function that returns a hash of the received number of bytes
+std::size_t hash_bytes(const void* data, std::size_t size);
+
+#endif
@@ -0,0 +1,153 @@
+/***************************************************************************************************
+ * Program Name: HeadlessIO.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: HeadlessIO class that is a child of the abstract GameIO class. Allows the game
+ * 		engine to be driven by a program (such as a bot used for balance testing) instead
+ * 		of a person at a terminal. Menu choices are requested from a DecisionSource,
+ * 		game text is discarded without being formatted, pauses and screen clears do
+ * 		nothing, and structured events are forwarded to an optional EventSink.
+ *
+ * 		The DecisionSource, EventSink, and RandomDecisionSource classes are also
+ * 		implemented in this file.
+ **************************************************************************************************/
+#include "HeadlessIO.hpp"
+
+
+/***************************************************************************************************
+ * Description: Virtual destructors for the abstract DecisionSource and EventSink classes.
+ * 		Bodies are empty since neither class owns any resources.
+ ***************************************************************************************************/
+
+DecisionSource::~DecisionSource()
+{
+}
+
+EventSink::~EventSink()
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the seed of the RandomDecisionSource's Random number
+ * 		generator (an unpredictable seed by default).
+ ***************************************************************************************************/
+
+RandomDecisionSource::RandomDecisionSource(std::uint64_t seed) : rng(seed)
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt (unused) and the menu choices. Returns a randomly
+ * 		selected choice number between 1 and the number of choices.
+ ***************************************************************************************************/
+
+int RandomDecisionSource::choose([[maybe_unused]] Prompt prompt, MenuChoices menuChoices)
+{
+	return rng.get_int(1, menuChoices.size());
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the DecisionSource from which menu choices are
+ * 		requested and a pointer to the EventSink to which events are forwarded
+ * 		(nullptr if events should be discarded). The null stream is constructed
+ * 		without a stream buffer, which puts it in a failed state so that
+ * 		anything written to it is discarded before any formatting takes place.
+ ***************************************************************************************************/
+
+HeadlessIO::HeadlessIO(DecisionSource& decisions, EventSink* events) : nullStream(nullptr)
+{
+	this->decisions = &decisions;
+	this->events = events;
+	decisionsMade = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual destructor for HeadlessIO class. The DecisionSource and EventSink
+ * 		are owned by the calling code, so the pointers to them are simply set to nullptr.
+ ***************************************************************************************************/
+
+HeadlessIO::~HeadlessIO()
+{
+	decisions = nullptr;
+	events = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the null stream so that game text is discarded.
+ ***************************************************************************************************/
+
+std::ostream& HeadlessIO::out()
+{
+	return nullStream;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt and the menu choices and asks the DecisionSource for a
+ * 		choice. Just like the menu utility function used at the terminal, the choice is
+ * 		requested again until it is between 1 and the number of choices. Returns the
+ * 		validated choice.
+ ***************************************************************************************************/
+
+int HeadlessIO::menu(Prompt prompt, MenuChoices menuChoices)
+{
+	int menuChoiceNumber = decisions->choose(prompt, menuChoices);
+	while (menuChoiceNumber < 1 || menuChoiceNumber > static_cast<int>(menuChoices.size()))
+	{
+		menuChoiceNumber = decisions->choose(prompt, menuChoices);
+	}
+	decisionsMade++;
+
+	return menuChoiceNumber;
+}
+
+
+/***************************************************************************************************
+ * Description: Pauses do nothing when there is nobody reading the screen.
+ * 		Receives and returns nothing.
+ ***************************************************************************************************/
+
+void HeadlessIO::press_enter()
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Screen clears do nothing since nothing is displayed.
+ * 		Receives and returns nothing.
+ ***************************************************************************************************/
+
+void HeadlessIO::clear_screen()
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the type and value of a structured event and forwards it to the
+ * 		EventSink (if one was provided). Returns nothing.
+ ***************************************************************************************************/
+
+void HeadlessIO::event(EventType type, int value)
+{
+	if (events != nullptr)
+	{
+		GameEvent gameEvent = {type, value};
+		events->on_event(gameEvent);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of menu decisions
+ * 		that have been made through this HeadlessIO object.
+ ***************************************************************************************************/
+
+int HeadlessIO::get_decisions_made() const
+{
+	return this->decisionsMade;
+}
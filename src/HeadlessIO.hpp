@@ -0,0 +1,78 @@
+/***************************************************************************************************
+ * Program Name: HeadlessIO.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: HeadlessIO class that is a child of the abstract GameIO class. Allows the game
+ * 		engine to be driven by a program (such as a bot used for balance testing) instead
+ * 		of a person at a terminal. Menu choices are requested from a DecisionSource,
+ * 		game text is discarded without being formatted, pauses and screen clears do
+ * 		nothing, and structured events are forwarded to an optional EventSink.
+ *
+ * 		The following abstract classes are also declared in this header file:
+ * 		- DecisionSource (supplies the choice for each menu given the prompt and its choices)
+ * 		- EventSink (receives each structured event emitted by the engine)
+ *
+ * 		The RandomDecisionSource class is a DecisionSource that picks a random
+ * 		menu choice at every prompt, drawn from its own Random number generator (created
+ * 		from an explicit seed, so a bot's choices can be reproduced too).
+ *
+ *		Private data members of the HeadlessIO class include:
+ *		- A pointer to the DecisionSource from which menu choices are requested
+ *		- A pointer to the EventSink to which events are forwarded (nullptr if none)
+ *		- An output stream with no buffer (all output written to it is discarded)
+ *		- An int counting the number of decisions made
+ *
+ *		Public member functions of the HeadlessIO class include:
+ *		- A constructor and destructor
+ *		- The implementations of the pure virtual functions of the GameIO class
+ *		- An accessor method for the number of decisions made
+ **************************************************************************************************/
+#ifndef HEADLESSIO_HPP
+#define HEADLESSIO_HPP
+
+#include "GameIO.hpp"
+#include "Random.hpp"
+
+class DecisionSource
+{
+	public:
+		virtual ~DecisionSource();
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) = 0;
+};
+
+class EventSink
+{
+	public:
+		virtual ~EventSink();
+		virtual void on_event(const GameEvent& gameEvent) = 0;
+};
+
+class RandomDecisionSource : public DecisionSource
+{
+	private:
+		Random rng;
+
+	public:
+		RandomDecisionSource(std::uint64_t seed = Random::random_seed());
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) override;
+};
+
+class HeadlessIO : public GameIO
+{
+	private:
+		DecisionSource* decisions;
+		EventSink* events;
+		std::ostream nullStream;
+		int decisionsMade;
+
+	public:
+		HeadlessIO(DecisionSource& decisions, EventSink* events = nullptr);
+		virtual ~HeadlessIO();
+		virtual std::ostream& out() override;
+		virtual int menu(Prompt prompt, MenuChoices menuChoices) override;
+		virtual void press_enter() override;
+		virtual void clear_screen() override;
+		virtual void event(EventType type, int value = 0) override;
+		int get_decisions_made() const;
+};
+#endif
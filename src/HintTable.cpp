@@ -0,0 +1,580 @@
+/***************************************************************************************************
+ * Program Name: HintTable.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: HintTable class that answers requests for hints with a single lookup in a table,
+ * 		built ahead of time, of the best choice in every state a game can reach, found with
+ * 		a perfect hash function and mapped into memory with mmap. See HintTable.hpp.
+ **************************************************************************************************/
+#include "HintTable.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Expectimax.hpp"
+
+// Slot of the table that holds no entry (no entry has an answer of 0xFF)
+const std::uint32_t EMPTY_SLOT = 0xFFFFFFFF;
+
+// Average number of keys in a bucket, and number of slots for every 8 keys
+const std::uint32_t KEYS_PER_BUCKET = 4;
+const std::uint32_t SLOTS_PER_8_KEYS = 9;
+
+// Number of seeds of the hash function to try before giving up on building a table
+const int MAX_SEEDS = 64;
+
+// Largest difference between two probabilities of winning that are treated as the same
+const double SAME_PROBABILITY = 1e-9;
+
+// Struct holding the places of a key in the table: its bucket, the slot it goes to with a
+// displacement of 0, the step between the slots of successive displacements, and its fingerprint
+struct KeyHash
+{
+	std::uint32_t bucket;
+	std::uint32_t first;
+	std::uint32_t step;
+	std::uint32_t fingerprint;
+};
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a key, the seed of the hash function, and the numbers
+ * 		of buckets and slots of a table. Returns the KeyHash of the key.
+ ***************************************************************************************************/
+
+static KeyHash hash_key(std::uint64_t key, std::uint64_t seed, std::uint32_t numBuckets, std::uint32_t numSlots)
+{
+	std::uint64_t hash = hash_model_key(key ^ seed);
+	std::uint64_t second = hash_model_key(hash);
+	KeyHash keyHash;
+	keyHash.bucket = static_cast<std::uint32_t>((hash >> 32) % numBuckets);
+	keyHash.first = static_cast<std::uint32_t>((hash & 0xFFFFFFFF) % numSlots);
+	keyHash.step = static_cast<std::uint32_t>((second & 0xFFFFFFFF) % (numSlots - 1)) + 1;
+	keyHash.fingerprint = static_cast<std::uint32_t>(second >> 40);
+	return keyHash;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a KeyHash, a displacement, and the number of slots of
+ * 		a table. Returns the slot the key goes to with that displacement.
+ ***************************************************************************************************/
+
+static std::uint32_t slot_of(const KeyHash& keyHash, std::uint32_t displacement, std::uint32_t numSlots)
+{
+	return static_cast<std::uint32_t>((keyHash.first + static_cast<std::uint64_t>(displacement) * keyHash.step) % numSlots);
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the GameModel of a game, a ModelState, the number of
+ * 		steps left, and whether the player is at the start of a turn (or has finished at the
+ * 		space). Returns the key of the state's entry in a table of hints.
+ ***************************************************************************************************/
+
+static std::uint64_t hint_key(const GameModel& model, const ModelState& state, int stepsLeft, bool startOfTurn)
+{
+	std::uint64_t prefix = (static_cast<std::uint64_t>(stepsLeft) << 1) | (startOfTurn ? 1 : 0);
+	return (prefix << model.packed_bits()) | model.pack(state);
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the highest value a choice can have, the most steps
+ * 		allowed, and a function returning the value of the best choice with a given number
+ * 		of steps left (which never falls as the steps left grow). Returns the fewest steps
+ * 		with which the best choice is worth (nearly) as much as with the most allowed,
+ * 		found with a binary search.
+ ***************************************************************************************************/
+
+template <typename ValueFunction>
+static int fewest_steps(double best, int mostSteps, ValueFunction valueWith)
+{
+	int low = 0;
+	int high = mostSteps;
+	while (low < high)
+	{
+		int middle = (low + high) / 2;
+		if (valueWith(middle) >= best - SAME_PROBABILITY)
+		{
+			high = middle;
+		}
+		else
+		{
+			low = middle + 1;
+		}
+	}
+	return low;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the map of the games the table is used for. The table
+ * 		starts closed (see open).
+ ***************************************************************************************************/
+
+HintTable::HintTable(std::shared_ptr<const GameMap> map)
+{
+	this->map = std::move(map);
+	data = nullptr;
+	dataSize = 0;
+	header = nullptr;
+	displacements = nullptr;
+	slots = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor that unmaps the table file (if one is mapped).
+ ***************************************************************************************************/
+
+HintTable::~HintTable()
+{
+	close();
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that unmaps the table file (if one is mapped) and forgets
+ * 		its tables. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void HintTable::close()
+{
+	if (data != nullptr)
+	{
+		munmap(const_cast<char*>(data), dataSize);
+	}
+	data = nullptr;
+	dataSize = 0;
+	header = nullptr;
+	displacements = nullptr;
+	slots = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a table file and maps it into memory. Returns true if the file
+ * 		was mapped and is a valid table of this version for the map, or false (with nothing
+ * 		mapped) if the file does not exist, is not a valid table, or was built for another
+ * 		map.
+ ***************************************************************************************************/
+
+bool HintTable::open(const char* fileName)
+{
+	close();
+
+	int fd = ::open(fileName, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat fileInfo;
+	if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size < static_cast<off_t>(sizeof(HintHeader)))
+	{
+		::close(fd);
+		return false;
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	std::size_t size = static_cast<std::size_t>(fileInfo.st_size);
+	void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+	data = static_cast<const char*>(mapping);
+	dataSize = size;
+
+	// Locate the displacements and the slots, which follow the header, and check that they
+	// lie within the file
+	header = reinterpret_cast<const HintHeader*>(data);
+	std::size_t displacementBytes = (static_cast<std::size_t>(header->numBuckets) * sizeof(std::uint16_t) + 3) / 4 * 4;
+	displacements = reinterpret_cast<const std::uint16_t*>(data + sizeof(HintHeader));
+	slots = reinterpret_cast<const std::uint32_t*>(data + sizeof(HintHeader) + displacementBytes);
+	if (header->magic != HINT_MAGIC || header->version != HINT_VERSION || header->numBuckets == 0 || header->numSlots < 2 ||
+	    sizeof(HintHeader) + displacementBytes + static_cast<std::size_t>(header->numSlots) * sizeof(std::uint32_t) != size ||
+	    header->mapFingerprint != map->fingerprint())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing and return whether a table is open, and the
+ * 		number of entries in it (0 if none is open).
+ ***************************************************************************************************/
+
+bool HintTable::is_open() const
+{
+	return data != nullptr;
+}
+
+std::size_t HintTable::num_entries() const
+{
+	return (data != nullptr) ? this->header->numEntries : 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a key and a number passed by reference. Looks
+ * 		up the key's slot with the perfect hash function. Returns true and stores the answer
+ * 		of the entry in "answer" if the slot holds the key's entry, or returns false if the
+ * 		key has no entry.
+ ***************************************************************************************************/
+
+bool HintTable::lookup(std::uint64_t key, std::uint8_t& answer) const
+{
+	KeyHash keyHash = hash_key(key, header->seed, header->numBuckets, header->numSlots);
+	std::uint32_t slot = slots[slot_of(keyHash, displacements[keyHash.bucket], header->numSlots)];
+	if (slot == EMPTY_SLOT || (slot >> 8) != keyHash.fingerprint)
+	{
+		return false;
+	}
+	answer = static_cast<std::uint8_t>(slot & 0xFF);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a GameModel, a ModelState passed by
+ * 		reference, the steps left, whether the player is at the start of a turn, and a number
+ * 		passed by reference. Looks up the state's entry, and, if it has none, the entry of
+ * 		the same state with fewer coins (see HintTable.hpp), one coin at a time and at most
+ * 		MAX_COIN_RETRIES times. Returns true and stores the answer in "answer" and the coins
+ * 		of the state found in "state", or returns false if none of those has an entry.
+ ***************************************************************************************************/
+
+bool HintTable::find(const GameModel& model, ModelState& state, int stepsLeft, bool startOfTurn, std::uint8_t& answer) const
+{
+	int fewestCoins = state.money > MAX_COIN_RETRIES ? state.money - MAX_COIN_RETRIES : 0;
+	for (int money = state.money; money >= fewestCoins; money--)
+	{
+		ModelState withMoney = state;
+		withMoney.money = money;
+		if (lookup(hint_key(model, withMoney, stepsLeft, startOfTurn), answer))
+		{
+			state = withMoney;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn and a ModelOption passed by
+ * 		reference. Returns true and stores the best option on the turn in "option" (entering
+ * 		the space, if that wins the game), or returns false if no table is open or the state
+ * 		has no entry.
+ ***************************************************************************************************/
+
+bool HintTable::best_option(const GameState& state, ModelOption& option) const
+{
+	if (data == nullptr || state.gameOver || state.stepsTaken > MAX_STEPS)
+	{
+		return false;
+	}
+
+	GameModel model(map, state.expensiveChoice, state.cheapChoice);
+	ModelState modelState = model.model_state(state);
+	if (model.wins_on_entering(modelState))
+	{
+		option = {TurnAction::ENTER, Satchel(), 1, {{1.0, false, modelState}}};
+		return true;
+	}
+
+	std::uint8_t answer = 0;
+	if (!find(model, modelState, MAX_STEPS - state.stepsTaken, true, answer))
+	{
+		return false;
+	}
+	ModelOption options[MAX_OPTIONS];
+	int numOptions = model.list_options(modelState, options);
+	if (answer >= numOptions)
+	{
+		return false;
+	}
+	option = options[answer];
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game once the player has finished at the space and a
+ * 		Direction passed by reference. Returns true and stores the best direction in which to
+ * 		move in "dir", or returns false if no table is open or the state has no entry.
+ ***************************************************************************************************/
+
+bool HintTable::best_direction(const GameState& state, Direction& dir) const
+{
+	if (data == nullptr || state.gameOver || state.stepsTaken >= MAX_STEPS)
+	{
+		return false;
+	}
+
+	GameModel model(map, state.expensiveChoice, state.cheapChoice);
+	ModelState modelState = model.model_state(state);
+	std::uint8_t answer = 0;
+	if (!find(model, modelState, MAX_STEPS - state.stepsTaken, false, answer) || answer >= NUM_DIRECTIONS ||
+	    !map->is_valid_move(state.location, static_cast<Direction>(answer)))
+	{
+		return false;
+	}
+	dir = static_cast<Direction>(answer);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives a map and an Expectimax engine for it. Walks through
+ * 		the states of the GameModel that can be reached from the start of a game, one number
+ * 		of steps left at a time (so that only the states of one number of steps left are
+ * 		held at once), and finds the best choice in each from which the player can still
+ * 		win: the one that makes winning most likely with the fewest steps with which it is
+ * 		as likely as with the steps left. Then builds the perfect hash function of their
+ * 		keys (trying seeds until every bucket can be displaced). Returns the bytes of the
+ * 		table. Throws std::runtime_error if the map is too large for the keys of the table
+ * 		or no seed works.
+ ***************************************************************************************************/
+
+std::string HintTable::build(std::shared_ptr<const GameMap> map, const Expectimax& engine)
+{
+	// The prefect's items are labelled as the packed ModelStates label them
+	GameModel model(map, OLIVE_OIL, GRAIN);
+	if (model.packed_bits() + 8 > 64 - 8)
+	{
+		throw std::runtime_error("The map is too large for a table of hints");
+	}
+
+	Random rng(0);
+	GameState start = new_game_state(rng);
+	start.location = map->get_start();
+
+	// Returns the value of the best option of a state at the start of a turn with some steps
+	// left, and the best direction in which to move after an option's outcome
+	auto option_value = [&](const ModelOption& option, std::uint32_t location, int stepsLeft)
+	{
+		double expected = 0.0;
+		for (int outcomeNum = 0; outcomeNum < option.numOutcomes && stepsLeft > 0; outcomeNum++)
+		{
+			if (option.outcomes[outcomeNum].dies)
+			{
+				continue;
+			}
+			double bestMove = 0.0;
+			for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+			{
+				if (map->is_valid_move(location, static_cast<Direction>(dirNum)))
+				{
+					bestMove = std::max(bestMove, engine.value(model, model.move(option.outcomes[outcomeNum].after,
+											      static_cast<Direction>(dirNum)), stepsLeft - 1));
+				}
+			}
+			expected += option.outcomes[outcomeNum].probability * bestMove;
+		}
+		return expected;
+	};
+	auto best_move = [&](const ModelState& after, int stepsLeft, int& bestDir)
+	{
+		double bestMove = 0.0;
+		bestDir = -1;
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS && stepsLeft > 0; dirNum++)
+		{
+			if (map->is_valid_move(after.location, static_cast<Direction>(dirNum)))
+			{
+				double moveValue = engine.value(model, model.move(after, static_cast<Direction>(dirNum)), stepsLeft - 1);
+				if (bestDir < 0 || moveValue > bestMove)
+				{
+					bestMove = moveValue;
+					bestDir = dirNum;
+				}
+			}
+		}
+		return bestMove;
+	};
+
+	std::vector<std::uint64_t> keys;
+	std::vector<std::uint8_t> answers;
+	std::vector<std::uint64_t> layer = {model.pack(model.model_state(start))};
+	for (int stepsLeft = MAX_STEPS - start.stepsTaken; stepsLeft >= 0 && !layer.empty(); stepsLeft--)
+	{
+		std::vector<std::uint64_t> afterStates;
+		std::vector<std::uint64_t> nextLayer;
+		for (std::uint64_t packed : layer)
+		{
+			ModelState state = model.unpack(packed);
+			double best = engine.value(model, state, stepsLeft);
+			if (model.wins_on_entering(state) || best == 0.0)
+			{
+				continue;
+			}
+
+			// Choose the option that is best with the fewest steps that make winning as
+			// likely as it is with every step left
+			ModelOption options[MAX_OPTIONS];
+			int numOptions = model.list_options(state, options);
+			int steps = fewest_steps(best, stepsLeft, [&](int stepsAllowed)
+			{
+				return engine.value(model, state, stepsAllowed);
+			});
+			int bestOption = 0;
+			double bestValue = -1.0;
+			for (int optionNum = 0; optionNum < numOptions; optionNum++)
+			{
+				double optionValue = option_value(options[optionNum], state.location, steps);
+				if (optionValue > bestValue)
+				{
+					bestValue = optionValue;
+					bestOption = optionNum;
+				}
+			}
+			keys.push_back(hint_key(model, state, stepsLeft, true));
+			answers.push_back(static_cast<std::uint8_t>(bestOption));
+
+			// Every outcome of every option can be reached (the player may choose any)
+			for (int optionNum = 0; optionNum < numOptions; optionNum++)
+			{
+				for (int outcomeNum = 0; outcomeNum < options[optionNum].numOutcomes; outcomeNum++)
+				{
+					if (!options[optionNum].outcomes[outcomeNum].dies)
+					{
+						afterStates.push_back(model.pack(options[optionNum].outcomes[outcomeNum].after));
+					}
+				}
+			}
+		}
+
+		// Choose the best direction from every state after an outcome, in the same way
+		std::sort(afterStates.begin(), afterStates.end());
+		afterStates.erase(std::unique(afterStates.begin(), afterStates.end()), afterStates.end());
+		for (std::uint64_t packed : afterStates)
+		{
+			ModelState after = model.unpack(packed);
+			int bestDir = -1;
+			double best = best_move(after, stepsLeft, bestDir);
+			if (best == 0.0)
+			{
+				continue;
+			}
+			int steps = fewest_steps(best, stepsLeft, [&](int stepsAllowed)
+			{
+				int dir = 0;
+				return best_move(after, stepsAllowed, dir);
+			});
+			best_move(after, steps, bestDir);
+			keys.push_back(hint_key(model, after, stepsLeft, false));
+			answers.push_back(static_cast<std::uint8_t>(bestDir));
+
+			for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+			{
+				if (map->is_valid_move(after.location, static_cast<Direction>(dirNum)))
+				{
+					nextLayer.push_back(model.pack(model.move(after, static_cast<Direction>(dirNum))));
+				}
+			}
+		}
+		std::sort(nextLayer.begin(), nextLayer.end());
+		nextLayer.erase(std::unique(nextLayer.begin(), nextLayer.end()), nextLayer.end());
+		layer.swap(nextLayer);
+	}
+
+	// Build the perfect hash function: place the buckets with the most keys first, each with
+	// the smallest displacement that sends all of its keys to empty slots
+	std::uint32_t numEntries = static_cast<std::uint32_t>(keys.size());
+	std::uint32_t numBuckets = numEntries / KEYS_PER_BUCKET + 1;
+	std::uint32_t numSlots = static_cast<std::uint32_t>(static_cast<std::uint64_t>(numEntries) * SLOTS_PER_8_KEYS / 8) + 2;
+	std::vector<std::uint16_t> bucketDisplacements(numBuckets);
+	std::vector<std::uint32_t> tableSlots(numSlots);
+	std::vector<KeyHash> hashes(numEntries);
+	std::vector<std::uint32_t> bucketStarts(numBuckets + 1);
+	std::vector<std::uint32_t> bucketKeys(numEntries);
+	std::vector<std::uint32_t> bucketOrder(numBuckets);
+	std::uint64_t seed = 0;
+	bool placed = false;
+	for (int seedNum = 0; seedNum < MAX_SEEDS && !placed; seedNum++)
+	{
+		seed = hash_model_key(0x48494E54 + seedNum);
+		std::fill(bucketStarts.begin(), bucketStarts.end(), 0);
+		for (std::uint32_t keyNum = 0; keyNum < numEntries; keyNum++)
+		{
+			hashes[keyNum] = hash_key(keys[keyNum], seed, numBuckets, numSlots);
+			bucketStarts[hashes[keyNum].bucket + 1]++;
+		}
+		for (std::uint32_t bucket = 0; bucket < numBuckets; bucket++)
+		{
+			bucketStarts[bucket + 1] += bucketStarts[bucket];
+		}
+		std::vector<std::uint32_t> filled(bucketStarts.begin(), bucketStarts.end() - 1);
+		for (std::uint32_t keyNum = 0; keyNum < numEntries; keyNum++)
+		{
+			bucketKeys[filled[hashes[keyNum].bucket]++] = keyNum;
+		}
+		for (std::uint32_t bucket = 0; bucket < numBuckets; bucket++)
+		{
+			bucketOrder[bucket] = bucket;
+		}
+		std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](std::uint32_t first, std::uint32_t second)
+		{
+			return bucketStarts[first + 1] - bucketStarts[first] > bucketStarts[second + 1] - bucketStarts[second];
+		});
+
+		std::fill(tableSlots.begin(), tableSlots.end(), EMPTY_SLOT);
+		placed = true;
+		for (std::uint32_t bucket : bucketOrder)
+		{
+			std::uint32_t begin = bucketStarts[bucket];
+			std::uint32_t end = bucketStarts[bucket + 1];
+			bool bucketPlaced = (begin == end);
+			for (std::uint32_t displacement = 0; displacement <= 0xFFFF && !bucketPlaced; displacement++)
+			{
+				// Fill the slots of the bucket's keys, emptying them again if one is taken
+				std::uint32_t keyIndex = begin;
+				while (keyIndex < end && tableSlots[slot_of(hashes[bucketKeys[keyIndex]], displacement, numSlots)] == EMPTY_SLOT)
+				{
+					const KeyHash& keyHash = hashes[bucketKeys[keyIndex]];
+					tableSlots[slot_of(keyHash, displacement, numSlots)] = (keyHash.fingerprint << 8) | answers[bucketKeys[keyIndex]];
+					keyIndex++;
+				}
+				if (keyIndex == end)
+				{
+					bucketDisplacements[bucket] = static_cast<std::uint16_t>(displacement);
+					bucketPlaced = true;
+				}
+				while (!bucketPlaced && keyIndex > begin)
+				{
+					keyIndex--;
+					tableSlots[slot_of(hashes[bucketKeys[keyIndex]], displacement, numSlots)] = EMPTY_SLOT;
+				}
+			}
+			if (!bucketPlaced)
+			{
+				placed = false;
+				break;
+			}
+		}
+	}
+	if (!placed)
+	{
+		throw std::runtime_error("No perfect hash function was found for the table of hints");
+	}
+
+	// Write the header, the displacements (padded to a multiple of 4 bytes), and the slots
+	HintHeader tableHeader = {HINT_MAGIC, HINT_VERSION, map->fingerprint(), seed, numBuckets, numSlots, numEntries, 0};
+	std::size_t displacementBytes = (static_cast<std::size_t>(numBuckets) * sizeof(std::uint16_t) + 3) / 4 * 4;
+	std::string bytes(sizeof(HintHeader) + displacementBytes + static_cast<std::size_t>(numSlots) * sizeof(std::uint32_t), '\0');
+	std::memcpy(&bytes[0], &tableHeader, sizeof(HintHeader));
+	std::memcpy(&bytes[sizeof(HintHeader)], bucketDisplacements.data(), numBuckets * sizeof(std::uint16_t));
+	std::memcpy(&bytes[sizeof(HintHeader) + displacementBytes], tableSlots.data(), numSlots * sizeof(std::uint32_t));
+	return bytes;
+}
@@ -0,0 +1,123 @@
+/***************************************************************************************************
+ * Program Name: HintTable.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: HintTable class that answers a player's request for a hint (the best thing to do
+ * 		at the current space, or the best direction in which to move) with a single lookup
+ * 		in a table built ahead of time, instead of a search while the player waits. The
+ * 		table is built by the hint compiler (hintCompiler.cpp, "make Game_Hints.bin"),
+ * 		which walks through every state of the GameModel (see GameModel.hpp) that can be
+ * 		reached from the start of a game on a map and stores the best choice in each, as
+ * 		computed by the Expectimax engine. The table file is mapped into memory with one
+ * 		mmap call, so opening it reads nothing, and the processes (such as the sessions of
+ * 		the game server) using it at the same time share the same physical pages.
+ *
+ * 		Each entry is keyed by the packed ModelState (see GameModel::pack), the steps left
+ * 		before MAX_STEPS, and whether the player is at the start of a turn (the answer being
+ * 		the number of the option, as listed by GameModel::list_options, to take) or has
+ * 		finished at the space (the answer being the number of the direction in which to
+ * 		move). Packed ModelStates do not depend on the items the prefect wants, so one
+ * 		table serves every game on the map. The best choice is the one that makes winning
+ * 		most likely, and, of those, the one that wins in the fewest steps. States from which
+ * 		the player can no longer win, and states the GameModel never reaches (for example,
+ * 		after buying an item the prefect does not want), have no entry. The GameModel lowers
+ * 		the player's coins to those still needed before paying for a bath, so a game can
+ * 		keep a coin or two the model never does; such a state is looked up again with fewer
+ * 		coins (whatever the player can do with fewer coins, they can do with more), at most
+ * 		MAX_COIN_RETRIES times, so a lookup reads at most MAX_COIN_RETRIES + 1 slots.
+ *
+ * 		The keys are found with a perfect hash function built by hashing and displacing:
+ * 		each key's hash picks a bucket, and each bucket holds a displacement, chosen when the
+ * 		table is built, that sends every key in the bucket to its own slot. A lookup hashes
+ * 		the key, reads the displacement of its bucket, and reads one slot, so it touches
+ * 		two places in the table whatever its size. Each slot holds 4 bytes: a fingerprint
+ * 		of the key (another hash of it, which tells apart the keys of states that have no
+ * 		entry, all but about one in 16 million times) and the answer.
+ *
+ * 		The table is laid out as follows (in the byte order of the machine that built it,
+ * 		which is checked by the magic number):
+ * 		- A HintHeader (magic number, version, the fingerprint of the map (see
+ * 		  GameMap::fingerprint), the numbers of buckets, slots, and entries, and the
+ * 		  seed of the hash function)
+ * 		- A 16-bit displacement for each bucket (padded to a multiple of 4 bytes)
+ * 		- A 32-bit slot for each slot
+ *
+ * 		Private data members of the HintTable class include the following:
+ * 		- The map of the games the table is used for
+ * 		- A pointer to the table's bytes, their size, and pointers to each part of it
+ *
+ * 		Public member functions of the HintTable class include the following:
+ * 		- A constructor that receives the map, and a destructor (which unmaps the table)
+ * 		- A function that opens and validates a table file
+ * 		- Functions that look up the best option at the start of a turn and the best
+ * 		  direction in which to move
+ * 		- A static function that builds the bytes of a table for a map
+ **************************************************************************************************/
+#ifndef HINTTABLE_HPP
+#define HINTTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "GameModel.hpp"
+
+// Name of the table file built by the hint compiler
+const char HINT_FILE_NAME[] = "Game_Hints.bin";
+
+// Number identifying a file as a table of hints (also detects a different byte order)
+const std::uint32_t HINT_MAGIC = 0x48494E54;		// "HINT"
+const std::uint32_t HINT_VERSION = 3;			// 2: packed ModelStates hold OBTAINED_SCROLL
+							// 3: the map's fingerprint is GameMap::fingerprint
+
+// Most times a state with no entry is looked up again with one coin fewer (a capped ModelState
+// holds at most MONEY_CAP coins, so no game keeps more coins than that the model does not)
+const int MAX_COIN_RETRIES = MONEY_CAP;
+
+// Struct at the start of a table of hints
+struct HintHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t mapFingerprint;
+	std::uint64_t seed;
+	std::uint32_t numBuckets;
+	std::uint32_t numSlots;
+	std::uint32_t numEntries;
+	std::uint32_t padding;
+};
+
+class Expectimax;
+
+class HintTable
+{
+	private:
+		// Private data members
+		std::shared_ptr<const GameMap> map;
+		const char* data;
+		std::size_t dataSize;
+		const HintHeader* header;
+		const std::uint16_t* displacements;
+		const std::uint32_t* slots;
+
+		// Private member functions
+		bool lookup(std::uint64_t key, std::uint8_t& answer) const;
+		bool find(const GameModel& model, ModelState& state, int stepsLeft, bool startOfTurn, std::uint8_t& answer) const;
+		void close();
+
+	public:
+		// Public member functions
+		HintTable(std::shared_ptr<const GameMap> map);
+		~HintTable();
+		bool open(const char* fileName);
+		bool is_open() const;
+		std::size_t num_entries() const;
+		bool best_option(const GameState& state, ModelOption& option) const;
+		bool best_direction(const GameState& state, Direction& dir) const;
+		static std::string build(std::shared_ptr<const GameMap> map, const Expectimax& engine);
+
+		// A mapping is owned by one table, so a table can never be copied
+		HintTable(const HintTable&) = delete;
+		HintTable& operator=(const HintTable&) = delete;
+};
+#endif
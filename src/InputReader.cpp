@@ -0,0 +1,276 @@
+/***************************************************************************************************
+ * Program Name: InputReader.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: InputReader class that reads lines of user input in large chunks into a buffer and
+ * 		converts the integers on them with std::from_chars. See InputReader.hpp.
+ **************************************************************************************************/
+#include "InputReader.hpp"
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <unistd.h>
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the file descriptor from which to read input and the
+ * 		initial size of the buffer in bytes.
+ ***************************************************************************************************/
+
+InputReader::InputReader(int inputFd, std::size_t capacity) : buffer(capacity > 0 ? capacity : 1)
+{
+	this->inputFd = inputFd;
+	start = 0;
+	end = 0;
+	inputEnded = false;
+	tiedStream = nullptr;
+	linesRead = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Returns the InputReader of standard input, which is created the
+ * 		first time it is asked for and shared by every caller (so that no input it has read
+ * 		ahead is lost).
+ ***************************************************************************************************/
+
+InputReader& InputReader::standard_input()
+{
+	static InputReader standardInput(STDIN_FILENO);
+	return standardInput;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a pointer to an output stream (or nullptr) to flush before each line is
+ * 		read, the way std::cin.tie does. Returns the stream it was tied to before.
+ ***************************************************************************************************/
+
+std::ostream* InputReader::tie(std::ostream* stream)
+{
+	std::ostream* previous = tiedStream;
+	tiedStream = stream;
+	return previous;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a view of a line passed by reference. Points it at the next queued answer
+ * 		if there is one. Otherwise, points it at the next line of input (without the
+ * 		newline), or at its first answer if the line was typed ahead, queuing the rest. The
+ * 		view stays valid until the next line is read. The last line of the input counts even
+ * 		if it does not end in a newline. Returns true, or false if there are no more lines.
+ ***************************************************************************************************/
+
+bool InputReader::read_line(std::string_view& line)
+{
+	// Answer from the queue without displaying the screen of the prompt
+	if (next_answer(queued, line))
+	{
+		return true;
+	}
+
+	if (tiedStream != nullptr)
+	{
+		tiedStream->flush();
+	}
+	if (!read_next_line(line))
+	{
+		return false;
+	}
+	if (is_typed_ahead(line))
+	{
+		queued = line;
+		next_answer(queued, line);
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a view of a line passed by reference and
+ * 		points it at the next line of input (see read_line). Returns true, or false if there
+ * 		are no more lines.
+ ***************************************************************************************************/
+
+bool InputReader::read_next_line(std::string_view& line)
+{
+	std::size_t searched = start;
+	while (true)
+	{
+		const char* newline = static_cast<const char*>(memchr(buffer.data() + searched, '\n', end - searched));
+		if (newline != nullptr)
+		{
+			std::size_t lineEnd = newline - buffer.data();
+			line = std::string_view(buffer.data() + start, lineEnd - start);
+			start = lineEnd + 1;
+			linesRead++;
+			return true;
+		}
+		if (inputEnded)
+		{
+			if (start == end)
+			{
+				return false;
+			}
+			line = std::string_view(buffer.data() + start, end - start);
+			start = end;
+			linesRead++;
+			return true;
+		}
+
+		// Read more input and search only the bytes that were added (fill() may move the
+		// unread bytes to the start of the buffer)
+		std::size_t searchedLength = end - start;
+		fill();
+		searched = start + searchedLength;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives an int passed by reference. Reads the next line of input and checks it
+ * 		(see parse_int). Returns the result of the check (see IntStatus).
+ ***************************************************************************************************/
+
+IntStatus InputReader::read_int(int& value)
+{
+	std::string_view line;
+	if (!read_line(line))
+	{
+		return IntStatus::END_OF_INPUT;
+	}
+	return parse_int(line, value);
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives a line (or answer) and an int passed by reference.
+ * 		Checks the line the same way enterValidInt always has: the line must be an optional
+ * 		dash followed by digits (and nothing else), and the integer must fit in an int.
+ * 		Stores the integer in "value" if it is valid. Returns the result of the check (see
+ * 		IntStatus), which is never END_OF_INPUT.
+ ***************************************************************************************************/
+
+IntStatus InputReader::parse_int(std::string_view line, int& value)
+{
+	if (line.empty() || (!isdigit(static_cast<unsigned char>(line[0])) && line[0] != '-'))
+	{
+		return IntStatus::NOT_INTEGER;
+	}
+	for (std::size_t position = 1; position < line.size(); position++)
+	{
+		if (!isdigit(static_cast<unsigned char>(line[position])))
+		{
+			return IntStatus::NOT_INTEGER;
+		}
+	}
+
+	// A lone dash passes the check above but is not an integer; like an integer that does
+	// not fit in an int, it was always rejected as out of range
+	std::from_chars_result result = std::from_chars(line.data(), line.data() + line.size(), value);
+	if (result.ec != std::errc())
+	{
+		return IntStatus::OUT_OF_RANGE;
+	}
+	return IntStatus::VALID;
+}
+
+
+/***************************************************************************************************
+ * Description: Discards the answers queued from a line typed ahead, so that the next prompt reads
+ * 		a new line (after its screen is displayed). Receives and returns nothing.
+ ***************************************************************************************************/
+
+void InputReader::discard_queued()
+{
+	queued = std::string_view();
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor that returns the number of lines read since the InputReader was created.
+ ***************************************************************************************************/
+
+long InputReader::get_lines_read() const
+{
+	return this->linesRead;
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives a line of input and returns whether or not it was
+ * 		typed ahead: whether it holds at least one word and a space or tab (a line of one
+ * 		word with nothing around it is an answer of its own, read as it always has been).
+ ***************************************************************************************************/
+
+bool InputReader::is_typed_ahead(std::string_view line)
+{
+	return line.find_first_of(" \t") != std::string_view::npos && line.find_first_not_of(" \t") != std::string_view::npos;
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives the rest of a line typed ahead and an answer, both
+ * 		passed by reference. Points "answer" at the next word of the line (or at an empty
+ * 		answer if the word is "enter") and removes the word from "rest". Returns true, or
+ * 		false if the line has no more words (and empties "rest").
+ ***************************************************************************************************/
+
+bool InputReader::next_answer(std::string_view& rest, std::string_view& answer)
+{
+	std::size_t wordStart = rest.find_first_not_of(" \t");
+	if (wordStart == std::string_view::npos)
+	{
+		rest = std::string_view();
+		return false;
+	}
+	std::size_t wordEnd = rest.find_first_of(" \t", wordStart);
+	if (wordEnd == std::string_view::npos)
+	{
+		wordEnd = rest.size();
+	}
+	answer = rest.substr(wordStart, wordEnd - wordStart);
+	rest.remove_prefix(wordEnd);
+	if (answer == "enter")
+	{
+		answer = std::string_view();
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that reads as much input as fits in the buffer with one
+ * 		read call, after moving the unread bytes to the start of the buffer (or doubling the
+ * 		buffer if they fill it). Sets inputEnded if the input has ended or cannot be read.
+ * 		Receives and returns nothing.
+ ***************************************************************************************************/
+
+void InputReader::fill()
+{
+	if (start > 0)
+	{
+		memmove(buffer.data(), buffer.data() + start, end - start);
+		end -= start;
+		start = 0;
+	}
+	if (end == buffer.size())
+	{
+		buffer.resize(buffer.size() * 2);
+	}
+
+	ssize_t bytesRead;
+	do
+	{
+		bytesRead = read(inputFd, buffer.data() + end, buffer.size() - end);
+	} while (bytesRead < 0 && errno == EINTR);
+
+	if (bytesRead <= 0)
+	{
+		inputEnded = true;
+		return;
+	}
+	end += bytesRead;
+}
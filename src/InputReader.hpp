@@ -0,0 +1,115 @@
+/***************************************************************************************************
+ * Program Name: InputReader.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: InputReader class that reads the lines of user input from a file descriptor for the
+ * 		enterValidInt, pressEnter, and menu utility functions. Instead of reading each line
+ * 		into a new string with getline and converting it with stoi (which reports an integer
+ * 		that does not fit in an int by throwing an exception), it reads input in large
+ * 		chunks with the read system call into a buffer it keeps for its whole life, hands
+ * 		out each line as a view into the buffer, and converts integers with std::from_chars.
+ * 		This matters when the game is played by a script or a bot over a pipe, which sends
+ * 		many lines at once: a single read then fetches all of them.
+ *
+ * 		A line must be in one piece to be viewed, so the buffer is not a true ring: when a
+ * 		line runs past the end of the buffer, the unread bytes are moved back to its start
+ * 		(which happens about once per buffer full of input) and the buffer only grows if a
+ * 		single line is longer than the whole buffer.
+ *
+ * 		Like std::cin, an InputReader can be tied to an output stream, which is flushed
+ * 		before each line is read so that the prompt is displayed first. When the input
+ * 		ends (for example when the pipe it is read from is closed), reading a line returns
+ * 		false, and the utility functions throw EndOfInput instead of waiting for a line that
+ * 		will never come.
+ *
+ * 		A line may also answer several prompts at once (type-ahead): a line of words
+ * 		separated by spaces or tabs, such as "1 4 2 enter 3", is queued, and each word
+ * 		answers the next prompt as if it had been typed on a line of its own ("enter"
+ * 		answers as an empty line does, continuing past a pause). A line holding a space or
+ * 		tab was never a valid answer, so no answer that used to be accepted changes. The
+ * 		tied stream is not flushed while answers are queued, so the screens of the prompts
+ * 		they answer are never displayed (the Renderer drops a screen that is cleared before
+ * 		it was displayed), and a script can play a whole game with one line. When one of
+ * 		the queued answers is rejected, the rest of the queue is discarded, so that no
+ * 		answer meant for a later prompt is given to the wrong one.
+ *
+ *		Private data members include the following:
+ *		- The file descriptor from which input is read
+ *		- The buffer, and the positions of the first unread byte and of the end of the input
+ *		  read so far
+ *		- A bool indicating whether or not the input has ended
+ *		- The stream flushed before each line is read
+ *		- The rest of the line whose words are queued as answers
+ *		- The number of lines read
+ *
+ *		Public member functions include the following:
+ *		- A constructor
+ *		- A function that returns the InputReader of standard input
+ *		- A function that ties the InputReader to an output stream
+ *		- Functions that read the next line (or queued answer), and the integer on it
+ *		- A function that checks and converts the integer on a line (also used by the game
+ *		  server's Session, so that both validate answers in exactly the same way)
+ *		- A function that discards the queued answers
+ *		- A function that splits the next answer off a line typed ahead (also used by the
+ *		  game server's Session)
+ *		- An accessor for the number of lines read
+ *
+ *		The IntStatus enum and the EndOfInput exception class are also declared in this
+ *		header file.
+ **************************************************************************************************/
+#ifndef INPUTREADER_HPP
+#define INPUTREADER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+// Result of reading an integer from a line of input
+enum class IntStatus
+{
+	VALID,			// the line held an integer that fits in an int
+	NOT_INTEGER,		// the line was empty or was not an optional dash followed by digits
+	OUT_OF_RANGE,		// the line was an integer (or a lone dash) that does not fit in an int
+	END_OF_INPUT		// there are no more lines
+};
+
+// Exception thrown by the utility functions reading input when the input has ended
+class EndOfInput : public std::runtime_error
+{
+	public:
+		EndOfInput() : std::runtime_error("The input ended") {}
+};
+
+class InputReader
+{
+	private:
+		// Private data members
+		int inputFd;
+		std::vector<char> buffer;
+		std::size_t start;
+		std::size_t end;
+		bool inputEnded;
+		std::ostream* tiedStream;
+		std::string_view queued;
+		long linesRead;
+
+		// Private member functions
+		bool read_next_line(std::string_view& line);
+		void fill();
+
+	public:
+		// Public member functions
+		InputReader(int inputFd, std::size_t capacity = 65536);
+		static InputReader& standard_input();
+		std::ostream* tie(std::ostream* stream);
+		bool read_line(std::string_view& line);
+		IntStatus read_int(int& value);
+		static IntStatus parse_int(std::string_view line, int& value);
+		void discard_queued();
+		long get_lines_read() const;
+		static bool is_typed_ahead(std::string_view line);
+		static bool next_answer(std::string_view& rest, std::string_view& answer);
+};
+#endif
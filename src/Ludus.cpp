@@ -8,28 +8,21 @@
  * 		wants a scroll back from the teacher, they can obtain the scroll from this space.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
- *		The following struct is declared as a private member of the Ludus class:
- *		- Question (a struct containing the text of a trivia question,
- *		  the text of its answer choices, and an int representing the correct choice number).
+ *		The trivia questions (Question structs containing the text of a trivia question,
+ *		the text of its answer choices, and an int representing the correct choice number)
+ *		are loaded once per process by the Content class, and the names of the students are
+ *		constants, so the Ludus class has no private data members of its own.
  *
- *		In addition, the Ludus class contains the following private data members:
- *		- A vector of Question objects
- *		- A vector of strings representing students' names
- *		- A boolean indicating whether or not the player has already
- *		  obtained the scroll from the teacher (that way, once the player
- *		  gives the scroll back to the librarian, the teacher does not
- *		  erroneously try to give it to them again).
- *		- An int indicating the number of trivia games played
- *		- An int indicating how many trivia questions have been asked
+ *		Whether or not the player has already obtained the scroll, the number of trivia games
+ *		played, the number of questions asked, and the order in which questions are asked are
+ *		kept in the GameState so that a Ludus never changes during a game.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -42,74 +35,24 @@
  **************************************************************************************************/
 #include "Ludus.hpp"
 
+// Names of the students who play trivia against the player (one for each game that can be played)
+const char* const STUDENT_NAMES[NUM_GAMES] = {"Cornelius", "Marcus", "Julius", "Philemon", "Quintus"};
+
 /*************************************************************************************************** 
  * Description: Default constructor for Ludus object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  *
- * 		In addition, the Ludus constructor
- * 		initializes all data members of the Ludus class.
- * 		It reads in the questions for the questions vector
- * 		from a text file. It then uses the "random shuffle" function
- * 		of the <algorithm> header file to shuffle order of the questions.
+ * 		The trivia questions are loaded once per process by the Content class,
+ * 		and the order in which they are asked is shuffled for each game by
+ * 		the new_game_state function.
  ***************************************************************************************************/
 
-Ludus::Ludus() : Space("Ludus", 3, "Ludus_Description.txt")
+Ludus::Ludus() : Space("Ludus", 3, Asset::LUDUS_DESCRIPTION)
 {
-	// Read questions from file into vector
-	std::ifstream inputFile("Ludus_Questions.txt");
-	for (int questionNum = 0; questionNum < NUM_QUESTIONS; questionNum++)
-	{
-		Question q;
-		std::string text;
-		
-		// Get question text
-		getline(inputFile, text);
-		q.questionText = text;
-		
-		// Get text of each answer choice
-		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
-		{
-			getline(inputFile, text);
-			q.answerChoices.push_back(text);
-		}
-		
-		// Read in answer number as string and convert to int
-		getline(inputFile, text);
-		q.answerNum = stoi(text);
-		
-		// Add the intialized question to the questions vector
-		questions.push_back(q);
-	}
-	
-	// Close the input file and shuffle the questions
-	inputFile.close();
-
-	// Shuffle the questions a random number of times to make their order more truly random.
-	int shuffleTimes = getRandomInt(1, 50);
-	
-	for (int count = 1; count <= shuffleTimes; count++)
-	{
-		random_shuffle(questions.begin(), questions.end());
-	}
-	
-	// Fill the studentNames vector with 5 Greek/Roman names
-	studentNames.push_back("Cornelius");
-	studentNames.push_back("Marcus");
-	studentNames.push_back("Julius");
-	studentNames.push_back("Philemon");
-	studentNames.push_back("Quintus");
-	
-	// Initialize the remaining data members
-	obtainedScroll = false;
-	gamesPlayed = 0;
-	questionsAsked = 0;
 }
 
 
@@ -128,25 +71,22 @@ Ludus::~Ludus()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		# - a set of strings indicating the items in the player's satchel #
- *		# - an int indicating how much money the player has #
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		# - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned #
- *		  - a bool indicating whether or not the player is still alive
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- satchel: the items in the player's satchel
+ *		- money: how much money the player has
+ *		- knowsAboutScroll: whether or not the player knows about the scroll that
+ *		  the librarian wants to be returned
+ *		- obtainedScroll: whether or not the teacher has already given the player the scroll
+ *		  (so that he does not try to give it to them again after it is returned)
+ *		- gamesPlayed: the number of trivia games played
+ *		- questionsAsked: the number of trivia questions asked
+ *		- questionOrder: the (shuffled) order in which trivia questions are asked
  *
  *		The Ludus's implementation of this function does the following:
  *		- Checks to see if the user knows about the scroll
@@ -158,44 +98,43 @@ Ludus::~Ludus()
  *		  function to implement individual games of trivia.
  ***************************************************************************************************/
 
-void Ludus::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> Ludus::interact(GameIO& io, GameState& state, Random& rng)
 {
-	std::cout << "Welcome to my school!\n";
+	io.out() << "Welcome to my school!\n";
 	
 	// Check to see if the player knows about the scroll. If so, the magister (teacher) tries to give it to them
 	// if he has not done so already.
-	if (obtainedScroll == false && knowsAboutScroll == true)
+	if (state.obtainedScroll == false && state.knowsAboutScroll == true)
 	{
-		std::cout << "Thanks for offering to take the scroll back to the Bibliotheca\n"; 
-		std::cout << "about which that grouchy librarian has been pestering me!\n";
+		io.out() << "Thanks for offering to take the scroll back to the Bibliotheca\n"; 
+		io.out() << "about which that grouchy librarian has been pestering me!\n";
 	
 		// Make sure satchel can hold the scroll. If it can, add the scroll to the user's satchel.
-		if (satchel.size() < SATCHEL_CAPACITY)
+		if (!state.satchel.full())
 		{
-			std::cout << "Here's the scroll!\n";
-			satchel.insert(SCROLL);
-			obtainedScroll = true;
+			io.out() << "Here's the scroll!\n";
+			state.satchel.insert(SCROLL);
+			state.obtainedScroll = true;
 		}
 
 		// Otherwise, prompt the user to come back when they
 		// have room in their satchel for the scroll.
 		else
 		{
-			std::cout << "I see you do not have room in your satchel for the scroll.\n";
-			std::cout << "The theater is collecting unneeded items as donations for the poor.\n";
-			std::cout << "I suggest you go there and then come back if you want that scroll.\n";
+			io.out() << "I see you do not have room in your satchel for the scroll.\n";
+			io.out() << "The theater is collecting unneeded items as donations for the poor.\n";
+			io.out() << "I suggest you go there and then come back if you want that scroll.\n";
 		}
-		pressEnter();
+		co_await io.pause();
 	}
 	
 	// Next, if the user has not already played the max number of trivia games allowed,
 	// ask if they want to play trivia.
-	if (gamesPlayed < NUM_GAMES)
+	if (state.gamesPlayed < NUM_GAMES)
 	{
-		std::cout << "Would you like to prove your knowledge by playing trivia against one of my fine students?\n";
-		std::vector<std::string> triviaMenu = {"Accept the challenge", "Decline the challenge"};
-		int triviaChoice = menu(triviaMenu);
+		io.out() << "Would you like to prove your knowledge by playing trivia against one of my fine students?\n";
+		const std::string_view triviaMenu[] = {"Accept the challenge", "Decline the challenge"};
+		int triviaChoice = co_await io.choose(Prompt::TRIVIA_CHALLENGE, triviaMenu);
 		
 		// If the user has chosen to play trivia, call play_trivia function to run
 		// a game of trivia. Add the return value of money
@@ -203,7 +142,9 @@ void Ludus::interact(std::set<std::string>& satchel, int& money, int& stepsSince
 		// (4 coins if player wins, 2 if ties, 0 if loses).
 		if (triviaChoice == 1)
 		{
-			money += play_trivia();
+			int moneyWon = co_await play_trivia(io, state, rng);
+			io.event(EventType::TRIVIA_FINISHED, moneyWon);
+			state.money += moneyWon;
 		}
 	}
 	
@@ -211,184 +152,189 @@ void Ludus::interact(std::set<std::string>& satchel, int& money, int& stepsSince
 	// allowed in a game, print a message saying that the students have gone home for the day.
 	else
 	{
-		std::cout << "Since my students have gone home for the day, there is no more trivia to play.\n";
-		std::cout << "Have a great day!\n";
+		io.out() << "Since my students have gone home for the day, there is no more trivia to play.\n";
+		io.out() << "Have a great day!\n";
 		
-		pressEnter();
+		co_await io.pause();
 	}
 }
 
 
 /*************************************************************************************************** 
- * Description: Private member function called from within interact function. Simulates
- * 		a game of trivia. Receives no parameters. Returns an int indicating how much money
+ * Description: Private member coroutine called from within interact coroutine. Simulates
+ * 		a game of trivia. Receives the GameState passed by reference so that the number of
+ * 		games played and questions asked can be updated, and the game's Random number
+ * 		generator, which decides whether the other student answers correctly. Returns an int indicating how much money
  * 		the player has won (0 if nothing won).
  ***************************************************************************************************/
 
-int Ludus::play_trivia()
+Task<int> Ludus::play_trivia(GameIO& io, GameState& state, Random& rng)
 {
-	std::system("clear");
+	io.clear_screen();
 
 	// Print trivia rules
-	std::cout << "Trivia Rules:\n\n";
-	std::cout << "5 questions will be asked, and whoever gets the most right wins.\n";
-	std::cout << "1 point will be awarded for correct answers. There is no penalty for incorrect answers.\n";
-	std::cout << "If the game is tied after 5 questions, then tie-breaker questions will be asked\n"; 
-	std::cout << "until a definitive winner is chosen or 5 tie-breaker questions have been asked (whichever occurs first).\n";
-	std::cout << "\nPrizes:\n";
-	std::cout << "\t- 4 coins for winning\n";
-	std::cout << "\t- 2 coins for tying\n";
-	std::cout << "\t- 0 coins for losing\n";
+	io.out() << "Trivia Rules:\n\n";
+	io.out() << "5 questions will be asked, and whoever gets the most right wins.\n";
+	io.out() << "1 point will be awarded for correct answers. There is no penalty for incorrect answers.\n";
+	io.out() << "If the game is tied after 5 questions, then tie-breaker questions will be asked\n"; 
+	io.out() << "until a definitive winner is chosen or 5 tie-breaker questions have been asked (whichever occurs first).\n";
+	io.out() << "\nPrizes:\n";
+	io.out() << "\t- " << TRIVIA_WIN_PRIZE << " coins for winning\n";
+	io.out() << "\t- " << TRIVIA_TIE_PRIZE << " coins for tying\n";
+	io.out() << "\t- 0 coins for losing\n";
 
-	pressEnter();
+	co_await io.pause();
 
 	// Declare local variables for use in trivia game.
 	int userScore = 0;
 	int computerScore = 0;
 	int round = 1;
 
-	// There are the same number of student names in the students vector
+	// There are the same number of student names in the STUDENT_NAMES array
 	// as their are games that can be played. Use the value of gamesPlayed
 	// to determine the index of the student name to use for this game.
-	std::string computerName = studentNames[gamesPlayed];
+	const char* computerName = STUDENT_NAMES[state.gamesPlayed];
+	const std::vector<Question>& questions = Content::get().questions();
 	
 	// Ask 5 trivia questions
 	for (round = 1; round <= 5; round++)
 	{
-		std::system("clear");
+		io.clear_screen();
 
 		// Print round information and current scores
-		std::cout << "\t\tRound " << round << "\n\n";
-		std::cout << "Scores:\n";
-		std::cout << "\tYou: " << userScore << std::endl;
-		std::cout << "\t" << computerName << " (student): " << computerScore << std::endl << std::endl;
+		io.out() << "\t\tRound " << round << "\n\n";
+		io.out() << "Scores:\n";
+		io.out() << "\tYou: " << userScore << std::endl;
+		io.out() << "\t" << computerName << " (student): " << computerScore << std::endl << std::endl;
 		
-		// Get the question at the index questionsAsked from the 
-		// questions vector (which has been randomly shuffled by constructor).
-		Question q = questions[questionsAsked];
+		// Get the question at position questionsAsked in the
+		// game's (randomly shuffled) question order.
+		const Question& q = questions[state.questionOrder[state.questionsAsked]];
 		
 		// Print the text of the question.
-		std::cout << q.questionText << std::endl;
+		io.out() << q.questionText << std::endl;
 		
 		// Display the answer choices and get the user's answer
 		// using the menu function
-		int userAnswer = menu(q.answerChoices);
+		std::vector<std::string> answerChoices(q.answerChoices, q.answerChoices + NUM_CHOICES);
+		int userAnswer = co_await io.choose(Prompt::TRIVIA_ANSWER, answerChoices);
 		
 		// Check to see if user answered the question correctly and report the results
 		// Increment user's score if they answered correctly.
 		if (userAnswer == q.answerNum)
 		{
 			userScore++;
-			std::cout << "Correct!\n";
+			io.out() << "Correct!\n";
 		}
 		else
 		{
-			std::cout << "Incorrect. The correct answer was: ";
-			std::cout << q.answerNum << ": ";
-			std::cout << q.answerChoices[(q.answerNum-1)] << std::endl;
+			io.out() << "Incorrect. The correct answer was: ";
+			io.out() << q.answerNum << ": ";
+			io.out() << q.answerChoices[(q.answerNum-1)] << std::endl;
 		}
 		
 		
 		// Randomly generate 0 or 1 to indicate whether the computer
 		// got the question right or wrong.
-		bool computerCorrect = static_cast<bool>(getRandomInt(0, 1));
+		bool computerCorrect = static_cast<bool>(rng.get_int(0, 1));
 		
 		// Report whether or not computer got it right. If they got it right,
 		// add a point to their score.
 		if (computerCorrect)
 		{
-			std::cout << computerName << " answered correctly.\n\n";
+			io.out() << computerName << " answered correctly.\n\n";
 			computerScore++;
 		}
 		else
 		{
-			std::cout << std::endl << computerName << " answered incorrectly.\n\n";
+			io.out() << std::endl << computerName << " answered incorrectly.\n\n";
 		}	
 
 		// Increment questionsAsked and display updated scores.
-		questionsAsked++;
+		state.questionsAsked++;
 
 		// Display updated user and computer scores.
-		std::cout << "Updated Scores:\n";
-		std::cout << "\tYou: " << userScore << std::endl;
-		std::cout << "\t" << computerName << " (student): " << computerScore << std::endl;
+		io.out() << "Updated Scores:\n";
+		io.out() << "\tYou: " << userScore << std::endl;
+		io.out() << "\t" << computerName << " (student): " << computerScore << std::endl;
 		
-		pressEnter();
+		co_await io.pause();
 	}
 	
 	// Use a while loop for a tie breaker. Loop as long as the players are
 	// tied and it is round 10 or less.
 	while (userScore == computerScore && round <= 10)
 	{
-		std::system("clear");
+		io.clear_screen();
 
 		// Print round information and current scores
-		std::cout << "\t\tRound " << round << "\n\n";
-		std::cout << "Scores:\n";
-		std::cout << "\tYou: " << userScore << std::endl;
-		std::cout << "\t" << computerName << " (student): " << computerScore << std::endl << std::endl;
+		io.out() << "\t\tRound " << round << "\n\n";
+		io.out() << "Scores:\n";
+		io.out() << "\tYou: " << userScore << std::endl;
+		io.out() << "\t" << computerName << " (student): " << computerScore << std::endl << std::endl;
 		
 		// Inform user that this is a tie-breaker question
-		std::cout << "After " << (round-1) << " questions, it is a tie game.\n\n";
+		io.out() << "After " << (round-1) << " questions, it is a tie game.\n\n";
 		
-		// Get the question at the index questionsAsked from the 
-		// questions vector (which has been randomly shuffled by constructor).
-		Question q = questions[questionsAsked];
+		// Get the question at position questionsAsked in the
+		// game's (randomly shuffled) question order.
+		const Question& q = questions[state.questionOrder[state.questionsAsked]];
 		
 		// Print the text of the question.
-		std::cout << q.questionText << std::endl;
+		io.out() << q.questionText << std::endl;
 		
 		// Display the answer choices and get the user's answer
 		// using the menu function
-		int userAnswer = menu(q.answerChoices);
+		std::vector<std::string> answerChoices(q.answerChoices, q.answerChoices + NUM_CHOICES);
+		int userAnswer = co_await io.choose(Prompt::TRIVIA_ANSWER, answerChoices);
 		
 		// Check to see if user answered the question correctly and report the results
 		// Increment user's score if they answered correctly.
 		if (userAnswer == q.answerNum)
 		{
 			userScore++;
-			std::cout << "Correct!\n";
+			io.out() << "Correct!\n";
 		}
 		else
 		{
-			std::cout << "Incorrect. The correct answer was: ";
-			std::cout << q.answerNum << ": ";
-			std::cout << q.answerChoices[(q.answerNum-1)] << std::endl;
+			io.out() << "Incorrect. The correct answer was: ";
+			io.out() << q.answerNum << ": ";
+			io.out() << q.answerChoices[(q.answerNum-1)] << std::endl;
 		}
 		
 		
 		// Randomly generate 0 or 1 to indicate whether the computer
 		// got the question right or wrong.
-		bool computerCorrect = static_cast<bool>(getRandomInt(0, 1));
+		bool computerCorrect = static_cast<bool>(rng.get_int(0, 1));
 		
 		// Report whether or not computer got it right. If they got it right,
 		// add a point to their score.
 		if (computerCorrect)
 		{
-			std::cout << computerName << " answered correctly.\n\n";
+			io.out() << computerName << " answered correctly.\n\n";
 			computerScore++;
 		}
 		else
 		{
-			std::cout << std::endl << computerName << " answered incorrectly.\n\n";
+			io.out() << std::endl << computerName << " answered incorrectly.\n\n";
 		}
 	
 		// Increment questionsAsked and display updated scores.
-		questionsAsked++;
+		state.questionsAsked++;
 
 		// Display updated user and computer scores.
-		std::cout << "Updated Scores:\n";
-		std::cout << "\tYou: " << userScore << std::endl;
-		std::cout << "\t" << computerName << " (student): " << computerScore << std::endl;
+		io.out() << "Updated Scores:\n";
+		io.out() << "\tYou: " << userScore << std::endl;
+		io.out() << "\t" << computerName << " (student): " << computerScore << std::endl;
 		
 		// Increment round for next while loop iteration
 		round++;
 
-		pressEnter();
+		co_await io.pause();
 	}
 	
 	// Increment the total number of games of trivia played.
-	gamesPlayed++;
+	state.gamesPlayed++;
 	
 	// Determine if user won, lost, or tied. Report results
 	// and set value of moneyWon accordingly.
@@ -396,33 +342,33 @@ int Ludus::play_trivia()
 	
 	if (userScore > computerScore)
 	{
-		std::cout << "Congratulations! You have beaten " << computerName << "! You receive 4 coins.\n";
-		moneyWon = 4;
+		io.out() << "Congratulations! You have beaten " << computerName << "! You receive " << TRIVIA_WIN_PRIZE << " coins.\n";
+		moneyWon = TRIVIA_WIN_PRIZE;
 	}
 	else if (userScore < computerScore)
 	{
-		std::cout << "Unfortunately, you have lost this game of trivia and have not earned any money.\n";
+		io.out() << "Unfortunately, you have lost this game of trivia and have not earned any money.\n";
 		moneyWon = 0;
 	}
 	else
 	{
-		std::cout << "Since the game has ended in a tie (even after 5 tie-breaking rounds), you have earned 2 coins.\n";
-		moneyWon = 2;
+		io.out() << "Since the game has ended in a tie (even after 5 tie-breaking rounds), you have earned " << TRIVIA_TIE_PRIZE << " coins.\n";
+		moneyWon = TRIVIA_TIE_PRIZE;
 	}
 	
 	// Depending on whether or not the max number of games have been played,
 	// either encourage the user to return to play more
 	// or tell them that trivia is done for the day.
-	if (gamesPlayed < NUM_GAMES)
+	if (state.gamesPlayed < NUM_GAMES)
 	{
-		std::cout << "Please come back here again if you want to play more trivia!\n";
+		io.out() << "Please come back here again if you want to play more trivia!\n";
 	}
 	else
 	{
-		std::cout << "My students need to go home for the day, so that’s it for trivia. Thank you for playing!\n";
+		io.out() << "My students need to go home for the day, so that’s it for trivia. Thank you for playing!\n";
 	}
 	
-	pressEnter();
+	co_await io.pause();
 
-	return moneyWon;
+	co_return moneyWon;
 }
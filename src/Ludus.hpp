@@ -8,28 +8,21 @@
  * 		wants a scroll back from the teacher, they can obtain the scroll from this space.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *		
- *		The following struct is declared as a private member of the Ludus class:
- *		- Question (a struct containing the text of a trivia question,
- *		  the text of its answer choices, and an int representing the correct choice number).
+ *		The trivia questions (Question structs containing the text of a trivia question,
+ *		the text of its answer choices, and an int representing the correct choice number)
+ *		are loaded once per process by the Content class, and the names of the students are
+ *		constants, so the Ludus class has no private data members of its own.
  *
- *		In addition, the Ludus class contains the following private data members:
- *		- A vector of Question objects
- *		- A vector of strings representing students' names
- *		- A boolean indicating whether or not the player has already
- *		  obtained the scroll from the teacher (that way, once the player
- *		  gives the scroll back to the librarian, the teacher does not
- *		  erroneously try to give it to them again).
- *		- An int indicating the number of trivia games played
- *		- An int indicating how many trivia questions have been asked
+ *		Whether or not the player has already obtained the scroll, the number of trivia games
+ *		played, the number of questions asked, and the order in which questions are asked are
+ *		kept in the GameState so that a Ludus never changes during a game.
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Public member functions of this class include:
@@ -43,43 +36,23 @@
 #ifndef LUDUS_HPP
 #define LUDUS_HPP
 
-#include <algorithm>
 #include "Space.hpp"
 
-// Constants used by Ludus class
-const int NUM_QUESTIONS = 50;		// total number of questions in the questions vector
-const int NUM_CHOICES = 4;		// number of answer choices per question
+// Constants used by Ludus class (NUM_CHOICES is declared in Content.hpp)
 const int NUM_GAMES = 5;		// total number of trivia games that can be played per instance of Game object
+const int TRIVIA_WIN_PRIZE = 4;		// coins won for winning a game of trivia
+const int TRIVIA_TIE_PRIZE = 2;		// coins won for tying a game of trivia
 
 class Ludus : public Space
 {
 	private:
-		// Struct that defines a Question object.
-		struct Question
-		{
-			// Data members of struct are string containing text of the question,
-			// vector of strings containing answer choices, and an int indicating
-			// the number of the correct answer choice.
-			std::string questionText;
-			std::vector<std::string> answerChoices;
-			int answerNum;
-		};
-
-		// Private data members
-		std::vector<Question> questions;
-		std::vector<std::string> studentNames;
-		bool obtainedScroll;
-		int gamesPlayed;
-		int questionsAsked;
-
 		// Private member function
-		int play_trivia();
+		Task<int> play_trivia(GameIO& io, GameState& state, Random& rng);
 
 	public:
 		// Public member functions
 		Ludus();
 		virtual ~Ludus();
-		virtual void interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-				      bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero) override;
+		virtual Task<void> interact(GameIO& io, GameState& state, Random& rng) override;
 };
 #endif
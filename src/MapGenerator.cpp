@@ -0,0 +1,297 @@
+/***************************************************************************************************
+ * Program Name: MapGenerator.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: MapGenerator class that builds large GameMaps procedurally: grids of any size with
+ * 		a random mix of space types, optionally with some of their pairs of neighbors removed
+ * 		(always keeping a spanning tree so that every space stays reachable). Blocks of rows
+ * 		are generated in parallel. See MapGenerator.hpp.
+ **************************************************************************************************/
+#include "MapGenerator.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// Number of rows in each block of the map (the unit of work handed to a thread, each
+// with its own stream of random numbers)
+const std::uint32_t BLOCK_ROWS = 64;
+
+// Value stored for the spaces of the top row, which are not joined to a row above
+const std::uint8_t NO_UP = 0xFF;
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the spec of the map to generate and the number of
+ * 		threads to generate it with (0, the default, uses every hardware thread).
+ ***************************************************************************************************/
+
+MapGenerator::MapGenerator(const MapSpec& spec, int numThreads)
+{
+	this->spec = spec;
+	if (numThreads <= 0)
+	{
+		numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	}
+	this->numThreads = numThreads;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Generates the map described by the spec: first the type of every
+ * 		space and the spanning tree, then (once the whole tree is known) the neighbors, each
+ * 		pass split into blocks of rows shared among the threads. Makes sure at least one
+ * 		space is a Domus Aurea. Returns the map, ready to be shared by any number of games.
+ * 		Throws std::runtime_error if the spec does not describe a valid map.
+ ***************************************************************************************************/
+
+std::shared_ptr<const GameMap> MapGenerator::generate() const
+{
+	int totalWeight = 0;
+	for (int typeNum = 0; typeNum < NUM_SPACE_TYPES; typeNum++)
+	{
+		if (spec.typeWeights[typeNum] < 0)
+		{
+			throw std::runtime_error("The weight of a type of space cannot be negative");
+		}
+		totalWeight += spec.typeWeights[typeNum];
+	}
+	std::uint64_t numSpaces = static_cast<std::uint64_t>(spec.rows) * spec.cols;
+	if (numSpaces == 0 || numSpaces >= NO_SPACE)
+	{
+		throw std::runtime_error("A map must have between 1 and " + std::to_string(NO_SPACE - 1) + " spaces");
+	}
+	if (totalWeight == 0)
+	{
+		throw std::runtime_error("At least one type of space must have a weight above 0");
+	}
+
+	// Give each block of rows its own stream of random numbers (the stream after
+	// the last block's is kept for choosing a Domus Aurea)
+	std::uint32_t numBlocks = (spec.rows + BLOCK_ROWS - 1) / BLOCK_ROWS;
+	std::vector<Random> blockRngs;
+	Random streamRng(spec.seed);
+	for (std::uint32_t block = 0; block < numBlocks; block++)
+	{
+		blockRngs.push_back(streamRng);
+		streamRng.jump();
+	}
+
+	// Runs the received function for every block, with the blocks shared among the threads
+	auto forEachBlock = [&](auto blockFunction)
+	{
+		std::atomic<std::uint32_t> nextBlock(0);
+		auto work = [&]()
+		{
+			for (std::uint32_t block = nextBlock++; block < numBlocks; block = nextBlock++)
+			{
+				std::uint32_t firstRow = block * BLOCK_ROWS;
+				std::uint32_t endRow = (firstRow + BLOCK_ROWS < spec.rows) ? firstRow + BLOCK_ROWS : spec.rows;
+				blockFunction(block, firstRow, endRow);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (int threadNum = 1; threadNum < numThreads && threadNum < static_cast<int>(numBlocks); threadNum++)
+		{
+			threads.emplace_back(work);
+		}
+		work();
+		for (std::thread& worker : threads)
+		{
+			worker.join();
+		}
+	};
+
+	// Pass 1: the type of every space and the spanning tree
+	std::vector<SpaceType> types(numSpaces);
+	std::vector<std::uint8_t> upDirs(numSpaces);
+	forEachBlock([&](std::uint32_t block, std::uint32_t firstRow, std::uint32_t endRow)
+	{
+		generate_types(firstRow, endRow, blockRngs[block], types);
+		generate_tree(firstRow, endRow, blockRngs[block], upDirs);
+	});
+
+	// Pass 2: the neighbors (each block's neighbors are kept separately and then put
+	// together in order of block, so the map does not depend on the number of threads)
+	std::vector<std::vector<MapEdge>> blockEdges(numBlocks);
+	forEachBlock([&](std::uint32_t block, std::uint32_t firstRow, std::uint32_t endRow)
+	{
+		generate_edges(firstRow, endRow, blockRngs[block], upDirs, blockEdges[block]);
+	});
+
+	std::size_t numEdges = 0;
+	for (const std::vector<MapEdge>& edges : blockEdges)
+	{
+		numEdges += edges.size();
+	}
+	std::vector<MapEdge> edges;
+	edges.reserve(numEdges);
+	for (std::vector<MapEdge>& blockList : blockEdges)
+	{
+		edges.insert(edges.end(), blockList.begin(), blockList.end());
+		std::vector<MapEdge>().swap(blockList);
+	}
+
+	// The player starts in the middle of the map
+	std::uint32_t start = (spec.rows / 2) * spec.cols + spec.cols / 2;
+
+	// Make sure the goal of the game is on the map (away from the start, if there is room)
+	bool hasDomusAurea = false;
+	for (std::uint64_t location = 0; location < numSpaces && !hasDomusAurea; location++)
+	{
+		hasDomusAurea = (types[location] == SpaceType::DOMUS_AUREA);
+	}
+	if (!hasDomusAurea)
+	{
+		std::uint32_t goal = static_cast<std::uint32_t>(streamRng.next() % numSpaces);
+		if (goal == start && numSpaces > 1)
+		{
+			goal = (goal + 1) % numSpaces;
+		}
+		types[goal] = SpaceType::DOMUS_AUREA;
+	}
+
+	std::shared_ptr<GameMap> map = std::make_shared<GameMap>();
+	map->build(std::move(types), edges, start);
+	return map;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the first row of a block and the row after
+ * 		its last, the block's Random number generator, and the types of every space (passed
+ * 		by reference). Draws the type of every space of the block, each type being drawn
+ * 		with a chance proportional to its weight. Returns nothing.
+ ***************************************************************************************************/
+
+void MapGenerator::generate_types(std::uint32_t firstRow, std::uint32_t endRow, Random& rng,
+				  std::vector<SpaceType>& types) const
+{
+	int totalWeight = 0;
+	for (int typeNum = 0; typeNum < NUM_SPACE_TYPES; typeNum++)
+	{
+		totalWeight += spec.typeWeights[typeNum];
+	}
+
+	std::size_t endLocation = static_cast<std::size_t>(endRow) * spec.cols;
+	for (std::size_t location = static_cast<std::size_t>(firstRow) * spec.cols; location < endLocation; location++)
+	{
+		int draw = rng.get_int(0, totalWeight - 1);
+		int typeNum = 0;
+		while (draw >= spec.typeWeights[typeNum])
+		{
+			draw -= spec.typeWeights[typeNum];
+			typeNum++;
+		}
+		types[location] = static_cast<SpaceType>(typeNum);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the first row of a block and the row after
+ * 		its last, the block's Random number generator, and the direction in which each space
+ * 		is joined to the row above (passed by reference). Chooses, for every space of the
+ * 		block below the top row, whether it is joined to the space to its north, northeast,
+ * 		or northwest (among those on the map). Returns nothing.
+ ***************************************************************************************************/
+
+void MapGenerator::generate_tree(std::uint32_t firstRow, std::uint32_t endRow, Random& rng,
+				 std::vector<std::uint8_t>& upDirs) const
+{
+	for (std::uint32_t row = firstRow; row < endRow; row++)
+	{
+		for (std::uint32_t col = 0; col < spec.cols; col++)
+		{
+			std::size_t location = static_cast<std::size_t>(row) * spec.cols + col;
+			if (row == 0)
+			{
+				upDirs[location] = NO_UP;
+				continue;
+			}
+
+			// List the directions in which there is a space in the row above
+			Direction choices[3];
+			int numChoices = 0;
+			choices[numChoices++] = Direction::N;
+			if (col + 1 < spec.cols)
+			{
+				choices[numChoices++] = Direction::NE;
+			}
+			if (col > 0)
+			{
+				choices[numChoices++] = Direction::NW;
+			}
+			upDirs[location] = static_cast<std::uint8_t>(choices[rng.get_int(0, numChoices - 1)]);
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the first row of a block and the row after
+ * 		its last, the block's Random number generator, the direction in which each space is
+ * 		joined to the row above, and the list to which the block's neighbors are added
+ * 		(passed by reference). Adds the spanning tree's pair of neighbors joining each space
+ * 		of the block to the row above (or, in the top row, to the space to its east), and
+ * 		keeps each other pair of neighbors to the east, southeast, south, and southwest with
+ * 		the spec's chance. Returns nothing.
+ ***************************************************************************************************/
+
+void MapGenerator::generate_edges(std::uint32_t firstRow, std::uint32_t endRow, Random& rng,
+				  const std::vector<std::uint8_t>& upDirs, std::vector<MapEdge>& edges) const
+{
+	std::uint32_t cols = spec.cols;
+	auto keep = [&]()
+	{
+		return spec.keepPercent >= 100 || (spec.keepPercent > 0 && rng.get_int(0, 99) < spec.keepPercent);
+	};
+
+	edges.reserve(static_cast<std::size_t>(endRow - firstRow) * cols * (spec.keepPercent >= 100 ? 4 : 2));
+	for (std::uint32_t row = firstRow; row < endRow; row++)
+	{
+		for (std::uint32_t col = 0; col < cols; col++)
+		{
+			std::uint32_t location = row * cols + col;
+
+			// The spanning tree
+			if (row > 0)
+			{
+				Direction up = static_cast<Direction>(upDirs[location]);
+				std::uint32_t above = location - cols;
+				if (up == Direction::NE)
+				{
+					above++;
+				}
+				else if (up == Direction::NW)
+				{
+					above--;
+				}
+				edges.push_back({location, above, up});
+			}
+
+			// The other pairs of neighbors (skipping those that are already in the tree)
+			if (col + 1 < cols && (row == 0 || keep()))
+			{
+				edges.push_back({location, location + 1, Direction::E});
+			}
+			if (row + 1 < spec.rows)
+			{
+				std::uint32_t below = location + cols;
+				if (col + 1 < cols && upDirs[below + 1] != static_cast<std::uint8_t>(Direction::NW) && keep())
+				{
+					edges.push_back({location, below + 1, Direction::SE});
+				}
+				if (upDirs[below] != static_cast<std::uint8_t>(Direction::N) && keep())
+				{
+					edges.push_back({location, below, Direction::S});
+				}
+				if (col > 0 && upDirs[below - 1] != static_cast<std::uint8_t>(Direction::NE) && keep())
+				{
+					edges.push_back({location, below - 1, Direction::SW});
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/***************************************************************************************************
+ * Program Name: MapGenerator.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: MapGenerator class that builds large GameMaps procedurally, for stress testing
+ * 		the engine on boards far bigger than the map of Rome. The generated map is handed
+ * 		straight to the engine (Game and Board accept any GameMap), without being written
+ * 		to or read from a map file.
+ *
+ * 		A map is a grid of the requested number of rows and columns. Every space borders
+ * 		the spaces all around it in a full grid. In an irregular map, only the requested
+ * 		percentage of those pairs of neighbors are kept, except that a random spanning tree
+ * 		is always kept: the spaces of the top row are joined from west to east, and every
+ * 		other space is joined to a space (to its north, northeast, or northwest) in the row
+ * 		above. Every space can therefore be reached from every other space, and at least
+ * 		one space is always a Domus Aurea, so the goal of the game can always be reached.
+ * 		The player starts in the middle of the map.
+ *
+ * 		The type of each space is drawn at random, with each type's chance of being drawn
+ * 		proportional to its weight.
+ *
+ * 		The same spec and seed always produce the same map, however many threads generate
+ * 		it: the map is split into blocks of rows, each generated by whichever thread takes
+ * 		it, from its own stream of the Random number generator (see Random.hpp) chosen by
+ * 		the block's number.
+ *
+ *		Private data members of the MapGenerator class include:
+ *		- The spec of the map to generate and the number of threads to use
+ *
+ *		Public member functions of the MapGenerator class include:
+ *		- A constructor that receives the spec and (optionally) the number of threads
+ *		- A function that generates the map
+ *
+ *		Private member functions generate the types and the neighbors of a block of rows.
+ *
+ *		The MapSpec struct (the size, shape, mix of space types, and seed of a map) is also
+ *		declared in this header file.
+ **************************************************************************************************/
+#ifndef MAPGENERATOR_HPP
+#define MAPGENERATOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "GameMap.hpp"
+#include "Random.hpp"
+
+// Struct describing the map to generate
+struct MapSpec
+{
+	std::uint32_t rows = 100;
+	std::uint32_t cols = 100;
+
+	// Percentage of the pairs of neighbors of a full grid that are kept
+	// (100 for a full grid; the spanning tree is kept regardless)
+	int keepPercent = 100;
+
+	// Weight of each type of space, indexed by SpaceType (all equal by default)
+	int typeWeights[NUM_SPACE_TYPES] = {1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+	std::uint64_t seed = 0;
+};
+
+class MapGenerator
+{
+	private:
+		// Private data members
+		MapSpec spec;
+		int numThreads;
+
+		// Private member functions
+		void generate_types(std::uint32_t firstRow, std::uint32_t endRow, Random& rng, std::vector<SpaceType>& types) const;
+		void generate_tree(std::uint32_t firstRow, std::uint32_t endRow, Random& rng, std::vector<std::uint8_t>& upDirs) const;
+		void generate_edges(std::uint32_t firstRow, std::uint32_t endRow, Random& rng,
+				    const std::vector<std::uint8_t>& upDirs, std::vector<MapEdge>& edges) const;
+
+	public:
+		// Public member functions
+		MapGenerator(const MapSpec& spec, int numThreads = 0);
+		std::shared_ptr<const GameMap> generate() const;
+};
+#endif
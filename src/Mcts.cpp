@@ -0,0 +1,550 @@
+/***************************************************************************************************
+ * Program Name: Mcts.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Mcts class that chooses what to do on a turn by Monte Carlo tree search, with one
+ * 		tree per thread (root parallel) or one tree shared by every thread without locks
+ * 		(tree parallel). See Mcts.hpp.
+ **************************************************************************************************/
+#include "Mcts.hpp"
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+// Weight of the exploration term of the UCT rule (how much more often the moves tried least are
+// tried than the moves that look best)
+const double EXPLORATION = 0.5;
+
+// Kinds of nodes of the tree (see Mcts.hpp)
+enum class NodeKind : std::uint8_t {TURN, OPTION, MOVE};
+
+// First child of a node whose children have not been added, and of one whose children are being
+// added by another thread (node 0, the root, is never a child)
+const std::uint32_t NOT_EXPANDED = 0;
+const std::uint32_t EXPANDING = ~std::uint32_t(0);
+
+// Results of the nodes whose value is known without a rollout, and of the others
+const std::int8_t LOSS = 0;
+const std::int8_t WIN = 1;
+const std::int8_t UNKNOWN = -1;
+
+// Most children of a node (the options on a turn, the outcomes of an option, or the directions
+// in which to move)
+const int MAX_CHILDREN = (MAX_OPTIONS > NUM_DIRECTIONS) ? MAX_OPTIONS : NUM_DIRECTIONS;
+static_assert(MAX_OUTCOMES <= MAX_CHILDREN, "The outcomes of an option must fit in the children of a node");
+
+// Struct holding a node of the tree: the state (at the start of the turn for TURN and OPTION
+// nodes, and after the outcome for MOVE nodes), the steps left, and the counts of the rollouts
+// through the node, the rollouts won, and the rollouts still under way (the virtual losses)
+struct MctsNode
+{
+	ModelState state;
+	std::atomic<std::uint32_t> visits{0};
+	std::atomic<std::uint32_t> wins{0};
+	std::atomic<std::uint32_t> inFlight{0};
+	std::atomic<std::uint32_t> firstChild{NOT_EXPANDED};
+	double probability = 1.0;		// chance of the outcome (for the children of OPTION nodes)
+	int stepsLeft = 0;
+	NodeKind kind = NodeKind::TURN;
+	std::uint8_t choice = 0;		// number of the option, outcome, or direction leading here
+	std::uint8_t numChildren = 0;
+	std::int8_t result = UNKNOWN;
+};
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the valid directions of a space (as a mask) and a
+ * 		Random number generator. Returns the number of a random valid direction (which
+ * 		must exist).
+ ***************************************************************************************************/
+
+static int random_direction(std::uint8_t validMask, Random& rng)
+{
+	int numValid = 0;
+	for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+	{
+		numValid += (validMask >> dirNum) & 1;
+	}
+	int pick = rng.get_int(1, numValid);
+	for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+	{
+		if ((validMask & (1 << dirNum)) && --pick == 0)
+		{
+			return dirNum;
+		}
+	}
+	return 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a Random number generator and returns a random
+ * 		number from 0 (inclusive) to 1 (exclusive).
+ ***************************************************************************************************/
+
+static double random_fraction(Random& rng)
+{
+	return static_cast<double>(rng.next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+
+/***************************************************************************************************
+ * Description: Helper class holding one search tree: its nodes (in an array large enough for
+ * 		every node the budget of rollouts can add, each rollout adding the children of at
+ * 		most one node), the number of nodes in use, and the number of rollouts left to play.
+ * 		Any number of threads can play rollouts in the same tree at the same time.
+ ***************************************************************************************************/
+
+class SearchTree
+{
+	private:
+		const GameMap& map;
+		const GameModel& model;
+		const std::vector<std::uint32_t>& goalDistances;
+		std::unique_ptr<MctsNode[]> nodes;
+		std::size_t capacity;
+		std::atomic<std::size_t> numNodes;
+		std::atomic<int> rolloutsLeft;
+
+		// Set up a node of the given kind, marking a TURN node that wins at once, or that
+		// can no longer win, as known
+		void init_node(MctsNode& node, NodeKind kind, const ModelState& state, int stepsLeft, int choice, double probability)
+		{
+			node.state = state;
+			node.kind = kind;
+			node.stepsLeft = stepsLeft;
+			node.choice = static_cast<std::uint8_t>(choice);
+			node.probability = probability;
+			if (kind == NodeKind::TURN)
+			{
+				if (model.wins_on_entering(state))
+				{
+					node.result = WIN;
+				}
+				else if (stepsLeft == 0 || goalDistances[state.location] > static_cast<std::uint32_t>(stepsLeft))
+				{
+					node.result = LOSS;
+				}
+			}
+		}
+
+		// Add the children of a node claimed by this thread, and return the number of the
+		// first (or NOT_EXPANDED if there is no room left for them)
+		std::uint32_t expand(MctsNode& node)
+		{
+			MctsNode children[MAX_CHILDREN];
+			int numChildren = 0;
+			ModelOption options[MAX_OPTIONS];
+			if (node.kind == NodeKind::TURN)
+			{
+				int numOptions = model.list_options(node.state, options);
+				for (int optionNum = 0; optionNum < numOptions; optionNum++)
+				{
+					init_node(children[numChildren++], NodeKind::OPTION, node.state, node.stepsLeft, optionNum, 1.0);
+				}
+			}
+			else if (node.kind == NodeKind::OPTION)
+			{
+				model.list_options(node.state, options);
+				const ModelOption& option = options[node.choice];
+				for (int outcomeNum = 0; outcomeNum < option.numOutcomes; outcomeNum++)
+				{
+					const ModelOutcome& outcome = option.outcomes[outcomeNum];
+					MctsNode& child = children[numChildren++];
+					init_node(child, NodeKind::MOVE, outcome.after, node.stepsLeft, outcomeNum, outcome.probability);
+					child.result = outcome.dies ? LOSS : UNKNOWN;
+				}
+			}
+			else
+			{
+				std::uint8_t validMask = map.get_valid_mask(node.state.location);
+				for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+				{
+					if (validMask & (1 << dirNum))
+					{
+						init_node(children[numChildren++], NodeKind::TURN, model.move(node.state, static_cast<Direction>(dirNum)),
+							  node.stepsLeft - 1, dirNum, 1.0);
+					}
+				}
+			}
+
+			std::size_t first = numNodes.fetch_add(numChildren, std::memory_order_relaxed);
+			if (numChildren == 0 || first + numChildren > capacity)
+			{
+				node.firstChild.store(NOT_EXPANDED, std::memory_order_release);
+				return NOT_EXPANDED;
+			}
+			for (int childNum = 0; childNum < numChildren; childNum++)
+			{
+				MctsNode& child = nodes[first + childNum];
+				child.state = children[childNum].state;
+				child.probability = children[childNum].probability;
+				child.stepsLeft = children[childNum].stepsLeft;
+				child.kind = children[childNum].kind;
+				child.choice = children[childNum].choice;
+				child.result = children[childNum].result;
+			}
+			node.numChildren = static_cast<std::uint8_t>(numChildren);
+			node.firstChild.store(static_cast<std::uint32_t>(first), std::memory_order_release);
+			return static_cast<std::uint32_t>(first);
+		}
+
+		// Return the number of the child through which to pass: an outcome drawn by its
+		// probability for an OPTION node, and otherwise the child with the highest UCT
+		// score (counting the rollouts under way as losses), trying every child once first
+		std::uint32_t select_child(const MctsNode& node, std::uint32_t first, Random& rng) const
+		{
+			if (node.kind == NodeKind::OPTION)
+			{
+				double draw = random_fraction(rng);
+				for (int childNum = 0; childNum < node.numChildren - 1; childNum++)
+				{
+					draw -= nodes[first + childNum].probability;
+					if (draw < 0.0)
+					{
+						return first + childNum;
+					}
+				}
+				return first + node.numChildren - 1;
+			}
+
+			double parentVisits = node.visits.load(std::memory_order_relaxed) + node.inFlight.load(std::memory_order_relaxed);
+			double logParent = std::log(parentVisits > 1.0 ? parentVisits : 1.0);
+			std::uint32_t best = first;
+			double bestScore = -1.0;
+			for (int childNum = 0; childNum < node.numChildren; childNum++)
+			{
+				const MctsNode& child = nodes[first + childNum];
+				double visits = child.visits.load(std::memory_order_relaxed) + child.inFlight.load(std::memory_order_relaxed);
+				if (visits == 0.0)
+				{
+					return first + childNum;
+				}
+				double score = child.wins.load(std::memory_order_relaxed) / visits + EXPLORATION * std::sqrt(logParent / visits);
+				if (score > bestScore)
+				{
+					bestScore = score;
+					best = first + childNum;
+				}
+			}
+			return best;
+		}
+
+		// Play the rest of the game at random from a node, and return 1 if it is won
+		int rollout(const MctsNode& node, Random& rng) const
+		{
+			ModelState state = node.state;
+			int stepsLeft = node.stepsLeft;
+			NodeKind phase = node.kind;
+			ModelOption options[MAX_OPTIONS];
+			int optionNum = node.choice;
+			if (phase == NodeKind::OPTION)
+			{
+				model.list_options(state, options);
+			}
+
+			while (true)
+			{
+				if (phase == NodeKind::TURN)
+				{
+					if (model.wins_on_entering(state))
+					{
+						return 1;
+					}
+					if (stepsLeft == 0 || goalDistances[state.location] > static_cast<std::uint32_t>(stepsLeft))
+					{
+						return 0;
+					}
+					int numOptions = model.list_options(state, options);
+					optionNum = (numOptions > 1) ? rng.get_int(1, numOptions - 1) : 0;
+					phase = NodeKind::OPTION;
+				}
+
+				if (phase == NodeKind::OPTION)
+				{
+					const ModelOption& option = options[optionNum];
+					double draw = random_fraction(rng);
+					int outcomeNum = 0;
+					while (outcomeNum < option.numOutcomes - 1 && (draw -= option.outcomes[outcomeNum].probability) >= 0.0)
+					{
+						outcomeNum++;
+					}
+					if (option.outcomes[outcomeNum].dies)
+					{
+						return 0;
+					}
+					state = option.outcomes[outcomeNum].after;
+				}
+
+				int dirNum = random_direction(map.get_valid_mask(state.location), rng);
+				state = model.move(state, static_cast<Direction>(dirNum));
+				stepsLeft--;
+				phase = NodeKind::TURN;
+			}
+		}
+
+	public:
+		// Create the tree with its root (holding the state at the start of a turn, or
+		// after the outcome of the option taken, with the steps left) and the root's children
+		SearchTree(const GameMap& map, const GameModel& model, const std::vector<std::uint32_t>& goalDistances, int rollouts,
+			   bool startOfTurn, const ModelState& state, int stepsLeft)
+			: map(map), model(model), goalDistances(goalDistances), numNodes(1), rolloutsLeft(rollouts)
+		{
+			capacity = 1 + (static_cast<std::size_t>(rollouts) + 1) * MAX_CHILDREN;
+			nodes = std::make_unique<MctsNode[]>(capacity);
+			init_node(nodes[0], startOfTurn ? NodeKind::TURN : NodeKind::MOVE, state, stepsLeft, 0, 1.0);
+			if (nodes[0].result == UNKNOWN)
+			{
+				expand(nodes[0]);
+			}
+		}
+
+		// Play rollouts until the budget of the tree is spent. Each passes down the tree to
+		// a node whose children have not been added (adding them, if no other thread has
+		// claimed the node, and moving on to one of them), plays the rest of the game at
+		// random from there, and adds the result to every node on its path.
+		void run(Random& rng)
+		{
+			std::vector<std::uint32_t> path;
+			while (rolloutsLeft.fetch_sub(1, std::memory_order_relaxed) > 0)
+			{
+				path.clear();
+				std::uint32_t nodeNum = 0;
+				int reward = 0;
+				while (true)
+				{
+					MctsNode& node = nodes[nodeNum];
+					node.inFlight.fetch_add(1, std::memory_order_relaxed);
+					path.push_back(nodeNum);
+					if (node.result != UNKNOWN)
+					{
+						reward = node.result;
+						break;
+					}
+
+					std::uint32_t first = node.firstChild.load(std::memory_order_acquire);
+					if (first == NOT_EXPANDED && node.firstChild.compare_exchange_strong(first, EXPANDING, std::memory_order_acquire))
+					{
+						first = expand(node);
+					}
+					if (first == NOT_EXPANDED || first == EXPANDING)
+					{
+						reward = rollout(node, rng);
+						break;
+					}
+					nodeNum = select_child(node, first, rng);
+				}
+
+				for (std::uint32_t pathNode : path)
+				{
+					nodes[pathNode].visits.fetch_add(1, std::memory_order_relaxed);
+					nodes[pathNode].wins.fetch_add(reward, std::memory_order_relaxed);
+					nodes[pathNode].inFlight.fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Return a node of the tree
+		const MctsNode& node(std::uint32_t nodeNum) const
+		{
+			return nodes[nodeNum];
+		}
+
+		// Return the number of nodes in use
+		std::size_t size() const
+		{
+			std::size_t used = numNodes.load();
+			return used < capacity ? used : capacity;
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the map on which the games are played, the number of
+ * 		rollouts to play in each search, the number of threads with which to search (0 uses
+ * 		every hardware thread, and the default is 1), and the way the threads share the work.
+ * 		Finds the number of moves from every space to the nearest Domus Aurea.
+ ***************************************************************************************************/
+
+Mcts::Mcts(std::shared_ptr<const GameMap> map, int rollouts, int numThreads, MctsMode mode)
+{
+	this->map = std::move(map);
+	this->rollouts = rollouts > 0 ? rollouts : 1;
+	if (numThreads <= 0)
+	{
+		numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	}
+	this->numThreads = numThreads;
+	this->mode = mode;
+
+	goalDistances.assign(this->map->num_spaces(), NO_SPACE);
+	for (std::uint32_t location = 0; location < this->map->num_spaces(); location++)
+	{
+		if (this->map->get_type(location) != SpaceType::DOMUS_AUREA)
+		{
+			continue;
+		}
+		std::vector<std::uint32_t> distances = this->map->distances_from(location);
+		for (std::uint32_t other = 0; other < distances.size(); other++)
+		{
+			goalDistances[other] = (distances[other] < goalDistances[other]) ? distances[other] : goalDistances[other];
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing and return the number of rollouts per
+ * 		search, the number of threads, and the way the threads share the work.
+ ***************************************************************************************************/
+
+int Mcts::get_rollouts() const
+{
+	return this->rollouts;
+}
+
+int Mcts::get_num_threads() const
+{
+	return this->numThreads;
+}
+
+MctsMode Mcts::get_mode() const
+{
+	return this->mode;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives the state of a game (at the start of a turn,
+ * 		or once the player has finished at the space, as "startOfTurn" says) and the seed of
+ * 		the search. Creates one tree per thread (root parallel) or one tree in all (tree
+ * 		parallel), has the threads play the rollouts in them, and adds up the counts of the
+ * 		children of the roots. Returns the MctsResult with the child tried most often (the
+ * 		option or the direction), or without searching if there is only one.
+ ***************************************************************************************************/
+
+MctsResult Mcts::search(const GameState& state, bool startOfTurn, std::uint64_t seed) const
+{
+	MctsResult result;
+	if (state.withNero)
+	{
+		result.winEstimate = 1.0;
+		return result;
+	}
+	if (state.gameOver || !state.stillAlive)
+	{
+		return result;
+	}
+
+	GameModel model(map, state.expensiveChoice, state.cheapChoice);
+	ModelState start = model.model_state(state);
+	if (startOfTurn && model.wins_on_entering(start))
+	{
+		result.action = TurnAction::ENTER;
+		result.winEstimate = 1.0;
+		return result;
+	}
+
+	int stepsLeft = MAX_STEPS - state.stepsTaken;
+	int numTrees = (mode == MctsMode::ROOT_PARALLEL) ? numThreads : 1;
+	std::vector<std::unique_ptr<SearchTree>> trees;
+	for (int treeNum = 0; treeNum < numTrees; treeNum++)
+	{
+		int treeRollouts = static_cast<int>(static_cast<long long>(rollouts) * (treeNum + 1) / numTrees -
+						    static_cast<long long>(rollouts) * treeNum / numTrees);
+		trees.push_back(std::make_unique<SearchTree>(*map, model, goalDistances, treeRollouts, startOfTurn, start, stepsLeft));
+	}
+
+	// Search only if there is more than one child to choose from
+	const MctsNode& root = trees[0]->node(0);
+	if (root.numChildren > 1)
+	{
+		auto work = [&](int threadNum)
+		{
+			Random rng(seed, threadNum);
+			trees[(mode == MctsMode::ROOT_PARALLEL) ? threadNum : 0]->run(rng);
+		};
+		std::vector<std::thread> threads;
+		for (int threadNum = 1; threadNum < numThreads; threadNum++)
+		{
+			threads.emplace_back(work, threadNum);
+		}
+		work(0);
+		for (std::thread& worker : threads)
+		{
+			worker.join();
+		}
+	}
+
+	// The children of every root are in the same order, so their counts can be added
+	int bestChild = -1;
+	std::uint64_t bestVisits = 0;
+	std::uint64_t bestWins = 0;
+	std::uint64_t totalWins = 0;
+	for (int childNum = 0; childNum < root.numChildren; childNum++)
+	{
+		std::uint64_t visits = 0;
+		std::uint64_t wins = 0;
+		for (const std::unique_ptr<SearchTree>& tree : trees)
+		{
+			const MctsNode& child = tree->node(tree->node(0).firstChild.load() + childNum);
+			visits += child.visits.load();
+			wins += child.wins.load();
+		}
+		result.rollouts += visits;
+		totalWins += wins;
+		if (bestChild < 0 || visits > bestVisits || (visits == bestVisits && wins > bestWins))
+		{
+			bestChild = childNum;
+			bestVisits = visits;
+			bestWins = wins;
+		}
+	}
+	for (const std::unique_ptr<SearchTree>& tree : trees)
+	{
+		result.nodes += tree->size();
+	}
+	result.winEstimate = (result.rollouts > 0) ? static_cast<double>(totalWins) / result.rollouts : 0.0;
+
+	if (bestChild < 0)
+	{
+		return result;
+	}
+	const MctsNode& best = trees[0]->node(root.firstChild.load() + bestChild);
+	if (startOfTurn)
+	{
+		ModelOption options[MAX_OPTIONS];
+		model.list_options(start, options);
+		result.action = options[best.choice].action;
+		result.items = options[best.choice].items;
+		result.bet = options[best.choice].bet;
+	}
+	else
+	{
+		result.direction = static_cast<Direction>(best.choice);
+	}
+	return result;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn and the seed of the search.
+ * 		Returns the MctsResult with the option tried most often (see search).
+ ***************************************************************************************************/
+
+MctsResult Mcts::plan_turn(const GameState& state, std::uint64_t seed) const
+{
+	return search(state, true, seed);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game once the player has finished at the space and the
+ * 		seed of the search. Returns the MctsResult with the direction tried most often (see
+ * 		search).
+ ***************************************************************************************************/
+
+MctsResult Mcts::choose_direction(const GameState& state, std::uint64_t seed) const
+{
+	return search(state, false, seed);
+}
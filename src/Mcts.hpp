@@ -0,0 +1,106 @@
+/***************************************************************************************************
+ * Program Name: Mcts.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Mcts class that chooses what to do on a turn by Monte Carlo tree search: instead
+ * 		of computing the value of every state reachable in the rest of the game (as the
+ * 		Expectimax engine does), it plays a fixed number of quick games (rollouts) from the
+ * 		current state, each following the tree of the moves searched so far as far as it
+ * 		goes and then playing at random, and steers the rollouts toward the moves that have
+ * 		won most often (by the UCT rule, which balances trying the moves that look best
+ * 		against trying the moves tried least). The move chosen is the one tried most often.
+ * 		The time taken depends on the number of rollouts (the budget) and not on the size
+ * 		of the game.
+ *
+ * 		The engine plays by the rules described by the GameModel (see GameModel.hpp), so
+ * 		copying a state to play a rollout from it copies a few numbers. The tree has three
+ * 		kinds of nodes: the start of a turn (whose children are the options on the turn),
+ * 		an option (a chance node, whose children are the option's outcomes, such as winning,
+ * 		losing, or dying in a battle at the Colosseum, betting on the winning team or not at
+ * 		the Circus Maximus, or winning or tying a game of trivia at the Ludus, one of which
+ * 		is drawn by its probability on each pass through the node), and the choice of the
+ * 		direction in which to move (whose children are the starts of the next turns). A
+ * 		rollout is worth 1 if it ends with the player received by Nero within MAX_STEPS,
+ * 		and 0 otherwise (as is any state from which no Domus Aurea can be reached in the
+ * 		steps left). The random play of a rollout enters every space where entering does
+ * 		something (trying a random option other than keeping moving) and moves in a random
+ * 		direction.
+ *
+ * 		A search can use several threads in one of two ways (see MctsMode):
+ * 		- Root parallel: every thread searches a tree of its own with its share of the
+ * 		  budget, and the counts of the moves at the root of every tree are added together
+ * 		  to choose the move, so the threads share nothing while searching
+ * 		- Tree parallel: all of the threads search one shared tree, which is never locked.
+ * 		  The counts of every node are atomic, the nodes are taken from a shared array by
+ * 		  incrementing an atomic index, and the children of a node are added by the one
+ * 		  thread that claims the node by setting its first child with a compare-and-swap
+ * 		  (any other thread reaching the node in the meantime plays its rollout from the
+ * 		  node itself). Each rollout under way counts as a loss at every node on its path
+ * 		  until it ends (a virtual loss), so that the threads spread out over the tree
+ * 		  instead of all following the same path
+ * 		With one thread, both are the same search, and a search with a given seed always
+ * 		chooses the same move.
+ *
+ *		Private data members of the Mcts class include:
+ *		- The map on which the games are played
+ *		- The number of rollouts per search, the number of threads, and the way they search
+ *		- The number of moves from every space to the nearest Domus Aurea
+ *
+ *		Public member functions of the Mcts class include:
+ *		- A constructor that receives the map, the budget, and (optionally) the number of
+ *		  threads and the way they search
+ *		- Accessor methods for the budget, the number of threads, and the way they search
+ *		- Functions that search for the best option at the start of a turn, and the best
+ *		  direction in which to move once the player has finished at the space
+ *
+ *		The MctsMode enum class and the MctsResult struct are also declared in this header
+ *		file.
+ **************************************************************************************************/
+#ifndef MCTS_HPP
+#define MCTS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Game.hpp"
+#include "GameModel.hpp"
+
+// Enum class identifying how the threads of a search share the work (see above)
+enum class MctsMode {ROOT_PARALLEL, TREE_PARALLEL};
+
+// Struct describing the result of a search
+struct MctsResult
+{
+	TurnAction action = TurnAction::KEEP_MOVING;		// the best thing to do on this turn
+	Satchel items;						// the items bought or donated (BUY and DONATE)
+	int bet = 0;						// the coins bet (at the Circus Maximus)
+	Direction direction = Direction::N;			// the best direction in which to move
+	double winEstimate = 0.0;				// share of the rollouts won
+	std::size_t rollouts = 0;				// number of rollouts played
+	std::size_t nodes = 0;					// number of nodes in the tree(s)
+};
+
+class Mcts
+{
+	private:
+		// Private data members
+		std::shared_ptr<const GameMap> map;
+		int rollouts;
+		int numThreads;
+		MctsMode mode;
+		std::vector<std::uint32_t> goalDistances;
+
+		// Private member function
+		MctsResult search(const GameState& state, bool startOfTurn, std::uint64_t seed) const;
+
+	public:
+		// Public member functions
+		Mcts(std::shared_ptr<const GameMap> map, int rollouts, int numThreads = 1, MctsMode mode = MctsMode::TREE_PARALLEL);
+		int get_rollouts() const;
+		int get_num_threads() const;
+		MctsMode get_mode() const;
+		MctsResult plan_turn(const GameState& state, std::uint64_t seed) const;
+		MctsResult choose_direction(const GameState& state, std::uint64_t seed) const;
+};
+#endif
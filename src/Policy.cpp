@@ -0,0 +1,384 @@
+/***************************************************************************************************
+ * Program Name: Policy.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Policies that play whole games through the HeadlessIO class: the Policy class
+ * 		(which answers every menu by following a plan for the turn), the GreedyPolicy,
+ * 		OptimalPolicy, and MctsPolicy classes (which plan with the Solver, the Expectimax
+ * 		engine, and Monte Carlo tree search), and the ScriptedPolicy class. See Policy.hpp.
+ **************************************************************************************************/
+#include "Policy.hpp"
+#include "CircusMaximus.hpp"
+#include "Content.hpp"
+
+// Largest difference between two probabilities of winning that are treated as the same (they can
+// differ in the last bits when computed with different numbers of steps left)
+const double SAME_PROBABILITY = 1e-9;
+
+// Correct answers to the prefect's test (see CampusMartius::test_user), one for each question
+const char* const LOYALTY_ANSWERS[] = {"Rome", "Nero", "He made improvements to Rome after the Great Fire to prevent future fires."};
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the menu choices and a name. Returns the number of
+ * 		the first choice that begins with the name, or 0 if there is none.
+ ***************************************************************************************************/
+
+static int find_choice(MenuChoices menuChoices, const std::string& name)
+{
+	for (std::size_t index = 0; index < menuChoices.size(); index++)
+	{
+		if (menuChoices[index].compare(0, name.size(), name) == 0)
+		{
+			return static_cast<int>(index) + 1;
+		}
+	}
+	return 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the seed of the Policy's Random number generator (used
+ * 		for the choices that do not matter). The Game to watch must be set with watch()
+ * 		before the Policy is asked for a choice.
+ ***************************************************************************************************/
+
+Policy::Policy(std::uint64_t seed) : rng(seed)
+{
+	game = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual destructor for Policy class. The Game is owned by the calling code, so the
+ * 		pointer to it is simply set to nullptr.
+ ***************************************************************************************************/
+
+Policy::~Policy()
+{
+	game = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the Game whose state the Policy decides from (the Game played through the
+ * 		HeadlessIO object that asks the Policy for its choices). Returns nothing.
+ ***************************************************************************************************/
+
+void Policy::watch(const Game& game)
+{
+	this->game = &game;
+}
+
+
+/***************************************************************************************************
+ * Description: Protected accessor that returns the Policy's Random number generator.
+ ***************************************************************************************************/
+
+Random& Policy::get_rng()
+{
+	return this->rng;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt and the menu choices. Plans the turn when asked whether to
+ * 		enter the space, chooses a direction when asked where to move, and otherwise makes
+ * 		the choice that carries out the plan. Each item in the plan is tried only once, so
+ * 		that a purchase or donation the game refuses is not asked for again. Returns the
+ * 		number of the choice.
+ ***************************************************************************************************/
+
+int Policy::choose(Prompt prompt, MenuChoices menuChoices)
+{
+	GameState state = game->snapshot();
+	int last = static_cast<int>(menuChoices.size());
+
+	switch (prompt)
+	{
+		case Prompt::ENTER_SPACE:
+			plan = plan_turn(state);
+			itemsTried = Satchel();
+			return (plan.action == TurnAction::KEEP_MOVING) ? 2 : 1;
+
+		case Prompt::MOVE:
+			return static_cast<int>(choose_direction(state)) + 1;
+
+		case Prompt::TRIVIA_CHALLENGE:
+			return 1;
+
+		case Prompt::TRIVIA_ANSWER:
+			return Content::get().questions()[state.questionOrder[state.questionsAsked]].answerNum;
+
+		case Prompt::LOYALTY_QUESTION:
+			for (const char* answer : LOYALTY_ANSWERS)
+			{
+				int choice = find_choice(menuChoices, answer);
+				if (choice != 0)
+				{
+					return choice;
+				}
+			}
+			return 1;
+
+		// Bet the planned amount, or the most the player can afford (the bets are
+		// listed from lowest to highest)
+		case Prompt::BET_AMOUNT:
+			if (plan.bet == LOW_BET || state.money < MEDIUM_BET)
+			{
+				return 1;
+			}
+			if (plan.bet == MEDIUM_BET || state.money < HIGH_BET)
+			{
+				return 2;
+			}
+			return 3;
+
+		case Prompt::PURCHASE:
+		case Prompt::DONATION:
+			for (ItemId item = 0; item < NUM_ITEMS; item++)
+			{
+				bool wanted = (prompt == Prompt::PURCHASE) ? !state.satchel.contains(item) : state.satchel.contains(item);
+				if (plan.items.contains(item) && !itemsTried.contains(item) && wanted)
+				{
+					int choice = find_choice(menuChoices, item_name(item));
+					itemsTried.insert(item);
+					if (choice != 0)
+					{
+						return choice;
+					}
+				}
+			}
+			return last;
+
+		case Prompt::BATHE:
+			return (plan.action == TurnAction::BATHE) ? 1 : 2;
+
+		case Prompt::PLAY_AGAIN:
+			return last;
+
+		// Which team wins a race, and which move wins a round of a battle, is
+		// equally likely whatever the player chooses
+		default:
+			return rng.get_int(1, last);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the Solver with which to plan each turn (which may be
+ * 		shared with other policies) and the seed of the Random number generator.
+ ***************************************************************************************************/
+
+GreedyPolicy::GreedyPolicy(const Solver& solver, std::uint64_t seed) : Policy(seed)
+{
+	this->solver = &solver;
+	plannedDir = Direction::N;
+	hasPlan = false;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state at the start of a turn. Solves the game and plans the first
+ * 		turn of the solution (remembering the direction in which it moves), betting the
+ * 		most the player can afford. If the game cannot be won even with luck, plans to keep
+ * 		moving (in random directions). Returns the plan.
+ ***************************************************************************************************/
+
+TurnPlan GreedyPolicy::plan_turn(const GameState& state)
+{
+	TurnPlan plan;
+	Solution solution = solver->solve(state);
+	hasPlan = solution.winnable && !solution.turns.empty();
+	if (hasPlan)
+	{
+		plan.action = solution.turns[0].action;
+		plan.items = solution.turns[0].items;
+		plannedDir = solution.turns[0].dir;
+	}
+	return plan;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state after the player has finished at the space (unused). Returns
+ * 		the direction planned at the start of the turn, or a random direction if the game
+ * 		cannot be won (the menu asks again, for another random direction, if it leads off
+ * 		the board).
+ ***************************************************************************************************/
+
+Direction GreedyPolicy::choose_direction([[maybe_unused]] const GameState& state)
+{
+	if (!hasPlan)
+	{
+		return static_cast<Direction>(get_rng().get_int(0, NUM_DIRECTIONS - 1));
+	}
+	return plannedDir;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the Expectimax engine with which to plan each turn
+ * 		(which may be shared with other policies, and remembers every state it evaluates),
+ * 		the map on which the games are played, and the seed of the Random number generator.
+ ***************************************************************************************************/
+
+OptimalPolicy::OptimalPolicy(const Expectimax& engine, std::shared_ptr<const GameMap> map, std::uint64_t seed) : Policy(seed)
+{
+	this->engine = &engine;
+	this->map = std::move(map);
+	deadline = -1;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state at the start of a turn. Many options are often equally good
+ * 		(the game can be won for certain long before MAX_STEPS, however long the player
+ * 		wanders first), so the policy plays to win by a deadline: the fewest steps taken
+ * 		by which winning is as likely as it is within MAX_STEPS. The deadline is set on the
+ * 		first turn, and moved later whenever an outcome leaves winning by it less likely
+ * 		than winning at all. Returns the plan of the option that makes winning by the
+ * 		deadline most likely.
+ ***************************************************************************************************/
+
+TurnPlan OptimalPolicy::plan_turn(const GameState& state)
+{
+	double best = engine->evaluate(state).winProbability;
+	int stepsLeft = deadline - state.stepsTaken;
+	if (deadline < 0 || stepsLeft < 0 || engine->evaluate(state, stepsLeft).winProbability < best - SAME_PROBABILITY)
+	{
+		stepsLeft = 0;
+		while (stepsLeft < MAX_STEPS - state.stepsTaken && engine->evaluate(state, stepsLeft).winProbability < best - SAME_PROBABILITY)
+		{
+			stepsLeft++;
+		}
+		deadline = state.stepsTaken + stepsLeft;
+	}
+
+	ExpectimaxResult result = engine->evaluate(state, stepsLeft);
+	TurnPlan plan;
+	plan.action = result.action;
+	plan.items = result.items;
+	plan.bet = result.bet;
+	return plan;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state after the player has finished at the space. Evaluates the state
+ * 		at the start of the next turn after moving in each valid direction (one more step
+ * 		taken, and one more since bathing, as counted by Game::move_player). Returns the
+ * 		direction from which winning by the deadline is most likely.
+ ***************************************************************************************************/
+
+Direction OptimalPolicy::choose_direction(const GameState& state)
+{
+	Direction bestDir = Direction::N;
+	double bestValue = -1.0;
+	std::uint8_t validMask = map->get_valid_mask(state.location);
+	for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+	{
+		if (!(validMask & (1 << dirNum)))
+		{
+			continue;
+		}
+
+		GameState next = state;
+		next.location = map->get_neighbor(state.location, static_cast<Direction>(dirNum));
+		next.stepsTaken++;
+		if (next.hasBathed)
+		{
+			next.stepsSinceBathing++;
+		}
+		double value = engine->evaluate(next, deadline - next.stepsTaken).winProbability;
+		if (value > bestValue)
+		{
+			bestValue = value;
+			bestDir = static_cast<Direction>(dirNum);
+		}
+	}
+	return bestDir;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the Mcts engine with which to search on every turn
+ * 		(which may be shared with other policies) and the seed of the Random number
+ * 		generator, which also gives the seed of every search.
+ ***************************************************************************************************/
+
+MctsPolicy::MctsPolicy(const Mcts& engine, std::uint64_t seed) : Policy(seed)
+{
+	this->engine = &engine;
+	rolloutsPlayed = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state at the start of a turn. Returns the plan of the option the
+ * 		search tried most often.
+ ***************************************************************************************************/
+
+TurnPlan MctsPolicy::plan_turn(const GameState& state)
+{
+	MctsResult result = engine->plan_turn(state, get_rng().next());
+	rolloutsPlayed += result.rollouts;
+	TurnPlan plan;
+	plan.action = result.action;
+	plan.items = result.items;
+	plan.bet = result.bet;
+	return plan;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state after the player has finished at the space. Returns the
+ * 		direction the search tried most often.
+ ***************************************************************************************************/
+
+Direction MctsPolicy::choose_direction(const GameState& state)
+{
+	MctsResult result = engine->choose_direction(state, get_rng().next());
+	rolloutsPlayed += result.rollouts;
+	return result.direction;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of rollouts played
+ * 		by every search so far.
+ ***************************************************************************************************/
+
+std::size_t MctsPolicy::get_rollouts_played() const
+{
+	return this->rolloutsPlayed;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the script (the menu choices to make, in order, which
+ * 		may be shared with other policies) and the seed of the Random number generator used
+ * 		once the script runs out.
+ ***************************************************************************************************/
+
+ScriptedPolicy::ScriptedPolicy(const std::vector<int>& script, std::uint64_t seed) : rng(seed)
+{
+	this->script = &script;
+	nextChoice = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt (unused) and the menu choices. Returns the next choice in the
+ * 		script (which the HeadlessIO object asks for again if it is not valid, as a person
+ * 		at the terminal would be), or a random choice once the script has run out.
+ ***************************************************************************************************/
+
+int ScriptedPolicy::choose([[maybe_unused]] Prompt prompt, MenuChoices menuChoices)
+{
+	if (nextChoice < script->size())
+	{
+		return (*script)[nextChoice++];
+	}
+	return rng.get_int(1, menuChoices.size());
+}
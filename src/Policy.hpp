@@ -0,0 +1,149 @@
+/***************************************************************************************************
+ * Program Name: Policy.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Policies that play whole games through the HeadlessIO class, each a DecisionSource
+ * 		that answers every menu of the game, for the simulator (see simulate.cpp) to compare
+ * 		ways of playing over many games.
+ *
+ * 		The Policy class is an abstract DecisionSource for policies that decide what to do
+ * 		from the state of the game they are playing (which they watch, taking a snapshot of
+ * 		it whenever they are asked for a choice). At the start of each turn, a child class
+ * 		plans the turn (what to do at the space, the items to buy or donate, and the coins
+ * 		to bet), and chooses the direction in which to move once the player has finished at
+ * 		the space. The Policy class answers every menu of the spaces by following the plan:
+ * 		it accepts every trivia challenge, answers every question correctly (trivia, and the
+ * 		prefect's test), bets on a random team, and makes random moves in gladiator
+ * 		battles (every move being as good as any other).
+ *
+ * 		The following policies are declared in this header file:
+ * 		- GreedyPolicy follows the fastest way to win found by the Solver (which assumes
+ * 		  every trivia game, battle, and chariot race is won), solving again every turn, so
+ * 		  it takes every gamble that could make winning quicker
+ * 		- OptimalPolicy does whatever makes winning most likely, as computed by a shared
+ * 		  Expectimax engine, so it wins as often as any player can (and, of the ways of
+ * 		  doing so, plays to win in the fewest steps)
+ * 		- MctsPolicy does whatever a Monte Carlo tree search (see Mcts.hpp) with a fixed
+ * 		  budget of rollouts finds best, on every turn and for every move, so it plays
+ * 		  better the larger the budget, at a cost that does not depend on the map
+ * 		- ScriptedPolicy (a DecisionSource that does not watch the game) makes the menu
+ * 		  choices listed in a script, in order, as though they were typed at the terminal,
+ * 		  and random choices once the script runs out
+ * 		Random play is the RandomDecisionSource class (see HeadlessIO.hpp).
+ *
+ *		Private data members of the Policy class include:
+ *		- A pointer to the Game being played
+ *		- The Random number generator used for the choices that do not matter
+ *		- The plan for the current turn, and the items the player has tried to buy or
+ *		  donate on it
+ *
+ *		Protected member functions of the Policy class include:
+ *		- Pure virtual functions that plan a turn and choose the direction in which to move
+ *		- An accessor for the Random number generator
+ *
+ *		Public member functions of the Policy class include:
+ *		- A constructor that receives a seed, and a virtual destructor
+ *		- A function that sets the Game to watch
+ *		- The implementation of the pure virtual choose function of the DecisionSource
+ *		  class
+ *
+ *		The TurnPlan struct is also declared in this header file.
+ **************************************************************************************************/
+#ifndef POLICY_HPP
+#define POLICY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Expectimax.hpp"
+#include "HeadlessIO.hpp"
+#include "Mcts.hpp"
+#include "Solver.hpp"
+
+// Struct describing what a policy plans to do at the space on a turn: the action, the items to
+// buy or donate (for BUY and DONATE), and the coins to bet (at the Circus Maximus, 0 for the
+// most the player can afford)
+struct TurnPlan
+{
+	TurnAction action = TurnAction::KEEP_MOVING;
+	Satchel items;
+	int bet = 0;
+};
+
+class Policy : public DecisionSource
+{
+	private:
+		const Game* game;
+		Random rng;
+		TurnPlan plan;
+		Satchel itemsTried;
+
+	protected:
+		virtual TurnPlan plan_turn(const GameState& state) = 0;
+		virtual Direction choose_direction(const GameState& state) = 0;
+		Random& get_rng();
+
+	public:
+		Policy(std::uint64_t seed);
+		virtual ~Policy();
+		void watch(const Game& game);
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) override;
+};
+
+class GreedyPolicy : public Policy
+{
+	private:
+		const Solver* solver;
+		Direction plannedDir;
+		bool hasPlan;
+
+	protected:
+		virtual TurnPlan plan_turn(const GameState& state) override;
+		virtual Direction choose_direction(const GameState& state) override;
+
+	public:
+		GreedyPolicy(const Solver& solver, std::uint64_t seed);
+};
+
+class OptimalPolicy : public Policy
+{
+	private:
+		const Expectimax* engine;
+		std::shared_ptr<const GameMap> map;
+		int deadline;
+
+	protected:
+		virtual TurnPlan plan_turn(const GameState& state) override;
+		virtual Direction choose_direction(const GameState& state) override;
+
+	public:
+		OptimalPolicy(const Expectimax& engine, std::shared_ptr<const GameMap> map, std::uint64_t seed);
+};
+
+class MctsPolicy : public Policy
+{
+	private:
+		const Mcts* engine;
+		std::size_t rolloutsPlayed;
+
+	protected:
+		virtual TurnPlan plan_turn(const GameState& state) override;
+		virtual Direction choose_direction(const GameState& state) override;
+
+	public:
+		MctsPolicy(const Mcts& engine, std::uint64_t seed);
+		std::size_t get_rollouts_played() const;
+};
+
+class ScriptedPolicy : public DecisionSource
+{
+	private:
+		const std::vector<int>* script;
+		std::size_t nextChoice;
+		Random rng;
+
+	public:
+		ScriptedPolicy(const std::vector<int>& script, std::uint64_t seed);
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) override;
+};
+#endif
@@ -0,0 +1,155 @@
+/***************************************************************************************************
+ * Program Name: Random.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Random class that generates the random numbers used by a game with the
+ * 		xoshiro256** generator. See Random.hpp for why each Game has its own generator.
+ **************************************************************************************************/
+#include "Random.hpp"
+#include <random>
+
+
+/***************************************************************************************************
+ * Description: Function that receives a 64-bit word, rotates its bits left by the received number
+ * 		of places, and returns the result.
+ ***************************************************************************************************/
+
+static inline std::uint64_t rotate_left(std::uint64_t word, int places)
+{
+	return (word << places) | (word >> (64 - places));
+}
+
+
+/***************************************************************************************************
+ * Description: Function that receives the state of a splitmix64 generator, advances it, and
+ * 		returns its next number. Used to spread the bits of a seed over the 256 bits of the
+ * 		xoshiro256** state (which must not be all zeros).
+ ***************************************************************************************************/
+
+static std::uint64_t splitmix64(std::uint64_t& splitState)
+{
+	splitState += 0x9E3779B97F4A7C15ULL;
+	std::uint64_t word = splitState;
+	word = (word ^ (word >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	word = (word ^ (word >> 27)) * 0x94D049BB133111EBULL;
+	return word ^ (word >> 31);
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives a seed and a stream number (0 by default). Fills the
+ * 		state from the seed, then jumps ahead once for each stream number, so that each
+ * 		worker thread can use a different stream of the same seed.
+ ***************************************************************************************************/
+
+Random::Random(std::uint64_t seed, std::uint64_t stream)
+{
+	std::uint64_t splitState = seed;
+	for (int index = 0; index < 4; index++)
+	{
+		s[index] = splitmix64(splitState);
+	}
+
+	for (std::uint64_t count = 0; count < stream; count++)
+	{
+		jump();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Advances the generator and returns its next 64 random bits.
+ ***************************************************************************************************/
+
+std::uint64_t Random::next()
+{
+	std::uint64_t result = rotate_left(s[1] * 5, 7) * 9;
+	std::uint64_t shifted = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= shifted;
+	s[3] = rotate_left(s[3], 45);
+
+	return result;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the lower bound and upper bound of the desired random integer (the
+ * 		integer can be greater than or equal to the lower bound and less than or equal to
+ * 		the upper bound). Returns the random integer.
+ *
+ * 		The 64 random bits are multiplied by the size of the range, and the top 64 bits of
+ * 		the 128-bit product are the result. A few products would make some results more
+ * 		likely than others; those (recognized by the bottom 64 bits of the product) are
+ * 		thrown away and a new number drawn, which almost never happens for small ranges.
+ ***************************************************************************************************/
+
+int Random::get_int(int lowerBound, int upperBound)
+{
+	std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(upperBound) - lowerBound) + 1;
+
+	unsigned __int128 product = static_cast<unsigned __int128>(next()) * range;
+	std::uint64_t low = static_cast<std::uint64_t>(product);
+	if (low < range)
+	{
+		// Smallest bottom half that is not biased: 2^64 mod range
+		std::uint64_t threshold = (0 - range) % range;
+		while (low < threshold)
+		{
+			product = static_cast<unsigned __int128>(next()) * range;
+			low = static_cast<std::uint64_t>(product);
+		}
+	}
+
+	return static_cast<int>(lowerBound + static_cast<std::int64_t>(product >> 64));
+}
+
+
+/***************************************************************************************************
+ * Description: Receives and returns nothing. Advances the generator by 2^128 numbers, which is
+ * 		the same as calling next() 2^128 times. Used to create non-overlapping streams.
+ ***************************************************************************************************/
+
+void Random::jump()
+{
+	static const std::uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+					     0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+
+	std::uint64_t jumped[4] = {0, 0, 0, 0};
+	for (int word = 0; word < 4; word++)
+	{
+		for (int bit = 0; bit < 64; bit++)
+		{
+			if (JUMP[word] & (1ULL << bit))
+			{
+				for (int index = 0; index < 4; index++)
+				{
+					jumped[index] ^= s[index];
+				}
+			}
+			next();
+		}
+	}
+
+	for (int index = 0; index < 4; index++)
+	{
+		s[index] = jumped[index];
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Static function that receives nothing and returns an unpredictable seed for a new
+ * 		game, taken from the operating system's random number source.
+ ***************************************************************************************************/
+
+std::uint64_t Random::random_seed()
+{
+	std::random_device device;
+	std::uint64_t seed = device();
+	return (seed << 32) ^ device();
+}
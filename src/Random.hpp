@@ -0,0 +1,53 @@
+/***************************************************************************************************
+ * Program Name: Random.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Random class that generates the random numbers used by a game. Each Game owns its
+ * 		own Random object, created from an explicit seed, so the same seed (and the same
+ * 		choices by the player) always produces the same game, and games played at the same
+ * 		time on different threads never share any state. It replaces the getRandomInt
+ * 		function, which seeded the global rand() with the current time (so games started in
+ * 		the same second played out identically), was not thread-safe, and used rand() % n,
+ * 		which favors the smaller numbers of a range.
+ *
+ * 		The generator is xoshiro256** (by David Blackman and Sebastiano Vigna), which has
+ * 		256 bits of state, passes every standard statistical test, and takes a handful of
+ * 		instructions per number. The state is filled from the seed with splitmix64.
+ *
+ * 		Numbers within a range are drawn with Lemire's multiply-and-reject method, which
+ * 		gives every number in the range exactly the same chance of being drawn.
+ *
+ * 		Independent streams for worker threads are created from a single seed with the
+ * 		stream number: stream n starts 2^128 * n numbers into the sequence of stream 0
+ * 		(using the generator's jump function), so no two streams can overlap.
+ *
+ * 		Private data members of the Random class include the following:
+ * 		- The four 64-bit words of the generator's state
+ *
+ * 		Public member functions of the Random class include the following:
+ * 		- A constructor that receives the seed and (optionally) the stream number
+ * 		- A function that returns the next 64 random bits
+ * 		- A function that returns a random int within a range (including both bounds)
+ * 		- A function that advances the generator by 2^128 numbers
+ * 		- A static function that returns an unpredictable seed for a new game
+ **************************************************************************************************/
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+class Random
+{
+	private:
+		// Private data member
+		std::uint64_t s[4];
+
+	public:
+		// Public member functions
+		Random(std::uint64_t seed, std::uint64_t stream = 0);
+		std::uint64_t next();
+		int get_int(int lowerBound, int upperBound);
+		void jump();
+		static std::uint64_t random_seed();
+};
+#endif
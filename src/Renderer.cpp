@@ -0,0 +1,484 @@
+/***************************************************************************************************
+ * Program Name: Renderer.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Renderer class that composes each screen of the game in memory and displays it
+ * 		with a single write to the terminal. The Renderer is a stream buffer: the
+ * 		TerminalIO class points std::cout at it, so all game text is appended to the
+ * 		Renderer's pending text instead of being written line by line. Nothing is written
+ * 		until present() is called, which happens right before the game blocks on user
+ * 		input (the InputReader of the input is tied to a stream that calls present()).
+ *
+ * 		Starting a new screen does not run the "clear" command. Instead, the first
+ * 		present() after clear_screen() writes ANSI escape sequences that move the cursor
+ * 		home and clear the terminal, followed by the text of the new screen. In diff mode,
+ * 		only the lines of the new screen that differ from the screen currently displayed
+ * 		are repainted. Diff mode falls back to a full repaint whenever the screen may have
+ * 		scrolled since the last screen was displayed.
+ **************************************************************************************************/
+#include "Renderer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <functional>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// ANSI escape sequences used to draw screens
+const std::string HOME_AND_CLEAR = "\x1b[H\x1b[2J";	// move cursor to top left and clear the screen
+const std::string CLEAR_LINE = "\x1b[2K";		// clear the entire line the cursor is on
+const std::string CLEAR_BELOW = "\x1b[J";		// clear from the cursor to the end of the screen
+
+// Number of rows kept free at the bottom of the terminal before diff mode assumes
+// that the screen may have scrolled (covers input echoes that are not counted exactly)
+const int SCROLL_MARGIN = 2;
+
+// Shortest write of static text displayed from where it is stored instead of being copied
+// (copying a shorter one costs less than another piece of the writev call)
+const std::size_t MIN_STATIC_LENGTH = 64;
+
+
+/***************************************************************************************************
+ * Description: Constructor for the nested PresentOnSync stream buffer. Receives a pointer to the
+ * 		Renderer whose present() function is called when the buffer is synced.
+ ***************************************************************************************************/
+
+Renderer::PresentOnSync::PresentOnSync(Renderer* renderer)
+{
+	this->renderer = renderer;
+}
+
+
+/***************************************************************************************************
+ * Description: Called when a stream using this buffer is flushed. Since the InputReader of the
+ * 		input is tied to that stream, this happens right before every read of user input.
+ * 		Displays the pending text and counts the row taken up by the echo of the line the
+ * 		user is about to type. Returns 0 to indicate success.
+ ***************************************************************************************************/
+
+int Renderer::PresentOnSync::sync()
+{
+	renderer->present();
+	renderer->rowsBelowFrame++;
+	return 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the file descriptor to which screens are written and a
+ * 		bool indicating whether or not diff mode is enabled.
+ ***************************************************************************************************/
+
+Renderer::Renderer(int outputFd, bool diffMode) : presentBuf(this), presentStream(&presentBuf)
+{
+	this->outputFd = outputFd;
+	this->diffMode = diffMode;
+	framePending = false;
+	rowsBelowFrame = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor that displays any text that has not been displayed yet.
+ ***************************************************************************************************/
+
+Renderer::~Renderer()
+{
+	present();
+}
+
+
+/***************************************************************************************************
+ * Description: Starts a new screen. Any text that has not been displayed yet would have been
+ * 		cleared from the screen immediately, so it is discarded (and if the screen was never
+ * 		displayed at all, as happens when its prompts are answered by input typed ahead, it
+ * 		is counted as skipped). Receives and returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::clear_screen()
+{
+	if (framePending && (!pending.empty() || !segments.empty()))
+	{
+		stats.screensSkipped++;
+	}
+	pending.clear();
+	segments.clear();
+	framePending = true;
+}
+
+
+/***************************************************************************************************
+ * Description: Displays all text written since the last call with a single write (a writev of the
+ * 		segments of the text, outside diff mode). If a new screen was started, the screen is
+ * 		drawn (in full, or only the changed lines in diff mode). Otherwise, the text is simply
+ * 		written below what is already displayed. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::present()
+{
+	// Outside diff mode, the segments are displayed as they were written, after the escape
+	// sequences that start a new screen (if one was started)
+	if (!diffMode)
+	{
+		pieces.clear();
+		if (framePending)
+		{
+			pieces.push_back({const_cast<char*>(HOME_AND_CLEAR.data()), HOME_AND_CLEAR.size()});
+			framePending = false;
+		}
+		for (const Segment& segment : segments)
+		{
+			const char* text = (segment.text != nullptr) ? segment.text : pending.data() + segment.offset;
+			pieces.push_back({const_cast<char*>(text), segment.length});
+			if (segment.text != nullptr)
+			{
+				stats.staticBytes += segment.length;
+			}
+		}
+		// (The pending text is cleared only once it has been written, since clearing a
+		// string overwrites its first character with the terminating null)
+		if (!pieces.empty())
+		{
+			write_pieces();
+		}
+		pending.clear();
+		segments.clear();
+		return;
+	}
+
+	std::string output;
+
+	if (framePending)
+	{
+		compose_frame(output);
+		framePending = false;
+	}
+	else
+	{
+		output = pending;
+
+		// Count the complete rows being written below the screen so that diff mode
+		// can tell whether the terminal may have scrolled
+		int rows, cols;
+		get_terminal_size(rows, cols);
+		size_t start = 0;
+		size_t newline = pending.find('\n');
+		while (newline != std::string::npos)
+		{
+			int width = display_width(pending.substr(start, newline - start));
+			rowsBelowFrame += (width > cols) ? ((width + cols - 1) / cols) : 1;
+			start = newline + 1;
+			newline = pending.find('\n', start);
+		}
+	}
+
+	pending.clear();
+	segments.clear();
+	if (!output.empty())
+	{
+		write_all(output);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives text that will not change or move while the Renderer exists (such as the
+ * 		game's Content). Writes of the text (or of any part of it at least MIN_STATIC_LENGTH
+ * 		bytes long) are displayed straight from where it is stored. The ranges of static
+ * 		text are kept sorted, with overlapping and adjacent ranges merged, so that a write
+ * 		is looked up with a binary search. Returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::add_static_text(std::string_view text)
+{
+	if (text.empty())
+	{
+		return;
+	}
+
+	std::less<const char*> before;
+	staticTexts.push_back(text);
+	std::sort(staticTexts.begin(), staticTexts.end(), [&](std::string_view first, std::string_view second)
+	{
+		return before(first.data(), second.data());
+	});
+
+	std::vector<std::string_view> merged;
+	for (std::string_view range : staticTexts)
+	{
+		if (!merged.empty() && !before(merged.back().data() + merged.back().size(), range.data()))
+		{
+			const char* end = std::max(merged.back().data() + merged.back().size(), range.data() + range.size(), before);
+			merged.back() = std::string_view(merged.back().data(), end - merged.back().data());
+		}
+		else
+		{
+			merged.push_back(range);
+		}
+	}
+	staticTexts.swap(merged);
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor that returns the stream which calls present() when it is flushed.
+ * 		TerminalIO ties its InputReader to this stream.
+ ***************************************************************************************************/
+
+std::ostream& Renderer::present_stream()
+{
+	return presentStream;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor that returns the counts of the Renderer's output since it was created.
+ ***************************************************************************************************/
+
+const RendererStats& Renderer::get_stats() const
+{
+	return this->stats;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that builds the output needed to display the pending text
+ * 		as a new screen. Receives the output string (passed by reference) to which the
+ * 		escape sequences and text are added. Returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::compose_frame(std::string& output)
+{
+	int termRows, termCols;
+	get_terminal_size(termRows, termCols);
+
+	// Split the screen into lines and determine the row on which each line starts
+	// (lines wider than the terminal wrap onto more than one row)
+	std::vector<std::string> lines;
+	std::vector<int> rows;
+	size_t start = 0;
+	int row = 1;
+	bool moreLines = true;
+	while (moreLines)
+	{
+		size_t newline = pending.find('\n', start);
+		moreLines = (newline != std::string::npos);
+		std::string line = pending.substr(start, moreLines ? (newline - start) : std::string::npos);
+
+		lines.push_back(line);
+		rows.push_back(row);
+
+		int width = display_width(line);
+		row += (width > termCols) ? ((width + termCols - 1) / termCols) : 1;
+		start = newline + 1;
+	}
+
+	// Only diff against the displayed screen if it cannot have scrolled off its rows
+	int rowsInUse = shownRows.empty() ? 0 : (shownRows.back() + rowsBelowFrame);
+	bool canDiff = diffMode && !shownLines.empty() && (rowsInUse + SCROLL_MARGIN) < termRows &&
+		       (rows.back() + SCROLL_MARGIN) < termRows;
+
+	if (!canDiff)
+	{
+		output = HOME_AND_CLEAR + pending;
+	}
+	else
+	{
+		for (size_t index = 0; index < lines.size(); index++)
+		{
+			// Skip lines that are already displayed on the same row. The last line is
+			// always written so that the cursor ends up right after it.
+			bool lastLine = (index == lines.size() - 1);
+			if (!lastLine && index < shownLines.size() && shownLines[index] == lines[index] &&
+			    shownRows[index] == rows[index])
+			{
+				continue;
+			}
+
+			output += "\x1b[" + std::to_string(rows[index]) + ";1H" + CLEAR_LINE + lines[index];
+		}
+		output += CLEAR_BELOW;
+	}
+
+	// Remember what is now displayed
+	shownLines.swap(lines);
+	shownRows.swap(rows);
+	rowsBelowFrame = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a pointer to text and its length, and returns
+ * 		whether or not the text lies entirely within a range of static text.
+ ***************************************************************************************************/
+
+bool Renderer::is_static(const char* text, std::size_t length) const
+{
+	std::less<const char*> before;
+	std::vector<std::string_view>::const_iterator after = std::upper_bound(staticTexts.begin(), staticTexts.end(), text,
+		[&](const char* start, std::string_view range)
+	{
+		return before(start, range.data());
+	});
+	if (after == staticTexts.begin())
+	{
+		return false;
+	}
+	std::string_view range = *(after - 1);
+	return !before(range.data() + range.size(), text + length);
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives text and its length, and copies it to the end
+ * 		of the pending text (extending the last segment if it is a run of copied text).
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::append_copy(const char* text, std::size_t length)
+{
+	if (segments.empty() || segments.back().text != nullptr)
+	{
+		segments.push_back({nullptr, pending.size(), 0});
+	}
+	segments.back().length += length;
+	pending.append(text, length);
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that writes the received string to the output file
+ * 		descriptor (see write_pieces). Returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::write_all(const std::string& output)
+{
+	pieces.clear();
+	pieces.push_back({const_cast<char*>(output.data()), output.size()});
+	write_pieces();
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that writes the pieces to the output file descriptor with
+ * 		writev (a single call unless there are more than IOV_MAX pieces), retrying if the
+ * 		write is interrupted or only partially completed, and counts the calls and bytes.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void Renderer::write_pieces()
+{
+	std::size_t first = 0;
+	while (first < pieces.size())
+	{
+		int count = static_cast<int>(std::min<std::size_t>(pieces.size() - first, IOV_MAX));
+		ssize_t written = writev(outputFd, &pieces[first], count);
+		stats.writeCalls++;
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return;
+		}
+		stats.bytesWritten += written;
+
+		// Skip the pieces written in full, and the part written of the next one
+		while (first < pieces.size() && static_cast<std::size_t>(written) >= pieces[first].iov_len)
+		{
+			written -= pieces[first].iov_len;
+			first++;
+		}
+		if (written > 0)
+		{
+			pieces[first].iov_base = static_cast<char*>(pieces[first].iov_base) + written;
+			pieces[first].iov_len -= written;
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives two ints by reference and sets them to the
+ * 		number of rows and columns of the terminal. If the output is not a terminal, the size
+ * 		is treated as unlimited since nobody is looking at a screen that could scroll.
+ ***************************************************************************************************/
+
+void Renderer::get_terminal_size(int& rows, int& cols) const
+{
+	struct winsize size;
+	if (ioctl(outputFd, TIOCGWINSZ, &size) == 0 && size.ws_row > 0 && size.ws_col > 0)
+	{
+		rows = size.ws_row;
+		cols = size.ws_col;
+	}
+	else
+	{
+		rows = 100000;
+		cols = 100000;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private static member function that receives a line of text and returns the
+ * 		number of terminal columns it occupies (tabs advance to the next multiple of 8 and
+ * 		UTF-8 continuation bytes take up no column of their own).
+ ***************************************************************************************************/
+
+int Renderer::display_width(const std::string& line)
+{
+	int width = 0;
+	for (size_t index = 0; index < line.size(); index++)
+	{
+		unsigned char ch = line[index];
+		if (ch == '\t')
+		{
+			width = (width / 8 + 1) * 8;
+		}
+		else if ((ch & 0xC0) != 0x80)
+		{
+			width++;
+		}
+	}
+	return width;
+}
+
+
+/***************************************************************************************************
+ * Description: Protected member functions that override std::streambuf so that text written to a
+ * 		stream using the Renderer is added to the pending text (as a segment of its own if it
+ * 		is static text). sync() is called whenever the stream is flushed (for example by
+ * 		std::endl); it only counts the flush, since the pending text is displayed all at once
+ * 		right before the next read of user input.
+ ***************************************************************************************************/
+
+int Renderer::overflow(int ch)
+{
+	if (ch != traits_type::eof())
+	{
+		char character = static_cast<char>(ch);
+		append_copy(&character, 1);
+	}
+	return traits_type::not_eof(ch);
+}
+
+std::streamsize Renderer::xsputn(const char* text, std::streamsize count)
+{
+	if (!diffMode && static_cast<std::size_t>(count) >= MIN_STATIC_LENGTH && is_static(text, count))
+	{
+		segments.push_back({text, 0, static_cast<std::size_t>(count)});
+	}
+	else
+	{
+		append_copy(text, count);
+	}
+	return count;
+}
+
+int Renderer::sync()
+{
+	stats.flushes++;
+	return 0;
+}
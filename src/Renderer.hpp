@@ -0,0 +1,133 @@
+/***************************************************************************************************
+ * Program Name: Renderer.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Renderer class that composes each screen of the game in memory and displays it
+ * 		with a single write to the terminal. The Renderer is a stream buffer: the
+ * 		TerminalIO class points std::cout at it, so all game text is appended to the
+ * 		Renderer's pending text instead of being written line by line. Nothing is written
+ * 		until present() is called, which happens right before the game blocks on user
+ * 		input (std::cin is tied to a stream that calls present()).
+ *
+ * 		Starting a new screen does not run the "clear" command. Instead, the first
+ * 		present() after clear_screen() writes ANSI escape sequences that move the cursor
+ * 		home and clear the terminal, followed by the text of the new screen. In diff mode,
+ * 		only the lines of the new screen that differ from the screen currently displayed
+ * 		are repainted. Diff mode falls back to a full repaint whenever the screen may have
+ * 		scrolled since the last screen was displayed.
+ *
+ * 		Text that never changes while the Renderer exists (the game's Content, registered
+ * 		with add_static_text) is not copied into the pending text. Instead, the pending text
+ * 		is kept as a list of segments, each either a run of copied text or a view of static
+ * 		text, and the segments are displayed with a single writev call. (In diff mode,
+ * 		which compares the lines of each screen, all text is copied.) The Renderer counts
+ * 		the write calls it makes, the flushes it has absorbed (such as those of std::endl),
+ * 		and the bytes it has written (and how many of them were displayed straight from
+ * 		static text), so that benchmarks can check how much output each turn costs.
+ *
+ *		Private data members include the following:
+ *		- The file descriptor to which screens are written
+ *		- A bool indicating whether or not diff mode is enabled
+ *		- A string holding the text written since the last call to present(), the segments
+ *		  in which it is displayed, and the ranges of static text
+ *		- A bool indicating whether a new screen has been started but not yet displayed
+ *		- The lines of the screen currently displayed and the row on which each one starts
+ *		- The number of rows that have been written below the screen currently displayed
+ *		- A stream whose buffer calls present() when it is flushed (the InputReader is tied to it)
+ *		- The counts of write calls, flushes, bytes written, and screens skipped
+ *
+ *		Public member functions include the following:
+ *		- A constructor and destructor
+ *		- A function that starts a new screen
+ *		- A function that displays everything written since the last call
+ *		- A function that registers text that can be displayed without being copied
+ *		- Accessors for the stream that must be tied to the InputReader and for the counts
+ *
+ *		The RendererStats struct is also declared in this header file.
+ *
+ *		Protected member functions override the std::streambuf functions that receive
+ *		characters written to the stream.
+ **************************************************************************************************/
+#ifndef RENDERER_HPP
+#define RENDERER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/uio.h>
+
+// Struct counting the output of a Renderer since it was created
+struct RendererStats
+{
+	long writeCalls = 0;		// write and writev system calls made
+	long flushes = 0;		// flushes of the stream absorbed without writing (std::endl)
+	long bytesWritten = 0;		// bytes written, escape sequences included
+	long staticBytes = 0;		// bytes written straight from static text, without a copy
+	long screensSkipped = 0;	// screens cleared before they were displayed (see InputReader)
+};
+
+class Renderer : public std::streambuf
+{
+	private:
+		// Stream buffer whose only job is to call present() when the stream using it is flushed
+		class PresentOnSync : public std::streambuf
+		{
+			private:
+				Renderer* renderer;
+			public:
+				PresentOnSync(Renderer* renderer);
+			protected:
+				virtual int sync() override;
+		};
+
+		// Piece of the pending text: static text displayed from where it is stored, or
+		// (if text is nullptr) a run of the pending string starting at an offset
+		struct Segment
+		{
+			const char* text;
+			std::size_t offset;
+			std::size_t length;
+		};
+
+		// Private data members
+		int outputFd;
+		bool diffMode;
+		std::string pending;
+		std::vector<Segment> segments;
+		std::vector<std::string_view> staticTexts;
+		std::vector<iovec> pieces;
+		bool framePending;
+		std::vector<std::string> shownLines;
+		std::vector<int> shownRows;
+		int rowsBelowFrame;
+		PresentOnSync presentBuf;
+		std::ostream presentStream;
+		RendererStats stats;
+
+		// Private member functions
+		void get_terminal_size(int& rows, int& cols) const;
+		static int display_width(const std::string& line);
+		void compose_frame(std::string& output);
+		bool is_static(const char* text, std::size_t length) const;
+		void append_copy(const char* text, std::size_t length);
+		void write_all(const std::string& output);
+		void write_pieces();
+
+	protected:
+		virtual int overflow(int ch) override;
+		virtual std::streamsize xsputn(const char* text, std::streamsize count) override;
+		virtual int sync() override;
+
+	public:
+		Renderer(int outputFd, bool diffMode);
+		virtual ~Renderer();
+		void clear_screen();
+		void present();
+		void add_static_text(std::string_view text);
+		std::ostream& present_stream();
+		const RendererStats& get_stats() const;
+};
+#endif
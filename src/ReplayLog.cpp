@@ -0,0 +1,460 @@
+/***************************************************************************************************
+ * Program Name: ReplayLog.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: ReplayLog class that records the map, the seed, and the menu choices of a game
+ * 		(with a hash of its final state), encodes them as a compact record of varints, and
+ * 		plays the game again headlessly to check that it ends in the same state. See
+ * 		ReplayLog.hpp.
+ **************************************************************************************************/
+#include "ReplayLog.hpp"
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Game.hpp"
+#include "HintTable.hpp"
+#include "InputReader.hpp"
+
+// Flags of a record: its game offered hints, stopped before it was over, or was played on a
+// generated map (whose MapSpec the record holds)
+const std::uint8_t HINTS_OFFERED = 1;
+const std::uint8_t UNFINISHED = 2;
+const std::uint8_t GENERATED_MAP = 4;
+
+// Number of bytes in the fingerprint of the map and in the hash at the end of a record
+const int HASH_BYTES = 8;
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a string of bytes and a number. Appends the number to
+ * 		the string as a varint. Returns nothing.
+ ***************************************************************************************************/
+
+static void put_varint(std::string& bytes, std::uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		bytes.push_back(static_cast<char>((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	bytes.push_back(static_cast<char>(value));
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a pointer to the next byte to read (passed by
+ * 		reference), the end of the bytes, and a number passed by reference. Reads a varint
+ * 		into "value" and moves the pointer past it. Returns false if the bytes end in the
+ * 		middle of the varint or it is longer than any 64-bit number.
+ ***************************************************************************************************/
+
+static bool get_varint(const char*& next, const char* end, std::uint64_t& value)
+{
+	value = 0;
+	for (int shift = 0; shift < 64 && next < end; shift += 7)
+	{
+		std::uint8_t byte = static_cast<std::uint8_t>(*next++);
+		value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a string of bytes and a 64-bit number. Appends the
+ * 		number to the string as HASH_BYTES bytes, lowest byte first. Returns nothing.
+ ***************************************************************************************************/
+
+static void put_hash(std::string& bytes, std::uint64_t value)
+{
+	for (int byteNum = 0; byteNum < HASH_BYTES; byteNum++)
+	{
+		bytes.push_back(static_cast<char>(value >> (8 * byteNum)));
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a pointer to the next byte to read (passed by
+ * 		reference), the end of the bytes, and a number passed by reference. Reads HASH_BYTES
+ * 		bytes, lowest byte first, into "value" and moves the pointer past them. Returns
+ * 		false if fewer bytes are left.
+ ***************************************************************************************************/
+
+static bool get_hash(const char*& next, const char* end, std::uint64_t& value)
+{
+	if (end - next < HASH_BYTES)
+	{
+		return false;
+	}
+	value = 0;
+	for (int byteNum = 0; byteNum < HASH_BYTES; byteNum++)
+	{
+		value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*next++)) << (8 * byteNum);
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives a pointer to the next byte to read (passed by
+ * 		reference), the end of the bytes, the largest value allowed, and a number passed by
+ * 		reference. Reads a varint into "value" (see get_varint). Throws std::runtime_error if
+ * 		the record is damaged (the varint is cut short or larger than the largest value).
+ ***************************************************************************************************/
+
+template <typename Number>
+static void get_field(const char*& next, const char* end, std::uint64_t maxValue, Number& value)
+{
+	std::uint64_t field = 0;
+	if (!get_varint(next, end, field) || field > maxValue)
+	{
+		throw std::runtime_error("A record of the log file is damaged");
+	}
+	value = static_cast<Number>(field);
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that creates an empty log.
+ ***************************************************************************************************/
+
+ReplayLog::ReplayLog()
+{
+	seed = 0;
+	hintsOffered = false;
+	finished = false;
+	mapFingerprint = 0;
+	generatedMap = false;
+	stateHash = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the seed of a new game, whether the game offers hints, the map on which it
+ * 		is played, and the MapSpec from which the map was generated (or nullptr if it was
+ * 		not generated). Empties the log (keeping the memory of its choices for the next game)
+ * 		and starts recording the game. Returns nothing.
+ ***************************************************************************************************/
+
+void ReplayLog::start(std::uint64_t seed, bool hintsOffered, const GameMap& map, const MapSpec* mapSpec)
+{
+	this->seed = seed;
+	this->hintsOffered = hintsOffered;
+	finished = false;
+	mapFingerprint = map.fingerprint();
+	generatedMap = (mapSpec != nullptr);
+	this->mapSpec = generatedMap ? *mapSpec : MapSpec();
+	choices.clear();
+	stateHash = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a validated menu choice and adds it to the log. Returns nothing.
+ ***************************************************************************************************/
+
+void ReplayLog::add_choice(int choice)
+{
+	choices.push_back(static_cast<std::uint8_t>(choice));
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state at the end of the game and records its hash. Returns nothing.
+ ***************************************************************************************************/
+
+void ReplayLog::finish(const GameState& finalState)
+{
+	finished = true;
+	stateHash = hash_state(finalState);
+}
+
+
+/***************************************************************************************************
+ * Description: Records that the game stopped before it was over (see ReplayLog.hpp). Receives and
+ * 		returns nothing.
+ ***************************************************************************************************/
+
+void ReplayLog::stop()
+{
+	finished = false;
+	stateHash = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing. They return the seed of the game, whether
+ * 		or not the game offered hints, whether or not it is finished, the fingerprint of its
+ * 		map, the MapSpec from which the map was generated (or nullptr if it was not), the
+ * 		choices made, and the hash of the final state.
+ ***************************************************************************************************/
+
+std::uint64_t ReplayLog::get_seed() const
+{
+	return this->seed;
+}
+
+bool ReplayLog::get_hints_offered() const
+{
+	return this->hintsOffered;
+}
+
+bool ReplayLog::get_finished() const
+{
+	return this->finished;
+}
+
+std::uint64_t ReplayLog::get_map_fingerprint() const
+{
+	return this->mapFingerprint;
+}
+
+const MapSpec* ReplayLog::get_map_spec() const
+{
+	return generatedMap ? &this->mapSpec : nullptr;
+}
+
+const std::vector<std::uint8_t>& ReplayLog::get_choices() const
+{
+	return this->choices;
+}
+
+std::uint64_t ReplayLog::get_state_hash() const
+{
+	return this->stateHash;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a string of bytes and appends the log to it as a record (see
+ * 		ReplayLog.hpp). Returns nothing.
+ ***************************************************************************************************/
+
+void ReplayLog::encode(std::string& bytes) const
+{
+	std::string body;
+	put_varint(body, seed);
+	body.push_back(static_cast<char>((hintsOffered ? HINTS_OFFERED : 0) | (finished ? 0 : UNFINISHED) |
+					 (generatedMap ? GENERATED_MAP : 0)));
+	put_hash(body, mapFingerprint);
+	if (generatedMap)
+	{
+		put_varint(body, mapSpec.rows);
+		put_varint(body, mapSpec.cols);
+		put_varint(body, static_cast<std::uint64_t>(mapSpec.keepPercent));
+		for (int weight : mapSpec.typeWeights)
+		{
+			put_varint(body, static_cast<std::uint64_t>(weight));
+		}
+		put_varint(body, mapSpec.seed);
+	}
+	put_varint(body, choices.size());
+	for (std::uint8_t choice : choices)
+	{
+		put_varint(body, choice);
+	}
+	put_hash(body, stateHash);
+
+	put_varint(bytes, body.size());
+	bytes += body;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a pointer to the next record of a log file's bytes (passed by reference)
+ * 		and the end of the bytes. Replaces the log with the record and moves the pointer past
+ * 		it. Returns true, or false if there are no more records. Throws std::runtime_error if
+ * 		the record is cut short or damaged.
+ ***************************************************************************************************/
+
+bool ReplayLog::decode(const char*& next, const char* end)
+{
+	if (next >= end)
+	{
+		return false;
+	}
+
+	std::uint64_t length = 0;
+	if (!get_varint(next, end, length) || length > static_cast<std::uint64_t>(end - next))
+	{
+		throw std::runtime_error("A record of the log file is cut short");
+	}
+	const char* recordEnd = next + length;
+
+	std::uint64_t numChoices = 0;
+	if (!get_varint(next, recordEnd, seed) || next >= recordEnd)
+	{
+		throw std::runtime_error("A record of the log file is damaged");
+	}
+	std::uint8_t flags = static_cast<std::uint8_t>(*next++);
+	hintsOffered = (flags & HINTS_OFFERED) != 0;
+	finished = !(flags & UNFINISHED);
+	generatedMap = (flags & GENERATED_MAP) != 0;
+	if (!get_hash(next, recordEnd, mapFingerprint))
+	{
+		throw std::runtime_error("A record of the log file is damaged");
+	}
+	mapSpec = MapSpec();
+	if (generatedMap)
+	{
+		get_field(next, recordEnd, UINT32_MAX, mapSpec.rows);
+		get_field(next, recordEnd, UINT32_MAX, mapSpec.cols);
+		get_field(next, recordEnd, INT_MAX, mapSpec.keepPercent);
+		for (int& weight : mapSpec.typeWeights)
+		{
+			get_field(next, recordEnd, INT_MAX, weight);
+		}
+		get_field(next, recordEnd, UINT64_MAX, mapSpec.seed);
+	}
+	if (!get_varint(next, recordEnd, numChoices) || numChoices > static_cast<std::uint64_t>(recordEnd - next))
+	{
+		throw std::runtime_error("A record of the log file is damaged");
+	}
+
+	choices.clear();
+	for (std::uint64_t choiceNum = 0; choiceNum < numChoices; choiceNum++)
+	{
+		std::uint64_t choice = 0;
+		if (!get_varint(next, recordEnd, choice) || choice > 0xFF)
+		{
+			throw std::runtime_error("A record of the log file is damaged");
+		}
+		choices.push_back(static_cast<std::uint8_t>(choice));
+	}
+
+	if (recordEnd - next != HASH_BYTES)
+	{
+		throw std::runtime_error("A record of the log file is damaged");
+	}
+	get_hash(next, recordEnd, stateHash);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a log file. Appends the log's record to the file (creating the
+ * 		file if it does not exist) with a single write call, so that records appended at the
+ * 		same time by other threads or processes are never interleaved with it. Returns true,
+ * 		or false if the file could not be opened or written.
+ ***************************************************************************************************/
+
+bool ReplayLog::append_to(const char* fileName) const
+{
+	std::string record;
+	encode(record);
+
+	int fd = open(fileName, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (fd < 0)
+	{
+		return false;
+	}
+	bool written = (write(fd, record.data(), record.size()) == static_cast<ssize_t>(record.size()));
+	return (close(fd) == 0) && written;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the map on which the game was played and the table of hints (needed only
+ * 		if the game offered hints). Plays the game again from its seed through the HeadlessIO
+ * 		frontend, making the logged choices. Returns true if the game asked for every logged
+ * 		choice and ended in a state with the logged hash (or, if the game is unfinished,
+ * 		stopped at the next menu or ended), or false if it did not. Throws std::runtime_error if the
+ * 		map is not the one the game was played on, the game asks for a choice the log does
+ * 		not have (or one not on the menu), or the game offered hints and there is no table of
+ * 		hints.
+ ***************************************************************************************************/
+
+bool ReplayLog::replay(std::shared_ptr<const GameMap> map, std::shared_ptr<const HintTable> hints) const
+{
+	if (map->fingerprint() != mapFingerprint)
+	{
+		throw std::runtime_error("The game was played on a different map");
+	}
+	if (hintsOffered && hints == nullptr)
+	{
+		throw std::runtime_error("The game offered hints, so it can only be played again with a table of hints");
+	}
+
+	ReplayDecisions decisions(*this);
+	HeadlessIO io(decisions);
+	Game game(io, seed, map);
+	if (hintsOffered)
+	{
+		game.set_hints(hints);
+	}
+	try
+	{
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+	}
+	catch (const EndOfInput&)
+	{
+		// An unfinished game stops at the menu after its last choice
+		if (finished)
+		{
+			throw;
+		}
+		return decisions.get_choices_made() == choices.size();
+	}
+
+	// An unfinished game may also have stopped at a pause just before it was over
+	return decisions.get_choices_made() == choices.size() && (!finished || hash_state(game.snapshot()) == stateHash);
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor for ReplayDecisions that receives the log whose choices to make (which
+ * 		must stay valid while the game is played).
+ ***************************************************************************************************/
+
+ReplayDecisions::ReplayDecisions(const ReplayLog& log)
+{
+	this->log = &log;
+	nextChoice = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt (unused) and the menu choices. Returns the next choice of the
+ * 		log. Throws EndOfInput if the log of an unfinished game has no more choices (the game
+ * 		stopped here), or std::runtime_error if the log of a finished game has no more
+ * 		choices or the next one is not on the menu (the game has gone differently than when
+ * 		it was recorded).
+ ***************************************************************************************************/
+
+int ReplayDecisions::choose([[maybe_unused]] Prompt prompt, MenuChoices menuChoices)
+{
+	if (nextChoice >= log->get_choices().size())
+	{
+		if (!log->get_finished())
+		{
+			throw EndOfInput();
+		}
+		throw std::runtime_error("The game asked for more choices than the log holds");
+	}
+	int choice = log->get_choices()[nextChoice++];
+	if (choice < 1 || choice > static_cast<int>(menuChoices.size()))
+	{
+		throw std::runtime_error("Choice " + std::to_string(choice) + " of the log is not on the menu");
+	}
+	return choice;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of choices made.
+ ***************************************************************************************************/
+
+std::size_t ReplayDecisions::get_choices_made() const
+{
+	return this->nextChoice;
+}
@@ -0,0 +1,128 @@
+/***************************************************************************************************
+ * Program Name: ReplayLog.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: ReplayLog class that records a game compactly enough to keep a record of every
+ * 		game played, and plays a recorded game again exactly. A game is decided entirely by
+ * 		its map, its seed (from which its Random number generator draws every random event)
+ * 		and the menu choices made by the player, so a log holds only those, together with a
+ * 		hash of the state at the end of the game (see hash_state). Playing the log again
+ * 		through the HeadlessIO frontend, with no text shown and no one to wait for, must make
+ * 		the same choices at the same menus and end in a state with the same hash; if it does
+ * 		not, the game's rules have changed since the log was recorded (or the log is
+ * 		damaged).
+ *
+ * 		The map is recorded by its fingerprint (see GameMap::fingerprint), so that a game is
+ * 		never played again on a different map, and, for a map made by the MapGenerator, by
+ * 		the MapSpec it was generated from, so that the map can be generated again.
+ *
+ * 		A game that stops before it is over (the player disconnects or quits, or the server
+ * 		is stopped) is recorded too, as unfinished, with the choices made until then. It
+ * 		stopped at a prompt (a pause or a menu) the log cannot tell apart, so it has no hash:
+ * 		playing it again checks that the game asks for every recorded choice, on its menu,
+ * 		and then stops at the next menu (or the end of the game).
+ *
+ * 		A GameIO records the choices made at its menus into the log set with set_replay_log
+ * 		(see GameIO.hpp), whichever frontend the game is played through. Requests for a
+ * 		hint are recorded too (they are menu choices like any other), so a game in which
+ * 		hints were offered must be played again with a table of hints.
+ *
+ * 		Each log is encoded as one record, and records are appended one after another to
+ * 		a log file, each with a single write call (so that games finishing at the same time
+ * 		in different threads or processes never interleave their records). A record is laid
+ * 		out as follows, each number being a varint (7 bits per byte, lowest bits first, the
+ * 		high bit of each byte set if another byte follows) unless noted:
+ * 		- The number of bytes in the rest of the record
+ * 		- The seed
+ * 		- A byte of flags (1 if hints were offered, 2 if the game is unfinished, 4 if the
+ * 		  map was generated)
+ * 		- The 64-bit fingerprint of the map (8 bytes, lowest byte first)
+ * 		- If the map was generated, its MapSpec: the rows, the columns, the percentage of
+ * 		  neighbors kept, the weight of each type of space, and the seed
+ * 		- The number of choices, followed by each choice
+ * 		- The 64-bit hash of the final state (8 bytes, lowest byte first, 0 if the game is
+ * 		  unfinished)
+ * 		A choice takes one byte, so a typical game is recorded in a few dozen bytes.
+ *
+ *		Private data members of the ReplayLog class include:
+ *		- The seed, whether hints were offered, and whether the game is finished
+ *		- The fingerprint of the map, whether it was generated, and the MapSpec it was
+ *		  generated from
+ *		- The choices and the hash of the final state
+ *
+ *		Public member functions of the ReplayLog class include:
+ *		- A constructor
+ *		- Functions that start a log for a new game, record a choice, and record the state
+ *		  at the end of the game (or that the game stopped before it was over)
+ *		- Accessor methods for the seed, whether hints were offered, whether the game is
+ *		  finished, the fingerprint of the map, the MapSpec of a generated map, the choices,
+ *		  and the hash of the final state
+ *		- Functions that encode a log as a record, decode the next record of a log file,
+ *		  and append a log's record to a log file
+ *		- A function that plays the game again and checks the state at its end
+ *
+ *		The ReplayDecisions class (the DecisionSource through which a game is played again)
+ *		is also declared in this header file.
+ **************************************************************************************************/
+#ifndef REPLAYLOG_HPP
+#define REPLAYLOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "HeadlessIO.hpp"
+#include "GameState.hpp"
+#include "MapGenerator.hpp"
+
+class HintTable;
+
+class ReplayLog
+{
+	private:
+		// Private data members
+		std::uint64_t seed;
+		bool hintsOffered;
+		bool finished;
+		std::uint64_t mapFingerprint;
+		bool generatedMap;
+		MapSpec mapSpec;
+		std::vector<std::uint8_t> choices;
+		std::uint64_t stateHash;
+
+	public:
+		// Public member functions
+		ReplayLog();
+		void start(std::uint64_t seed, bool hintsOffered, const GameMap& map, const MapSpec* mapSpec = nullptr);
+		void add_choice(int choice);
+		void finish(const GameState& finalState);
+		void stop();
+		std::uint64_t get_seed() const;
+		bool get_hints_offered() const;
+		bool get_finished() const;
+		std::uint64_t get_map_fingerprint() const;
+		const MapSpec* get_map_spec() const;
+		const std::vector<std::uint8_t>& get_choices() const;
+		std::uint64_t get_state_hash() const;
+		void encode(std::string& bytes) const;
+		bool decode(const char*& next, const char* end);
+		bool append_to(const char* fileName) const;
+		bool replay(std::shared_ptr<const GameMap> map, std::shared_ptr<const HintTable> hints) const;
+};
+
+// DecisionSource that makes the choices of a log, one after another, and throws
+// std::runtime_error if the game asks for a choice the log does not have (EndOfInput,
+// if the log is of an unfinished game)
+class ReplayDecisions : public DecisionSource
+{
+	private:
+		const ReplayLog* log;
+		std::size_t nextChoice;
+
+	public:
+		ReplayDecisions(const ReplayLog& log);
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) override;
+		std::size_t get_choices_made() const;
+};
+#endif
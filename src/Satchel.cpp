@@ -0,0 +1,136 @@
+/***************************************************************************************************
+ * Program Name: Satchel.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Item registry and Satchel class representing the items the player is carrying.
+ *
+ * 		Every item in the game is identified by a small integer ItemId. The name of an item
+ * 		is only needed when it is displayed, so names are looked up from the ID with the
+ * 		item_name function.
+ *
+ * 		The Satchel stores one bit per item, so checking for, adding, or removing an item
+ * 		never allocates memory, and a Satchel can be copied like a plain int. A Satchel
+ * 		never holds more than SATCHEL_CAPACITY items or more than one of the same item.
+ **************************************************************************************************/
+#include "Satchel.hpp"
+
+// Names of the items, indexed by item ID
+const std::string ITEM_NAMES[NUM_ITEMS] = {"grain", "olive oil", "permit", "salt", "sandals", "scroll", "tunic", "wine"};
+
+
+/***************************************************************************************************
+ * Description: Function that receives an item ID and returns the name of that item.
+ ***************************************************************************************************/
+
+const std::string& item_name(ItemId item)
+{
+	return ITEM_NAMES[item];
+}
+
+
+/***************************************************************************************************
+ * Description: Default constructor that creates an empty satchel.
+ ***************************************************************************************************/
+
+Satchel::Satchel()
+{
+	items = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives an item ID and returns a bool indicating whether or not that item is in
+ * 		the satchel.
+ ***************************************************************************************************/
+
+bool Satchel::contains(ItemId item) const
+{
+	return (items & (1 << item)) != 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives an item ID and adds the item to the satchel if the satchel is not full and
+ * 		does not already contain the item. Returns a bool indicating whether or not the
+ * 		item was added.
+ ***************************************************************************************************/
+
+bool Satchel::insert(ItemId item)
+{
+	if (full() || contains(item))
+	{
+		return false;
+	}
+
+	items |= (1 << item);
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives an item ID and removes the item from the satchel (nothing happens if the
+ * 		item is not in the satchel). Returns nothing.
+ ***************************************************************************************************/
+
+void Satchel::erase(ItemId item)
+{
+	items &= ~(1 << item);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the number of items in the satchel.
+ ***************************************************************************************************/
+
+int Satchel::size() const
+{
+	return __builtin_popcount(items);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns a bool indicating whether or not the satchel is empty.
+ ***************************************************************************************************/
+
+bool Satchel::empty() const
+{
+	return items == 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns a bool indicating whether or not the satchel holds
+ * 		SATCHEL_CAPACITY items.
+ ***************************************************************************************************/
+
+bool Satchel::full() const
+{
+	return size() >= SATCHEL_CAPACITY;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the bits representing the
+ * 		contents of the satchel (bit number N is set when the item with ID N is present).
+ ***************************************************************************************************/
+
+unsigned char Satchel::get_bits() const
+{
+	return this->items;
+}
+
+
+/***************************************************************************************************
+ * Description: Equality operators that receive another Satchel and return whether or not the two
+ * 		satchels hold exactly the same items.
+ ***************************************************************************************************/
+
+bool Satchel::operator==(const Satchel& other) const
+{
+	return items == other.items;
+}
+
+bool Satchel::operator!=(const Satchel& other) const
+{
+	return items != other.items;
+}
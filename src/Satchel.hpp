@@ -0,0 +1,68 @@
+/***************************************************************************************************
+ * Program Name: Satchel.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Item registry and Satchel class representing the items the player is carrying.
+ *
+ * 		Every item in the game is identified by a small integer ItemId (the constants
+ * 		below). The name of an item is only needed when it is displayed, so names are
+ * 		looked up from the ID with the item_name function. Item IDs are assigned in
+ * 		alphabetical order of the item names so that listing the items in ID order
+ * 		displays them in the same order as before items had IDs.
+ *
+ * 		The Satchel stores one bit per item, so checking for, adding, or removing an item
+ * 		never allocates memory, and a Satchel can be copied like a plain int. A Satchel
+ * 		never holds more than SATCHEL_CAPACITY items or more than one of the same item.
+ *
+ *		Private data members of the Satchel class include the following:
+ *		- An unsigned char whose bit number N is set when the item with ID N is in the satchel
+ *
+ *		Public member functions of the Satchel class include the following:
+ *		- A constructor
+ *		- A function that checks whether or not a given item is in the satchel
+ *		- A function that adds an item (if there is room and it is not already there)
+ *		- A function that removes an item
+ *		- Functions that return the number of items and whether the satchel is empty or full
+ *		- An accessor for the bits representing the contents of the satchel
+ *		- Equality operators
+ **************************************************************************************************/
+#ifndef SATCHEL_HPP
+#define SATCHEL_HPP
+
+#include <string>
+
+// Item IDs (in alphabetical order of item names)
+typedef unsigned char ItemId;
+const ItemId GRAIN = 0;
+const ItemId OLIVE_OIL = 1;
+const ItemId PERMIT = 2;
+const ItemId SALT = 3;
+const ItemId SANDALS = 4;
+const ItemId SCROLL = 5;
+const ItemId TUNIC = 6;
+const ItemId WINE = 7;
+const int NUM_ITEMS = 8;			// total number of different items
+
+const int SATCHEL_CAPACITY = 3;		// max number of items user can carry at one time
+
+// Function that returns the name of an item given its ID
+const std::string& item_name(ItemId item);
+
+class Satchel
+{
+	private:
+		unsigned char items;
+
+	public:
+		Satchel();
+		bool contains(ItemId item) const;
+		bool insert(ItemId item);
+		void erase(ItemId item);
+		int size() const;
+		bool empty() const;
+		bool full() const;
+		unsigned char get_bits() const;
+		bool operator==(const Satchel& other) const;
+		bool operator!=(const Satchel& other) const;
+};
+#endif
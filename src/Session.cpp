@@ -0,0 +1,278 @@
+/***************************************************************************************************
+ * Program Name: Session.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Session class that holds one player's games on the game server, playing the
+ * 		instructions, each game, and the play again menu as a coroutine that is suspended
+ * 		while waiting for input and resumed when it arrives. See Session.hpp.
+ **************************************************************************************************/
+#include "Session.hpp"
+#include "enterValidInt.hpp"
+
+// Bytes of input kept while waiting for the end of a line (far more than the longest line a
+// player could type ahead to answer every prompt of a game)
+const size_t MAX_LINE_LENGTH = 8192;
+
+/***************************************************************************************************
+ * Description: Constructor that receives the table of hints to offer in every game (shared with
+ * 		the other sessions, or nullptr for none) and the name of the log file to which to
+ * 		append the record of every game (see ReplayLog.hpp, or empty for none), and creates
+ * 		a session that has not started yet.
+ ***************************************************************************************************/
+
+Session::Session(std::shared_ptr<const HintTable> hints, const std::string& replayFileName)
+{
+	answersGiven = 0;
+	this->hints = std::move(hints);
+	this->replayFileName = replayFileName;
+	recording = false;
+}
+
+
+/***************************************************************************************************
+ * Description: Destructor for Session class. If a game is being recorded (the player disconnected
+ * 		or the server is stopping before the game was over), appends its record, as
+ * 		unfinished, to the log file. The suspended sequence (if any) is destroyed by its Task
+ * 		and the Game by its unique_ptr.
+ ***************************************************************************************************/
+
+Session::~Session()
+{
+	if (recording)
+	{
+		replayLog.stop();
+		append_record();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a string to which output is appended. Runs the session until the first
+ * 		prompt (the first pause of the instructions) and appends its output. Returns nothing.
+ ***************************************************************************************************/
+
+void Session::start(std::string& reply)
+{
+	sequence = play();
+	sequence.start();
+	io.take_output(reply);
+	if (sequence.done())
+	{
+		sequence.get();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives input read from the player's socket and a string to which output is
+ * 		appended. Each complete line of input answers the pending prompt (or is rejected
+ * 		with the same message the terminal game displays). Input after the last newline is
+ * 		kept until the rest of its line arrives. Returns true, or false if more than
+ * 		MAX_LINE_LENGTH bytes arrived without ending their line (the player's connection
+ * 		should then be closed, and the input is dropped).
+ ***************************************************************************************************/
+
+bool Session::receive(std::string_view input, std::string& reply)
+{
+	size_t start = 0;
+	size_t newline = input.find('\n');
+	while (newline != std::string_view::npos && !finished())
+	{
+		std::string_view piece = input.substr(start, newline - start);
+		if (partialLine.empty())
+		{
+			handle_line(piece, reply);
+		}
+		else
+		{
+			partialLine.append(piece);
+			std::string line;
+			line.swap(partialLine);
+			handle_line(line, reply);
+		}
+		start = newline + 1;
+		newline = input.find('\n', start);
+	}
+
+	if (!finished())
+	{
+		if (partialLine.size() + (input.size() - start) > MAX_LINE_LENGTH)
+		{
+			partialLine.clear();
+			return false;
+		}
+		partialLine.append(input.substr(start));
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives a line of input (without its newline) and a
+ * 		string to which output is appended. Answers the pending prompt with the line, or, if
+ * 		the line was typed ahead, answers one prompt with each of its words until one is
+ * 		rejected (discarding the rest). The screens of the prompts answered by the words
+ * 		before the last are dropped from the output, as the terminal game never displays
+ * 		them either. Returns nothing.
+ ***************************************************************************************************/
+
+void Session::handle_line(std::string_view line, std::string& reply)
+{
+	// Accept lines ending in a carriage return (as sent by telnet)
+	if (!line.empty() && line.back() == '\r')
+	{
+		line.remove_suffix(1);
+	}
+
+	if (!InputReader::is_typed_ahead(line))
+	{
+		handle_answer(line, reply);
+		return;
+	}
+
+	size_t replyStart = reply.size();
+	std::string_view answer;
+	while (!finished() && InputReader::next_answer(line, answer) && handle_answer(answer, reply))
+	{
+		size_t lastScreen = reply.rfind(CLEAR_SCREEN);
+		if (lastScreen != std::string::npos && lastScreen > replyStart)
+		{
+			reply.erase(replyStart, lastScreen - replyStart);
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that receives an answer and a string to which output is
+ * 		appended. Validates the answer against the pending prompt. A valid answer resumes the
+ * 		session, which runs until the next prompt. An invalid one is answered with the
+ * 		message the terminal game displays, and the prompt stays pending. Returns true if
+ * 		the answer was valid, or false if it was not (or no prompt is pending).
+ ***************************************************************************************************/
+
+bool Session::handle_answer(std::string_view answer, std::string& reply)
+{
+	if (io.get_pending() == PendingInput::ENTER)
+	{
+		if (!answer.empty())
+		{
+			reply += "Please do not enter any input before pressing enter. Press enter to continue.";
+			return false;
+		}
+		io.give_answer(0);
+	}
+	else if (io.get_pending() == PendingInput::MENU_CHOICE)
+	{
+		// Check the answer the same way enterValidInt does
+		int value = 0;
+		IntStatus status = InputReader::parse_int(answer, value);
+		if (status != IntStatus::VALID)
+		{
+			reply += (status == IntStatus::NOT_INTEGER) ? NOT_INTEGER_MESSAGE : OUT_OF_RANGE_MESSAGE;
+			return false;
+		}
+
+		// Check the range the same way the menu utility function does
+		int choices = io.get_pending_choices();
+		if (value < 1 || value > choices)
+		{
+			reply += "\nPlease enter a number between 1 and " + std::to_string(choices) + ".\nYour choice: ";
+			return false;
+		}
+		io.give_answer(value);
+	}
+	else
+	{
+		return false;
+	}
+
+	answersGiven++;
+	io.take_output(reply);
+
+	// Throw any exception the sequence finished with
+	if (sequence.done())
+	{
+		sequence.get();
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Private coroutine that plays the same sequence the main function of the terminal
+ * 		game goes through: the instructions, a game played until it is over, and the play
+ * 		again menu, repeated until the player chooses to exit. Receives nothing and returns a
+ * 		Task that finishes when the player exits.
+ ***************************************************************************************************/
+
+Task<void> Session::play()
+{
+	const std::string_view mainMenu[] = {"Play again", "Exit"};
+	int mainChoice = 1;
+	while (mainChoice == 1)
+	{
+		// Print each section of the instructions, pausing after each one
+		io.clear_screen();
+		for (std::string_view text : Content::get().sections(Asset::GAME_INSTRUCTIONS))
+		{
+			io.out() << text;
+			co_await io.pause();
+		}
+
+		std::shared_ptr<const GameMap> map = GameMap::rome();
+		game.reset(new Game(io, Random::random_seed(), map));
+		game->set_hints(hints);
+		if (!replayFileName.empty())
+		{
+			replayLog.start(game->get_seed(), hints != nullptr, *map);
+			io.set_replay_log(&replayLog);
+			recording = true;
+		}
+		while (!game->game_over())
+		{
+			co_await game->play_turn();
+		}
+
+		// Append the record of the game to the log file
+		if (recording)
+		{
+			replayLog.finish(game->snapshot());
+			append_record();
+		}
+
+		io.out() << "Main Menu: " << std::endl;
+		mainChoice = co_await io.choose(Prompt::PLAY_AGAIN, mainMenu);
+		game.reset();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Private member function that stops recording the game and appends its record (a
+ * 		short write that never blocks for long) to the log file. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void Session::append_record()
+{
+	io.set_replay_log(nullptr);
+	replayLog.append_to(replayFileName.c_str());
+	recording = false;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing. finished() returns whether or not the player
+ * 		has chosen to exit, and get_answers_given() returns the number of valid answers the
+ * 		player has given.
+ ***************************************************************************************************/
+
+bool Session::finished() const
+{
+	return this->sequence.done();
+}
+
+long Session::get_answers_given() const
+{
+	return this->answersGiven;
+}
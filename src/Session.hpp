@@ -0,0 +1,90 @@
+/***************************************************************************************************
+ * Program Name: Session.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Session class that holds one player's games on the game server. A Session plays
+ * 		the same sequence as the main function of the terminal game: the instructions, a
+ * 		game played one turn at a time, and the play again menu. The player's input arrives
+ * 		in pieces as it is read from the socket, and the output to send back is returned
+ * 		from each call.
+ *
+ * 		The sequence is a single coroutine (see Task.hpp) that is suspended each time the
+ * 		game asks for input (see SessionIO.hpp) and resumed, right where it left off, when
+ * 		the player's answer arrives. A Session waiting for input therefore holds no thread,
+ * 		only its Game and the suspended coroutine frames of the prompt in progress.
+ *
+ * 		Input is split into lines and each line is validated against the pending prompt with
+ * 		the same messages the enterValidInt, menu, and pressEnter utility functions display
+ * 		at the terminal, so invalid input never reaches the game. A line typed ahead (such
+ * 		as "1 4 2 enter 3", see InputReader.hpp) answers one prompt per word, and only the
+ * 		screen of the last prompt is sent back, so a client can play a whole game with a
+ * 		handful of writes.
+ *
+ *		Private data members of the Session class include:
+ *		- The SessionIO through which the game is played
+ *		- The current Game (created once the instructions have been read)
+ *		- The Task running the sequence
+ *		- Any input received after the last complete line (which is limited in length, so
+ *		  that a client that never ends a line cannot make the server hold unlimited input)
+ *		- The number of answers the player has given
+ *		- The table of hints offered in every game (if any)
+ *		- The name of the log file to which every game is appended (if any), the ReplayLog
+ *		  of the game being played, and whether a game is being recorded (so that a game
+ *		  the player leaves before it is over is still appended, as unfinished, when the
+ *		  session is destroyed)
+ *
+ *		Public member functions of the Session class include:
+ *		- A constructor (which receives the table of hints and the name of the log file, if
+ *		  any) and destructor
+ *		- A function that starts the session and returns its first screen
+ *		- A function that receives input and returns the output to send back (or reports
+ *		  that a line was too long to be an answer)
+ *		- Accessors for whether the player has finished and how many answers they gave
+ *
+ *		Private member functions include the coroutine that plays the sequence,
+ *		functions that split a line of input into answers and validate each answer
+ *		against the pending prompt, and a function that appends the record of a game to
+ *		the log file.
+ **************************************************************************************************/
+#ifndef SESSION_HPP
+#define SESSION_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include "Game.hpp"
+#include "InputReader.hpp"
+#include "ReplayLog.hpp"
+#include "SessionIO.hpp"
+#include "Task.hpp"
+
+class Session
+{
+	private:
+		// Private data members
+		SessionIO io;
+		std::unique_ptr<Game> game;
+		Task<void> sequence;
+		std::string partialLine;
+		long answersGiven;
+		std::shared_ptr<const HintTable> hints;
+		std::string replayFileName;
+		ReplayLog replayLog;
+		bool recording;
+
+		// Private member functions
+		Task<void> play();
+		void append_record();
+		void handle_line(std::string_view line, std::string& reply);
+		bool handle_answer(std::string_view answer, std::string& reply);
+
+	public:
+		// Public member functions
+		Session(std::shared_ptr<const HintTable> hints = nullptr, const std::string& replayFileName = "");
+		~Session();
+		void start(std::string& reply);
+		bool receive(std::string_view input, std::string& reply);
+		bool finished() const;
+		long get_answers_given() const;
+};
+#endif
@@ -0,0 +1,197 @@
+/***************************************************************************************************
+ * Program Name: SessionIO.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: SessionIO class that is a child of the abstract GameIO class. Runs the game for a
+ * 		player connected to the game server, suspending the coroutine that asks for input
+ * 		until the player's answer arrives and then resuming it. See SessionIO.hpp.
+ **************************************************************************************************/
+#include "SessionIO.hpp"
+#include <stdexcept>
+
+// Line of stars displayed above and below each menu (as the menu utility function does)
+const char MENU_BORDER[] = "**************************************************************************\n";
+
+
+/***************************************************************************************************
+ * Description: Constructor that creates a SessionIO with no output and no pending prompt.
+ ***************************************************************************************************/
+
+SessionIO::SessionIO()
+{
+	waiting = nullptr;
+	answer = 0;
+	pending = PendingInput::NONE;
+	pendingChoices = 0;
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual destructor for SessionIO class. The suspended coroutine (if any) is owned
+ * 		by the Task that started it, so it is not destroyed here.
+ ***************************************************************************************************/
+
+SessionIO::~SessionIO()
+{
+	waiting = nullptr;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the stream through which the game writes its text.
+ ***************************************************************************************************/
+
+std::ostream& SessionIO::out()
+{
+	return output;
+}
+
+
+/***************************************************************************************************
+ * Description: The blocking menu and press_enter functions would block a server thread until the
+ * 		player answers, so they are not supported: each throws std::logic_error. The game
+ * 		engine uses co_await io.choose(...) and co_await io.pause() instead.
+ ***************************************************************************************************/
+
+int SessionIO::menu([[maybe_unused]] Prompt prompt, [[maybe_unused]] MenuChoices menuChoices)
+{
+	throw std::logic_error("SessionIO::menu would block; use co_await choose()");
+}
+
+void SessionIO::press_enter()
+{
+	throw std::logic_error("SessionIO::press_enter would block; use co_await pause()");
+}
+
+
+/***************************************************************************************************
+ * Description: Starts a new screen by writing the ANSI escape sequence that moves the cursor to the
+ * 		top left corner and clears the screen. Receives and returns nothing.
+ ***************************************************************************************************/
+
+void SessionIO::clear_screen()
+{
+	output << CLEAR_SCREEN;
+}
+
+
+/***************************************************************************************************
+ * Description: Structured events are ignored since the player reads the game text instead.
+ * 		Receives the type and value of the event and returns nothing.
+ ***************************************************************************************************/
+
+void SessionIO::event([[maybe_unused]] EventType type, [[maybe_unused]] int value)
+{
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt (unused), the menu choices, and the int in which a choice known
+ * 		right away would be stored (unused). Writes the menu the same way the menu utility
+ * 		function does and remembers that a menu choice is pending. Returns false, since the
+ * 		awaiting coroutine must always wait for the player's answer.
+ ***************************************************************************************************/
+
+bool SessionIO::begin_menu([[maybe_unused]] Prompt prompt, MenuChoices menuChoices, [[maybe_unused]] int& choice)
+{
+	output << "\n" << MENU_BORDER;
+	for (size_t index = 0; index < menuChoices.size(); index++)
+	{
+		output << (index + 1) << ". " << menuChoices[index] << "\n";
+	}
+	output << MENU_BORDER << "\nYour choice: ";
+
+	pending = PendingInput::MENU_CHOICE;
+	pendingChoices = static_cast<int>(menuChoices.size());
+	return false;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing. Writes the pause message the same way the pressEnter utility
+ * 		function does and remembers that a press of enter is pending. Returns false, since
+ * 		the awaiting coroutine must always wait for the player.
+ ***************************************************************************************************/
+
+bool SessionIO::begin_pause()
+{
+	output << "\nPress enter to continue.";
+
+	pending = PendingInput::ENTER;
+	pendingChoices = 0;
+	return false;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the coroutine awaiting the pending prompt and keeps it until the player
+ * 		answers. Returns nothing.
+ ***************************************************************************************************/
+
+void SessionIO::suspend(std::coroutine_handle<> waiting)
+{
+	this->waiting = waiting;
+}
+
+
+/***************************************************************************************************
+ * Description: Called by the resumed coroutine. Ends the line of the prompt (as the terminal does
+ * 		once the player presses enter) and returns the player's answer (the menu choice, or
+ * 		0 for a pause).
+ ***************************************************************************************************/
+
+int SessionIO::take_answer()
+{
+	output << "\n";
+	return answer;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a validated answer to the pending prompt (a menu choice number, or 0 for a
+ * 		press of enter). Resumes the coroutine waiting for it, which runs until the game
+ * 		asks for the next answer (or the Task it belongs to finishes). Returns nothing.
+ ***************************************************************************************************/
+
+void SessionIO::give_answer(int answer)
+{
+	this->answer = answer;
+	pending = PendingInput::NONE;
+
+	std::coroutine_handle<> resumed = waiting;
+	waiting = nullptr;
+	if (resumed)
+	{
+		resumed.resume();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a string to which output is appended. Appends all output written since
+ * 		the last call and empties the stream. Returns nothing.
+ ***************************************************************************************************/
+
+void SessionIO::take_output(std::string& destination)
+{
+	destination += output.str();
+	output.str("");
+	output.clear();
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor methods that receive nothing. get_pending() returns the kind of input the
+ * 		pending prompt expects, and get_pending_choices() returns the number of choices of the
+ * 		pending menu.
+ ***************************************************************************************************/
+
+PendingInput SessionIO::get_pending() const
+{
+	return this->pending;
+}
+
+int SessionIO::get_pending_choices() const
+{
+	return this->pendingChoices;
+}
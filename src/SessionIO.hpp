@@ -0,0 +1,75 @@
+/***************************************************************************************************
+ * Program Name: SessionIO.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: SessionIO class that is a child of the abstract GameIO class. Used by the game
+ * 		server (see Session.hpp and GameServer.hpp) to run the game for a player connected
+ * 		over a socket without dedicating a thread to them while the game waits for input.
+ *
+ * 		The game engine asks for input with co_await (see GameIO.hpp and Task.hpp). When it
+ * 		does, SessionIO writes the menu or pause message and suspends the awaiting coroutine,
+ * 		keeping its handle: the pending prompt is nothing more than the suspended coroutine
+ * 		frames of the turn in progress, and no thread is blocked. Once the player's answer
+ * 		arrives (validated by the Session), answer() resumes the coroutine right where it
+ * 		left off, on whichever thread received the answer.
+ *
+ * 		Menus and pauses are written exactly as the menu and pressEnter utility functions
+ * 		write them at the terminal. The blocking menu and press_enter functions cannot be
+ * 		used with a SessionIO, since nothing may block a server thread.
+ *
+ * 		An enum class identifying the kind of input a pending prompt expects is also
+ * 		declared in this header file.
+ *
+ *		Private data members of the SessionIO class include:
+ *		- A string holding the output not yet taken to be sent
+ *		- A string stream through which the game writes its text
+ *		- The suspended coroutine waiting for the player's answer and the answer itself
+ *		- The kind of input the pending prompt expects and its number of menu choices
+ *
+ *		Public member functions of the SessionIO class include:
+ *		- A constructor and destructor
+ *		- The implementations of the pure virtual functions of the GameIO class
+ *		- The implementations of the virtual functions that begin a prompt, suspend the
+ *		  awaiting coroutine, and take the answer
+ *		- A function that receives a validated answer and resumes the waiting coroutine
+ *		- A function that takes the output to send, and accessors for the pending prompt
+ **************************************************************************************************/
+#ifndef SESSIONIO_HPP
+#define SESSIONIO_HPP
+
+#include <sstream>
+#include "GameIO.hpp"
+
+// Escape sequences that start a new screen (moving the cursor home and clearing the terminal)
+const char CLEAR_SCREEN[] = "\x1b[H\x1b[2J";
+
+// Enum class identifying the kind of input a pending prompt expects
+enum class PendingInput{NONE, MENU_CHOICE, ENTER};
+
+class SessionIO : public GameIO
+{
+	private:
+		std::ostringstream output;
+		std::coroutine_handle<> waiting;
+		int answer;
+		PendingInput pending;
+		int pendingChoices;
+
+	public:
+		SessionIO();
+		virtual ~SessionIO();
+		virtual std::ostream& out() override;
+		virtual int menu(Prompt prompt, MenuChoices menuChoices) override;
+		virtual void press_enter() override;
+		virtual void clear_screen() override;
+		virtual void event(EventType type, int value = 0) override;
+		virtual bool begin_menu(Prompt prompt, MenuChoices menuChoices, int& choice) override;
+		virtual bool begin_pause() override;
+		virtual void suspend(std::coroutine_handle<> waiting) override;
+		virtual int take_answer() override;
+		void give_answer(int answer);
+		void take_output(std::string& destination);
+		PendingInput get_pending() const;
+		int get_pending_choices() const;
+};
+#endif
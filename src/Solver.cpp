@@ -0,0 +1,259 @@
+/***************************************************************************************************
+ * Program Name: Solver.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Solver class that finds the fewest steps in which a game can still be won and the
+ * 		turns that win it, with a breadth-first search over packed ModelStates. See
+ * 		Solver.hpp.
+ **************************************************************************************************/
+#include "Solver.hpp"
+
+// Index stored for the parent of the first state and in the empty slots of the hash table
+const std::uint32_t NO_NODE = 0xFFFFFFFF;
+
+// Struct holding one state reached by the search: the packed state, the state it was reached
+// from, and the turn taken there to reach it (what was done and the direction moved)
+struct SearchNode
+{
+	std::uint64_t key;
+	std::uint32_t parent;
+	TurnAction action;
+	Satchel items;
+	Direction dir;
+};
+
+
+/***************************************************************************************************
+ * Description: Helper class holding the states reached by the search: an open-addressing hash
+ * 		table (with linear probing) of packed states and the index of each one's node,
+ * 		doubled in size whenever it becomes half full.
+ ***************************************************************************************************/
+
+class VisitedTable
+{
+	private:
+		struct Slot
+		{
+			std::uint64_t key;
+			std::uint32_t node;
+		};
+		std::vector<Slot> slots;
+		std::size_t count = 0;
+
+		// Place a state in the first free slot at or after its hashed slot
+		void place(std::uint64_t key, std::uint32_t node)
+		{
+			std::size_t mask = slots.size() - 1;
+			std::size_t index = hash_model_key(key) & mask;
+			while (slots[index].node != NO_NODE)
+			{
+				index = (index + 1) & mask;
+			}
+			slots[index] = {key, node};
+		}
+
+	public:
+		VisitedTable() : slots(4096, Slot{0, NO_NODE})
+		{
+		}
+
+		// Add a state reached for the first time with the index of its node. Returns
+		// false (and adds nothing) if the state has already been reached.
+		bool insert(std::uint64_t key, std::uint32_t node)
+		{
+			std::size_t mask = slots.size() - 1;
+			for (std::size_t index = hash_model_key(key) & mask; slots[index].node != NO_NODE; index = (index + 1) & mask)
+			{
+				if (slots[index].key == key)
+				{
+					return false;
+				}
+			}
+
+			if (2 * (count + 1) > slots.size())
+			{
+				std::vector<Slot> oldSlots(slots.size() * 2, Slot{0, NO_NODE});
+				oldSlots.swap(slots);
+				for (const Slot& slot : oldSlots)
+				{
+					if (slot.node != NO_NODE)
+					{
+						place(slot.key, slot.node);
+					}
+				}
+			}
+			place(key, node);
+			count++;
+			return true;
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the map on which the games to be solved are played.
+ ***************************************************************************************************/
+
+Solver::Solver(std::shared_ptr<const GameMap> map)
+{
+	this->map = std::move(map);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn and the most steps the player
+ * 		may take. Searches breadth first, one step at a time, through every state the player
+ * 		can reach until one is found in which entering the space wins the game. Returns the
+ * 		Solution: whether the game can be won in at most that many steps, the fewest steps
+ * 		needed, the turns that win it (the first being the turn about to be taken), and the
+ * 		number of states reached.
+ ***************************************************************************************************/
+
+Solution Solver::solve(const GameState& state, int maxSteps) const
+{
+	Solution solution;
+	if (state.withNero)
+	{
+		solution.winnable = true;
+		return solution;
+	}
+	if (state.gameOver || !state.stillAlive)
+	{
+		return solution;
+	}
+
+	// Keep only what matters to winning
+	GameModel model(map, state.expensiveChoice, state.cheapChoice);
+	ModelState start = model.model_state(state);
+
+	// The nodes are kept in the order in which they are reached, which is also the
+	// order in which the search visits them (so they double as its queue)
+	std::vector<SearchNode> nodes;
+	VisitedTable visited;
+	nodes.push_back({model.pack(start), NO_NODE, TurnAction::KEEP_MOVING, Satchel(), Direction::N});
+	visited.insert(nodes[0].key, 0);
+	std::uint32_t winningNode = model.wins_on_entering(start) ? 0 : NO_NODE;
+
+	// The nodes before levelEnd have been reached in "steps" steps
+	std::size_t levelEnd = 1;
+	int steps = 0;
+	ModelOption options[MAX_OPTIONS];
+	for (std::size_t index = 0; index < nodes.size() && winningNode == NO_NODE; index++)
+	{
+		if (index == levelEnd)
+		{
+			steps++;
+			levelEnd = nodes.size();
+		}
+		if (steps >= maxSteps)
+		{
+			break;
+		}
+
+		// Try each option with its most favourable outcome, followed by each move
+		ModelState current = model.unpack(nodes[index].key);
+		int numOptions = model.list_options(current, options);
+		std::uint8_t validMask = map->get_valid_mask(current.location);
+		for (int optionNum = 0; optionNum < numOptions && winningNode == NO_NODE; optionNum++)
+		{
+			for (int dirNum = 0; dirNum < NUM_DIRECTIONS && winningNode == NO_NODE; dirNum++)
+			{
+				if (!(validMask & (1 << dirNum)))
+				{
+					continue;
+				}
+
+				ModelState next = model.move(options[optionNum].outcomes[0].after, static_cast<Direction>(dirNum));
+				std::uint64_t key = model.pack(next);
+				std::uint32_t nodeNum = static_cast<std::uint32_t>(nodes.size());
+				if (visited.insert(key, nodeNum))
+				{
+					nodes.push_back({key, static_cast<std::uint32_t>(index), options[optionNum].action,
+							 options[optionNum].items, static_cast<Direction>(dirNum)});
+					if (model.wins_on_entering(next))
+					{
+						winningNode = nodeNum;
+					}
+				}
+			}
+		}
+	}
+	solution.statesVisited = nodes.size();
+	if (winningNode == NO_NODE)
+	{
+		return solution;
+	}
+
+	// Follow the nodes back to the start to list the turns, the last of which is
+	// entering the Domus Aurea
+	solution.winnable = true;
+	solution.turns.push_back({model.unpack(nodes[winningNode].key).location, TurnAction::ENTER, Satchel(), Direction::N});
+	for (std::uint32_t nodeNum = winningNode; nodes[nodeNum].parent != NO_NODE; nodeNum = nodes[nodeNum].parent)
+	{
+		const SearchNode& node = nodes[nodeNum];
+		solution.turns.push_back({model.unpack(nodes[node.parent].key).location, node.action, node.items, node.dir});
+	}
+	solution.turns = std::vector<SolverTurn>(solution.turns.rbegin(), solution.turns.rend());
+	solution.steps = static_cast<int>(solution.turns.size()) - 1;
+	return solution;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the state of a game at the start of a turn. Returns the Solution within
+ * 		the steps the player has left before reaching MAX_STEPS (see above).
+ ***************************************************************************************************/
+
+Solution Solver::solve(const GameState& state) const
+{
+	return solve(state, MAX_STEPS - state.stepsTaken);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a turn of a solution and returns a description of it in words, such as
+ * 		"Enter the Forum and buy Olive Oil and Grain, then move South" (for use as a hint).
+ ***************************************************************************************************/
+
+std::string Solver::describe_turn(const SolverTurn& turn) const
+{
+	SpaceType type = map->get_type(turn.location);
+	std::string description;
+	if (turn.action == TurnAction::KEEP_MOVING)
+	{
+		description = "Keep moving";
+	}
+	else
+	{
+		description = std::string("Enter the ") + SPACE_TYPE_NAMES[static_cast<int>(type)];
+	}
+
+	// List the items bought or donated
+	if (turn.action == TurnAction::BUY || turn.action == TurnAction::DONATE)
+	{
+		description += (turn.action == TurnAction::BUY) ? " and buy " : " and donate ";
+		int itemsListed = 0;
+		for (ItemId item = 0; item < NUM_ITEMS; item++)
+		{
+			if (turn.items.contains(item))
+			{
+				description += (itemsListed > 0 ? " and " : "") + item_name(item);
+				itemsListed++;
+			}
+		}
+	}
+	else if (turn.action == TurnAction::BATHE)
+	{
+		description += " and bathe";
+	}
+
+	// Entering the Domus Aurea in a solution is always the winning turn
+	if (turn.action == TurnAction::ENTER && type == SpaceType::DOMUS_AUREA)
+	{
+		description += " to be received by Nero";
+	}
+	else
+	{
+		description += std::string(", then move ") + DIRECTION_NAMES[static_cast<int>(turn.dir)];
+	}
+	return description;
+}
@@ -0,0 +1,77 @@
+/***************************************************************************************************
+ * Program Name: Solver.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Solver class that finds the fewest steps in which a game can still be won (by
+ * 		being received by Nero at the Domus Aurea) from any point in the game, and the turns
+ * 		that win it in that many steps. It is used as a hint engine (the first turn of the
+ * 		solution is the best thing to do next) and as a check that the game can still be
+ * 		won within MAX_STEPS after the prices, prizes, and other rules are changed.
+ *
+ * 		The solver plays by the rules described by the GameModel (see GameModel.hpp), and
+ * 		assumes that every random outcome goes the player's way: the player wins every
+ * 		trivia game, battle, and chariot race. The solution is therefore the fastest the game
+ * 		can be won, which can only be matched with luck.
+ *
+ * 		Steps are only taken when moving, so every turn costs one step, and the solver does
+ * 		a breadth-first search over the states at the start of each turn. Each ModelState is
+ * 		packed into a single 64-bit number, and the states already reached are kept in an
+ * 		open-addressing hash table of these numbers.
+ *
+ *		Private data members of the Solver class include:
+ *		- The map on which the games being solved are played
+ *
+ *		Public member functions of the Solver class include:
+ *		- A constructor that receives the map
+ *		- Functions that solve a game from a given state (within a given number of steps,
+ *		  or within the steps left before MAX_STEPS)
+ *		- A function that describes a turn of a solution in words (for use as a hint)
+ *
+ *		The SolverTurn struct (one turn of a solution) and the Solution struct are also
+ *		declared in this header file.
+ **************************************************************************************************/
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+#include "GameModel.hpp"
+
+// Struct describing one turn of a solution: what the player does at the space at
+// "location", the items bought or donated (for BUY and DONATE), and the direction in
+// which they then move (not used on the last turn, on which they are received by Nero)
+struct SolverTurn
+{
+	std::uint32_t location;
+	TurnAction action;
+	Satchel items;
+	Direction dir;
+};
+
+// Struct describing the result of solving a game
+struct Solution
+{
+	bool winnable = false;			// whether the game can be won within the steps allowed
+	int steps = 0;				// the fewest steps in which it can be won
+	std::vector<SolverTurn> turns;		// the turns that win it (steps + 1 turns)
+	std::size_t statesVisited = 0;		// number of distinct states reached by the search
+};
+
+class Solver
+{
+	private:
+		// Private data member
+		std::shared_ptr<const GameMap> map;
+
+	public:
+		// Public member functions
+		Solver(std::shared_ptr<const GameMap> map);
+		Solution solve(const GameState& state, int maxSteps) const;
+		Solution solve(const GameState& state) const;
+		std::string describe_turn(const SolverTurn& turn) const;
+};
+#endif
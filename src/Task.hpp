@@ -0,0 +1,228 @@
+/***************************************************************************************************
+ * Program Name: Task.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: Task class template, the return type of every coroutine in the game engine (each
+ * 		Space's interact function, the functions it calls that ask the player for input,
+ * 		Board::move, and Game::play_turn). A coroutine written with co_await reads like the
+ * 		straight-line code it replaces, but can be suspended while it waits for the player's
+ * 		next answer and resumed later, on any thread, without a thread being blocked in the
+ * 		meantime (see SessionIO.hpp and Session.hpp).
+ *
+ * 		A Task does not start running when it is created. It starts either when another
+ * 		coroutine co_awaits it (and then resumes that coroutine when it finishes, directly,
+ * 		without going through a scheduler) or when start() is called on it (for the
+ * 		outermost Task of a call chain). When a frontend answers every prompt immediately
+ * 		(as TerminalIO and HeadlessIO do), nothing is ever suspended, and start() returns
+ * 		with the Task done.
+ *
+ * 		An exception thrown inside a Task is stored and thrown again from the co_await
+ * 		expression (or from get()) that receives its result.
+ *
+ * 		The following are declared in this header file:
+ * 		- TaskPromiseBase (the part of a Task's promise shared by every result type: the
+ * 		  coroutine to resume when the Task finishes and any exception it threw)
+ * 		- TaskPromise (the promise of a Task returning a value, and a specialization for
+ * 		  a Task returning nothing)
+ * 		- Task (owns the coroutine, can be co_awaited, started, and checked for completion)
+ **************************************************************************************************/
+#ifndef TASK_HPP
+#define TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+template <typename T>
+class Task;
+
+class TaskPromiseBase
+{
+	public:
+		std::coroutine_handle<> continuation;
+		std::exception_ptr exception;
+
+		// Awaiter used when the coroutine finishes: resumes the coroutine that awaited it
+		// (if any), which keeps the stack from growing however deeply Tasks are nested
+		struct FinalAwaiter
+		{
+			bool await_ready() noexcept
+			{
+				return false;
+			}
+
+			template <typename Promise>
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> finished) noexcept
+			{
+				std::coroutine_handle<> continuation = finished.promise().continuation;
+				return continuation ? continuation : std::noop_coroutine();
+			}
+
+			void await_resume() noexcept
+			{
+			}
+		};
+
+		std::suspend_always initial_suspend() noexcept
+		{
+			return std::suspend_always();
+		}
+
+		FinalAwaiter final_suspend() noexcept
+		{
+			return FinalAwaiter();
+		}
+
+		void unhandled_exception() noexcept
+		{
+			exception = std::current_exception();
+		}
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+	public:
+		T value;
+
+		Task<T> get_return_object() noexcept;
+
+		void return_value(T result)
+		{
+			value = std::move(result);
+		}
+
+		T result()
+		{
+			if (exception)
+			{
+				std::rethrow_exception(exception);
+			}
+			return std::move(value);
+		}
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+	public:
+		Task<void> get_return_object() noexcept;
+
+		void return_void() noexcept
+		{
+		}
+
+		void result()
+		{
+			if (exception)
+			{
+				std::rethrow_exception(exception);
+			}
+		}
+};
+
+template <typename T>
+class Task
+{
+	public:
+		typedef TaskPromise<T> promise_type;
+
+	private:
+		std::coroutine_handle<promise_type> handle;
+
+	public:
+		Task() noexcept : handle(nullptr)
+		{
+		}
+
+		explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle(handle)
+		{
+		}
+
+		Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr))
+		{
+		}
+
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (handle)
+				{
+					handle.destroy();
+				}
+				handle = std::exchange(other.handle, nullptr);
+			}
+			return *this;
+		}
+
+		~Task()
+		{
+			if (handle)
+			{
+				handle.destroy();
+			}
+		}
+
+		// A Task owns its coroutine, so it can never be copied
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		// Starts the outermost Task of a call chain. Returns when the Task finishes or
+		// is first suspended.
+		void start()
+		{
+			handle.resume();
+		}
+
+		bool done() const noexcept
+		{
+			return !handle || handle.done();
+		}
+
+		// Returns the result of a finished Task (or throws the exception it threw)
+		T get()
+		{
+			return handle.promise().result();
+		}
+
+		// Awaiter used when a coroutine co_awaits this Task: starts it, and resumes the
+		// awaiting coroutine when it finishes
+		struct Awaiter
+		{
+			std::coroutine_handle<promise_type> handle;
+
+			bool await_ready() noexcept
+			{
+				return false;
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+			{
+				handle.promise().continuation = awaiting;
+				return handle;
+			}
+
+			T await_resume()
+			{
+				return handle.promise().result();
+			}
+		};
+
+		Awaiter operator co_await() && noexcept
+		{
+			return Awaiter{handle};
+		}
+};
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+	return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+	return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+#endif
@@ -0,0 +1,196 @@
+/***************************************************************************************************
+ * Program Name: TerminalIO.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: TerminalIO class that is a child of the abstract GameIO class. Implements
+ * 		the interactive frontend of the game: text is written to the terminal,
+ * 		menus are displayed and validated with the menu utility function,
+ * 		pauses wait for the user to press enter, and the screen is cleared
+ * 		between screens. Structured events are ignored since a person at the
+ * 		terminal reads the game text instead.
+ *
+ * 		All text is written through a Renderer: while a TerminalIO object exists,
+ * 		std::cout writes into the Renderer and the InputReader from which user input
+ * 		is read (standard input, unless another is given) is tied to the Renderer's
+ * 		present stream, so each screen is displayed with a single write right before
+ * 		the game waits for input, and new screens are drawn with ANSI escape sequences
+ * 		instead of running the "clear" command. In non-interactive mode, pauses return at
+ * 		once, the screen is never cleared, and the game's text is discarded, with structured
+ * 		events and menus written as compact codes instead (see TerminalIO.hpp).
+ *
+ *		Private data members include the following:
+ *		- The Renderer that composes and displays each screen
+ *		- The stream buffer std::cout used before the TerminalIO object was created
+ *		- The InputReader from which user input is read
+ *		- The stream the InputReader was tied to before the TerminalIO object was created
+ *		- A bool indicating whether or not non-interactive mode is enabled, and the stream
+ *		  that discards the game's text in that mode
+ *
+ *		Member functions of this class include:
+ *		- A constructor and destructor
+ *		- The implementations of the pure virtual functions of the GameIO class
+ *		- A function that enables or disables non-interactive mode
+ *		- An accessor for the counts of the Renderer's output
+ **************************************************************************************************/
+#include "TerminalIO.hpp"
+
+// Letter identifying each type of structured event in non-interactive mode, in the order of the
+// EventType enum class (turn started, space entered, moved, money changed, satchel changed,
+// bathed, trivia finished, battle finished, race finished, died, won, out of steps)
+const char EVENT_CODES[] = "TSM$IBQGRDWO";
+
+// Letter identifying each prompt in non-interactive mode, in the order of the Prompt enum class
+// (enter space, move, play again, trivia challenge, trivia answer, bet amount, bet team,
+// purchase, donation, bathe, gladiator move, loyalty question)
+const char PROMPT_CODES[] = "EMPCABTUDHGL";
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives a bool indicating whether or not only the changed lines
+ * 		of each screen should be repainted (diff mode is only used when standard output is a
+ * 		terminal) and the InputReader from which to read user input. Registers the text of
+ * 		the shared Content (which is never changed or freed) as static text of the Renderer,
+ * 		points std::cout at the Renderer, and ties the InputReader to the Renderer's present
+ * 		stream so that pending text is displayed right before each read of input.
+ ***************************************************************************************************/
+
+TerminalIO::TerminalIO(bool diffRender, InputReader& input) : renderer(STDOUT_FILENO, diffRender && isatty(STDOUT_FILENO)), input(input),
+	nullStream(nullptr)
+{
+	const Content& content = Content::get();
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		renderer.add_static_text(content.asset_text(static_cast<Asset>(index)));
+		for (std::string_view section : content.sections(static_cast<Asset>(index)))
+		{
+			renderer.add_static_text(section);
+		}
+	}
+
+	nonInteractive = false;
+	previousCoutBuf = std::cout.rdbuf(&renderer);
+	previousInputTie = input.tie(&renderer.present_stream());
+}
+
+
+/***************************************************************************************************
+ * Description: Virtual destructor for TerminalIO class. Displays any remaining text and restores
+ * 		std::cout and the InputReader to the way they were before the TerminalIO object was created.
+ ***************************************************************************************************/
+
+TerminalIO::~TerminalIO()
+{
+	renderer.present();
+	std::cout.rdbuf(previousCoutBuf);
+	input.tie(previousInputTie);
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the standard output stream, to which all game
+ * 		text is written (the stream writes into the Renderer), or a stream that discards the
+ * 		text in non-interactive mode.
+ ***************************************************************************************************/
+
+std::ostream& TerminalIO::out()
+{
+	if (nonInteractive)
+	{
+		return nullStream;
+	}
+	return std::cout;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the prompt identifying the decision point (unused, since the menu
+ * 		text itself tells the user what is being asked) and a view of the menu choices.
+ * 		Uses the menu utility function to display the choices and return
+ * 		the user's validated choice (between 1 and the number of choices). In
+ * 		non-interactive mode, writes the menu's code instead of the menu and validates the
+ * 		choice the same way.
+ ***************************************************************************************************/
+
+int TerminalIO::menu(Prompt prompt, MenuChoices menuChoices)
+{
+	if (!nonInteractive)
+	{
+		return ::menu(menuChoices, input);
+	}
+
+	std::cout << '?' << PROMPT_CODES[static_cast<int>(prompt)] << menuChoices.size() << '\n';
+	int choice = enterValidInt(input);
+	while (choice < 1 || choice > static_cast<int>(menuChoices.size()))
+	{
+		input.discard_queued();
+		std::cout << "Please enter a number between 1 and " << menuChoices.size() << ".\n";
+		choice = enterValidInt(input);
+	}
+	return choice;
+}
+
+
+/***************************************************************************************************
+ * Description: Uses the pressEnter utility function to wait until the user presses enter (or
+ * 		returns at once in non-interactive mode). Receives and returns nothing.
+ ***************************************************************************************************/
+
+void TerminalIO::press_enter()
+{
+	if (!nonInteractive)
+	{
+		pressEnter(input);
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Tells the Renderer to start a new screen, which is drawn at the top of the
+ * 		terminal the next time text is displayed (the output of non-interactive mode simply
+ * 		runs on instead). Receives and returns nothing.
+ ***************************************************************************************************/
+
+void TerminalIO::clear_screen()
+{
+	if (!nonInteractive)
+	{
+		renderer.clear_screen();
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a structured event. Ignores it, since the person playing at the terminal
+ * 		is informed of everything through the game text, except in non-interactive mode,
+ * 		where the event is written as a compact code on a line of its own. Returns nothing.
+ ***************************************************************************************************/
+
+void TerminalIO::event(EventType type, int value)
+{
+	if (nonInteractive)
+	{
+		std::cout << '@' << EVENT_CODES[static_cast<int>(type)] << value << '\n';
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a bool indicating whether or not non-interactive mode should be enabled
+ * 		(see TerminalIO.hpp). Returns nothing.
+ ***************************************************************************************************/
+
+void TerminalIO::set_non_interactive(bool nonInteractive)
+{
+	this->nonInteractive = nonInteractive;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor that returns the counts of the output written through the Renderer since
+ * 		the TerminalIO object was created (see RendererStats).
+ ***************************************************************************************************/
+
+const RendererStats& TerminalIO::get_stats() const
+{
+	return renderer.get_stats();
+}
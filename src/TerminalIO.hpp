@@ -0,0 +1,79 @@
+/***************************************************************************************************
+ * Program Name: TerminalIO.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: TerminalIO class that is a child of the abstract GameIO class. Implements
+ * 		the interactive frontend of the game: text is written to the terminal,
+ * 		menus are displayed and validated with the menu utility function,
+ * 		pauses wait for the user to press enter, and the screen is cleared
+ * 		between screens. Structured events are ignored since a person at the
+ * 		terminal reads the game text instead.
+ *
+ * 		All text is written through a Renderer: while a TerminalIO object exists,
+ * 		std::cout writes into the Renderer and the InputReader from which user input
+ * 		is read (standard input, unless another is given) is tied to the Renderer's
+ * 		present stream, so each screen is displayed with a single write right before
+ * 		the game waits for input, and new screens are drawn with ANSI escape sequences
+ * 		instead of running the "clear" command. The game's Content is registered with the
+ * 		Renderer as static text, so the board images, descriptions, and narration are
+ * 		written straight from where they are stored instead of being copied first.
+ *
+ * 		In non-interactive mode (used to play the game from scripts, for regression and
+ * 		load runs), pauses return at once, the screen is never cleared, and the game's text
+ * 		(the narration, descriptions, board, menus, and messages) is discarded. What
+ * 		happens is written as compact codes instead, each on a line of its own:
+ * 		- A structured event is "@", a letter identifying the event (see EVENT_CODES in
+ * 		  TerminalIO.cpp), and its value, such as "@M5" for a move to space 5
+ * 		- A menu is "?", a letter identifying the prompt (see PROMPT_CODES), and its number
+ * 		  of choices, such as "?M8" for the menu of directions in which to move
+ * 		Invalid answers are still answered with the usual messages. The game itself plays
+ * 		exactly the same, so a script of choices (without the presses of enter) plays the
+ * 		same game either way.
+ *
+ *		Private data members include the following:
+ *		- The Renderer that composes and displays each screen
+ *		- The stream buffer std::cout used before the TerminalIO object was created
+ *		- The InputReader from which user input is read
+ *		- The stream the InputReader was tied to before the TerminalIO object was created
+ *		- A bool indicating whether or not non-interactive mode is enabled, and the stream
+ *		  that discards the game's text in that mode
+ *
+ *		Member functions of this class include:
+ *		- A constructor and destructor
+ *		- The implementations of the pure virtual functions of the GameIO class
+ *		- A function that enables or disables non-interactive mode
+ *		- An accessor for the counts of the Renderer's output (write calls and bytes)
+ **************************************************************************************************/
+#ifndef TERMINALIO_HPP
+#define TERMINALIO_HPP
+
+#include <unistd.h>
+#include "Content.hpp"
+#include "GameIO.hpp"
+#include "InputReader.hpp"
+#include "Renderer.hpp"
+#include "menu.hpp"
+#include "pressEnter.hpp"
+
+class TerminalIO : public GameIO
+{
+	private:
+		Renderer renderer;
+		InputReader& input;
+		std::streambuf* previousCoutBuf;
+		std::ostream* previousInputTie;
+		bool nonInteractive;
+		std::ostream nullStream;
+
+	public:
+		TerminalIO(bool diffRender = false, InputReader& input = InputReader::standard_input());
+		virtual ~TerminalIO();
+		virtual std::ostream& out() override;
+		virtual int menu(Prompt prompt, MenuChoices menuChoices) override;
+		virtual void press_enter() override;
+		virtual void clear_screen() override;
+		virtual void event(EventType type, int value = 0) override;
+		void set_non_interactive(bool nonInteractive);
+		const RendererStats& get_stats() const;
+};
+#endif
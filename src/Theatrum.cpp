@@ -10,14 +10,12 @@
  * 		ending sequence.
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -31,15 +29,12 @@
  * Description: Default constructor for Theatrum object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  ***************************************************************************************************/
 
-Theatrum::Theatrum() : Space("Theatrum", 6, "Theatrum_Description.txt")
+Theatrum::Theatrum() : Space("Theatrum", 6, Asset::THEATRUM_DESCRIPTION)
 {
 }
 
@@ -59,38 +54,26 @@ Theatrum::~Theatrum()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		# - a set of strings indicating the items in the player's satchel #
- *		  - an int indicating how much money the player has 
- *		  - an int indicating how many steps the player has taken since bathing 
- *		  - a bool indicating whether or not the player has bathed 
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		  - a bool indicating whether or not the player is still alive
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- satchel: the items in the player's satchel
  *
  *		The Theatrum's implementation of this function does the following:
  *		- Allows user to donate items from their satchel to free up space.
  *		- Does not allow user to donate scroll or permit
  ***************************************************************************************************/
 
-void Theatrum::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> Theatrum::interact(GameIO& io, GameState& state, [[maybe_unused]] Random& rng)
 {
 	// If user's satchel is empty, inform them and do not generate donation menu
-	if (satchel.empty())
+	if (state.satchel.empty())
 	{
-		std::cout << "You do not have any items to donate at this time.\n";
+		io.out() << "You do not have any items to donate at this time.\n";
 	}
 
 	// Otherwise, loop until the user chooses to leave or has no items left in satchel
@@ -99,49 +82,53 @@ void Theatrum::interact(std::set<std::string>& satchel, int& money, int& stepsSi
 		bool wantsToExit = false;
 		do
 		{
-			// Create donation menu based on contents of user's satchel
+			// Create donation menu based on contents of user's satchel,
+			// remembering the ID of the item listed for each menu choice
 			std::vector<std::string> donationMenu;
-			std::set<std::string>::iterator satchelIter;
-			for (satchelIter = satchel.begin(); satchelIter != satchel.end(); satchelIter++)
+			std::vector<ItemId> donationItems;
+			for (ItemId item = 0; item < NUM_ITEMS; item++)
 			{
-				donationMenu.push_back(*satchelIter);
+				if (state.satchel.contains(item))
+				{
+					donationMenu.push_back(item_name(item));
+					donationItems.push_back(item);
+				}
 			}
 			donationMenu.push_back("Leave the Theatrum");
 			
-			std::cout << "What would you like to donate to the orphans today?\n";
+			io.out() << "What would you like to donate to the orphans today?\n";
 
 			// Get and process user's choice
-			int donationNumber = menu(donationMenu);
+			int donationNumber = co_await io.choose(Prompt::DONATION, donationMenu);
 			
 			// If the user chooses the last menu option, set wantsToExit to true
-			if (donationNumber == (donationMenu.size()))
+			if (donationNumber == static_cast<int>(donationMenu.size()))
 			{
 				wantsToExit = true;
 			}
 
 			// If the user has chosen to donate a key item, inform them that they cannot do so
-			else if (donationMenu[(donationNumber - 1)] == SCROLL || donationMenu[(donationNumber - 1)] == PERMIT)
+			else if (donationItems[(donationNumber - 1)] == SCROLL || donationItems[(donationNumber - 1)] == PERMIT)
 			{
-				std::cout << "I’m sorry, but we cannot accept that item for donations\n";
+				io.out() << "I’m sorry, but we cannot accept that item for donations\n";
 			}
 			
 			// Otherwise, remove the requested item from the user's satchel
 			else
 			{
-				std::string donationName = donationMenu[(donationNumber-1)];
-				satchel.erase(donationName);
-				std::cout << "Thank you very much! The orphans will greatly benefit from your donation.\n";
+				state.satchel.erase(donationItems[(donationNumber-1)]);
+				io.out() << "Thank you very much! The orphans will greatly benefit from your donation.\n";
 			}
 
 			// If the user's satchel is now empty after just making the donation,
 			// inform them of this before exiting the loop.
-			if (satchel.empty())
+			if (state.satchel.empty())
 			{
-				std::cout << "It looks like you don’t have any items left in your satchel.\n"; 
-				std::cout << "Please come back when you have more that you want to donate!\n";
+				io.out() << "It looks like you don’t have any items left in your satchel.\n"; 
+				io.out() << "Please come back when you have more that you want to donate!\n";
 			}
-			std::cout << std::endl;
-		} while (satchel.empty() == false && wantsToExit == false);
+			io.out() << std::endl;
+		} while (state.satchel.empty() == false && wantsToExit == false);
 	}
-	pressEnter();
+	co_await io.pause();
 }
@@ -10,14 +10,12 @@
  * 		route possible (by going through the Forum).
  *
  * 		Protected data members inherited by Space child classes include the following:
- * 		- Pointers to the Spaces in all 8 directions (north, northeast, east, etc.)
  * 		- A string representing the name of the space
  *		- An int representing the space's number (for use when displaying map of player's
  *		current location)
- *		- A string description of the space
+ *		- A view of the space's description in the shared Content
  *
  *		Functions inherited from parent Space class include:
- *		- Accessor and mutator methods for all space pointers
  *		- Accessor methods for space name, number, and description
  *		
  *		Member functions of this class include:
@@ -31,15 +29,12 @@
  * Description: Default constructor for Thermae object.
  *
  * 		Calls Space constructor and passes it a string indicating a space's name, 
- * 		an int indicating its number on the map, and a string with the name of a 
- * 		.txt file containing its description. 
- * 		Space constructor then sets the name and num to the parameters received.
- * 		Opens input file and reads description into description data member.
- * 		Sets all space pointers to nullptr since the mutator methods will
- * 		later be used to set those pointers once all spaces have been created.
+ * 		an int indicating its number on the map, and the Asset holding its description.
+ * 		Space constructor then sets the name and num to the parameters received
+ * 		and looks up the description in the shared Content.
  ***************************************************************************************************/
 
-Thermae::Thermae() : Space("Thermae", 8, "Thermae_Description.txt")
+Thermae::Thermae() : Space("Thermae", 8, Asset::THERMAE_DESCRIPTION)
 {
 }
 
@@ -59,25 +54,16 @@ Thermae::~Thermae()
 
 
 /*************************************************************************************************** 
- * Description: Virtual function that implements pure virtual "interact" function
- * 		defined in parent class. Since function signature must be identical
- * 		in all child classes in order to override the parent class pure virtual function,
- * 		all child classes' interact functions receive the same seven paremeters passed by
- * 		the Game class. All parameters are passed by reference so that the 
- * 		interact functions can change them as needed (they all have return type of void 
- * 		but may need to change multiple parameters of multiple types). 
- * 		Not every child class uses all seven parameters, but each
- * 		parameter is used by at least one child class. The parameters are listed below,
- * 		with a # symbol before and after each one used by this particular class:
- *		
- *		  - a set of strings indicating the items in the player's satchel 
- *		# - an int indicating how much money the player has #
- *		# - an int indicating how many steps the player has taken since bathing #
- *		# - a bool indicating whether or not the player has bathed #
- *		  - a bool indicating whether or not the player knows about the scroll that
- *		    the librarian wants to be returned 
- *		  - a bool indicating whether or not the player is still alive
- *		  - a bool indicating whether or not the player is with Nero 
+ * Description: Virtual coroutine that implements pure virtual "interact" coroutine
+ * 		defined in parent class. Receives the GameIO object through which all input and
+ * 		output is performed, the GameState holding everything that can change during
+ * 		the game, and the game's Random number generator, all passed by reference so that
+ * 		the interact function can change the state as needed. The fields of the GameState used by this particular class are
+ * 		listed below:
+ *
+ *		- money: how much money the player has
+ *		- stepsSinceBathing: how many steps the player has taken since bathing
+ *		- hasBathed: whether or not the player has bathed
  *
  *		The Thermae's implementation of this function does the following:
  *		- Checks to see if the user has enough money to bathe (2 coins required)
@@ -86,64 +72,62 @@ Thermae::~Thermae()
  *		  accordingly.
  ***************************************************************************************************/
 
-void Thermae::interact(std::set<std::string>& satchel, int& money, int& stepsSinceBathing,
-			   bool& hasBathed, bool& knowsAboutScroll, bool& stillAlive, bool& withNero)
+Task<void> Thermae::interact(GameIO& io, GameState& state, [[maybe_unused]] Random& rng)
 {
-	std::cout << "Welcome to the beautiful, luxurious Thermae!\n";
-	std::cout << "The cost of a bath is " << BATH_COST << " coins.\n\n";
+	io.out() << "Welcome to the beautiful, luxurious Thermae!\n";
+	io.out() << "The cost of a bath is " << BATH_COST << " coins.\n\n";
 	
 	// If the user does not have enough meony to bathe, inform them.
-	if (money < BATH_COST)
+	if (state.money < BATH_COST)
 	{
-		std::cout << "You do not have enough money to bathe at this time.\n"; 
-		std::cout << "Please come back again when you have more money.\n";
+		io.out() << "You do not have enough money to bathe at this time.\n"; 
+		io.out() << "Please come back again when you have more money.\n";
 	}
 
 	// Otherwise, ask the user if they want to bathe
 	else
 	{
-		std::cout << "Would you like to bathe?\n";
-		std::vector<std::string> bathMenu = {"Bathe", "Do not bathe"};
-		int bathChoice = menu(bathMenu);
+		io.out() << "Would you like to bathe?\n";
+		const std::string_view bathMenu[] = {"Bathe", "Do not bathe"};
+		int bathChoice = co_await io.choose(Prompt::BATHE, bathMenu);
 
 		// If the user chooses to bathe, deduct
 		// the cost of the bath from their money, and then print the bath messages.
 		if (bathChoice == 1)
 		{
-			money -= BATH_COST;
+			state.money -= BATH_COST;
 			
 			// If the user has not bathed this game, print the
 			// narration of their experience from the Thermae_Narration text file
-			// and set hasBathed to true.
-			if (!hasBathed)
+			// (loaded once per process by the Content class) and set hasBathed to true.
+			if (!state.hasBathed)
 			{
-				std::ifstream inputFile("Thermae_Narration.txt");
-				std::string text;
-				while (getline(inputFile, text, DELIM))
+				for (std::string_view text : Content::get().sections(Asset::THERMAE_NARRATION))
 				{
-					std::cout << text;
+					io.out() << text;
 				}
-				hasBathed = true;
+				state.hasBathed = true;
 			}
 
 			// Otherwise, if the user has already bathed this game,
 			// print a shorter message.
 			else
 			{
-				std::cout << "Since you have already bathed today, you know how the routine goes.\n";
-				std::cout << "Now you are nice and clean again!\n";
+				io.out() << "Since you have already bathed today, you know how the routine goes.\n";
+				io.out() << "Now you are nice and clean again!\n";
 			}
 			
 			// Reset stepsSinceBathing to 0
-			stepsSinceBathing = 0;
+			state.stepsSinceBathing = 0;
+			io.event(EventType::BATHED);
 		}
 
 		// Otherwise, if the user has chosen not to bathe,
 		// encourage them to come back again later.
 		else
 		{
-			std::cout << "Come back later if you change your mind!\n";
+			io.out() << "Come back later if you change your mind!\n";
 		}
 	}
-	pressEnter();
+	co_await io.pause();
 }
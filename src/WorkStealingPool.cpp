@@ -0,0 +1,156 @@
+/***************************************************************************************************
+ * Program Name: WorkStealingPool.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: WorkStealingPool class that runs a numbered set of independent jobs on several
+ * 		threads, each of which steals half of another thread's remaining jobs once it runs
+ * 		out of its own. See WorkStealingPool.hpp.
+ **************************************************************************************************/
+#include "WorkStealingPool.hpp"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Struct holding the range of job numbers [begin, end) left to a thread, with its lock (aligned
+// to a cache line, so that the threads taking jobs from their own ranges do not slow each other)
+struct alignas(64) JobRange
+{
+	std::mutex lock;
+	std::size_t begin = 0;
+	std::size_t end = 0;
+};
+
+
+/***************************************************************************************************
+ * Description: Helper function that receives the ranges of every thread and the number of a
+ * 		thread. Takes the next job from the thread's own range, or, if it is empty, steals
+ * 		the back half of the first other range with jobs left (looking at the threads after
+ * 		this one in turn) and takes the first job of that. Returns true and stores the job
+ * 		number in "jobNum", or returns false if no thread had a job left.
+ ***************************************************************************************************/
+
+static bool take_job(std::vector<JobRange>& ranges, int threadNum, std::size_t& jobNum)
+{
+	JobRange& own = ranges[threadNum];
+	{
+		std::lock_guard<std::mutex> guard(own.lock);
+		if (own.begin < own.end)
+		{
+			jobNum = own.begin++;
+			return true;
+		}
+	}
+
+	int numThreads = static_cast<int>(ranges.size());
+	for (int offset = 1; offset < numThreads; offset++)
+	{
+		JobRange& victim = ranges[(threadNum + offset) % numThreads];
+		std::size_t stolenBegin = 0;
+		std::size_t stolenEnd = 0;
+		{
+			std::lock_guard<std::mutex> guard(victim.lock);
+			if (victim.begin == victim.end)
+			{
+				continue;
+			}
+			stolenEnd = victim.end;
+			stolenBegin = victim.end - (victim.end - victim.begin + 1) / 2;
+			victim.end = stolenBegin;
+		}
+
+		// Only this thread refills its own range, so it is still empty
+		std::lock_guard<std::mutex> guard(own.lock);
+		own.begin = stolenBegin + 1;
+		own.end = stolenEnd;
+		jobNum = stolenBegin;
+		return true;
+	}
+	return false;
+}
+
+
+/***************************************************************************************************
+ * Description: Constructor that receives the number of threads with which to run jobs (0, the
+ * 		default, uses every hardware thread).
+ ***************************************************************************************************/
+
+WorkStealingPool::WorkStealingPool(int numThreads)
+{
+	if (numThreads <= 0)
+	{
+		numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	}
+	this->numThreads = numThreads;
+}
+
+
+/***************************************************************************************************
+ * Description: Accessor method that receives nothing and returns the number of threads.
+ ***************************************************************************************************/
+
+int WorkStealingPool::get_num_threads() const
+{
+	return this->numThreads;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the number of jobs and the function that runs a job (which receives the
+ * 		number of the thread running it, from 0 to get_num_threads() - 1, and the number of
+ * 		the job, from 0 to numJobs - 1). Splits the jobs evenly among the threads (the
+ * 		calling thread being thread 0) and runs every job exactly once. Returns once all of
+ * 		them are done. If a job throws an exception, every thread stops taking jobs once it
+ * 		finishes the one it is running, and the first exception thrown is then rethrown.
+ ***************************************************************************************************/
+
+void WorkStealingPool::run(std::size_t numJobs, const std::function<void(int threadNum, std::size_t jobNum)>& job) const
+{
+	std::vector<JobRange> ranges(numThreads);
+	for (int threadNum = 0; threadNum < numThreads; threadNum++)
+	{
+		ranges[threadNum].begin = numJobs * threadNum / numThreads;
+		ranges[threadNum].end = numJobs * (threadNum + 1) / numThreads;
+	}
+
+	std::mutex errorLock;
+	std::exception_ptr error;
+	std::atomic<bool> failed(false);
+	auto work = [&](int threadNum)
+	{
+		std::size_t jobNum = 0;
+		while (!failed.load(std::memory_order_relaxed) && take_job(ranges, threadNum, jobNum))
+		{
+			try
+			{
+				job(threadNum, jobNum);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> guard(errorLock);
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int threadNum = 1; threadNum < numThreads; threadNum++)
+	{
+		threads.emplace_back(work, threadNum);
+	}
+	work(0);
+	for (std::thread& worker : threads)
+	{
+		worker.join();
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
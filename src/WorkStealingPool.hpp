@@ -0,0 +1,44 @@
+/***************************************************************************************************
+ * Program Name: WorkStealingPool.hpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: WorkStealingPool class that runs a numbered set of independent jobs (such as the
+ * 		games played by the simulator) on several threads, each job once, keeping every
+ * 		thread busy until all of them are done even when some jobs take much longer than
+ * 		others.
+ *
+ * 		The jobs are split into one range of job numbers for each thread. A thread takes the
+ * 		jobs at the front of its own range one at a time, and once its range is empty, it
+ * 		steals the back half of the range of another thread that still has jobs left. Each
+ * 		range has its own lock, which is almost always taken only by the thread that owns
+ * 		it, so the threads rarely wait for one another, and there is no shared queue or
+ * 		counter for them all to contend over. The function that runs a job receives the
+ * 		number of the thread running it, so that each thread can add its results to its
+ * 		own accumulator, to be combined once every job is done.
+ *
+ *		Private data members of the WorkStealingPool class include:
+ *		- The number of threads
+ *
+ *		Public member functions of the WorkStealingPool class include:
+ *		- A constructor that receives the number of threads
+ *		- An accessor method for the number of threads
+ *		- A function that runs a number of jobs on the threads and returns once all of them
+ *		  are done
+ **************************************************************************************************/
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <cstddef>
+#include <functional>
+
+class WorkStealingPool
+{
+	private:
+		int numThreads;
+
+	public:
+		WorkStealingPool(int numThreads = 0);
+		int get_num_threads() const;
+		void run(std::size_t numJobs, const std::function<void(int threadNum, std::size_t jobNum)>& job) const;
+};
+#endif
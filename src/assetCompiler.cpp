@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Program Name: assetCompiler.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program packs the game's 14 text files into a single binary asset archive
+ * 		(see AssetArchive.hpp for its layout). The text of each file is split into
+ * 		sections at every '#' and the trivia questions are parsed here, when the archive is
+ * 		built, so that the game only has to map the archive into memory when it starts.
+ *
+ * 		The optional command-line argument is the name of the archive file to write
+ * 		(Game_Assets.bin by default). The program is run by "make Game_Assets.bin", which
+ * 		rebuilds the archive whenever one of the text files changes.
+ *
+ * 		If the first argument is "--embed", the archive is instead written as a C++ source
+ * 		file (EmbeddedAssets.cpp by default) defining the archive as a constant byte array.
+ * 		"make embedded" compiles that file into the game, so the embedded build never
+ * 		opens a file to load its content.
+ **************************************************************************************************/
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "Content.hpp"
+
+// Name of the source file written by "--embed"
+const char EMBEDDED_FILE_NAME[] = "EmbeddedAssets.cpp";
+
+// Number of bytes of the archive written on each line of the source file
+const int BYTES_PER_LINE = 16;
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a file and the bytes of an archive. Writes the bytes to the
+ * 		file unchanged. Returns a bool indicating whether or not the file was written.
+ ***************************************************************************************************/
+
+bool write_archive(const char* fileName, const std::string& archiveBytes)
+{
+	std::ofstream outputFile(fileName, std::ios::binary | std::ios::trunc);
+	outputFile.write(archiveBytes.data(), archiveBytes.size());
+	outputFile.close();
+	return !outputFile.fail();
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a file and the bytes of an archive. Writes a C++ source file
+ * 		defining EMBEDDED_ARCHIVE (the bytes, aligned for the archive's tables) and
+ * 		EMBEDDED_ARCHIVE_SIZE. Returns a bool indicating whether or not the file was written.
+ ***************************************************************************************************/
+
+bool write_embedded_source(const char* fileName, const std::string& archiveBytes)
+{
+	static const char HEX_DIGITS[] = "0123456789abcdef";
+
+	std::ofstream outputFile(fileName, std::ios::trunc);
+	outputFile << "// Generated by assetCompiler from the game's text files. Do not edit.\n";
+	outputFile << "#include \"AssetArchive.hpp\"\n\n";
+	outputFile << "alignas(8) extern const unsigned char EMBEDDED_ARCHIVE[] = {";
+	for (size_t index = 0; index < archiveBytes.size(); index++)
+	{
+		unsigned char byte = static_cast<unsigned char>(archiveBytes[index]);
+		outputFile << ((index % BYTES_PER_LINE == 0) ? "\n\t" : " ");
+		outputFile << "0x" << HEX_DIGITS[byte >> 4] << HEX_DIGITS[byte & 0xF] << ",";
+	}
+	outputFile << "\n};\n\n";
+	outputFile << "extern const std::size_t EMBEDDED_ARCHIVE_SIZE = " << archiveBytes.size() << ";\n";
+	outputFile.close();
+	return !outputFile.fail();
+}
+
+
+int main(int argc, char* argv[])
+{
+	bool embed = (argc > 1 && strcmp(argv[1], "--embed") == 0);
+	int fileArg = embed ? 2 : 1;
+	const char* fileName = (argc > fileArg) ? argv[fileArg] : (embed ? EMBEDDED_FILE_NAME : ARCHIVE_FILE_NAME);
+
+	// Always load the content from the text files (never from an existing archive)
+	std::unique_ptr<const Content> content;
+	try
+	{
+		content = Content::load(ContentSource::TEXT_FILES);
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "assetCompiler: " << error.what() << std::endl;
+		return 1;
+	}
+
+	int numSections = 0;
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		numSections += content->sections(static_cast<Asset>(index)).size();
+	}
+
+	std::string archiveBytes = AssetArchive::build(*content);
+	bool written = embed ? write_embedded_source(fileName, archiveBytes) : write_archive(fileName, archiveBytes);
+	if (!written)
+	{
+		std::cerr << "assetCompiler: could not write " << fileName << std::endl;
+		return 1;
+	}
+
+	std::cout << "assetCompiler: wrote " << fileName << " (" << NUM_ASSETS << " assets, ";
+	std::cout << numSections << " sections, " << content->questions().size() << " questions)" << std::endl;
+	return 0;
+}
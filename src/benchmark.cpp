@@ -0,0 +1,1807 @@
+/***************************************************************************************************
+ * Program Name: benchmark.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program measures the performance of the game engine. Each benchmark is
+ * 		implemented in its own function and is selected by name on the command line
+ * 		(for example "benchmark headless 100000"). The optional second argument is the
+ * 		number of iterations to run. If no benchmark is named, every benchmark is run
+ * 		with its default number of iterations.
+ *
+ * 		Benchmarks include the following:
+ * 		- headless: plays complete games through the HeadlessIO frontend with a
+ * 		  RandomDecisionSource and reports games and decisions per second
+ * 		- render: draws the two screens of a turn (status line, satchel, board image,
+ * 		  description, and menu) the way the game did before the Renderer existed
+ * 		  (running "clear" and then writing the text) and with the Renderer in full
+ * 		  and diff mode, and reports the average latency per turn of each
+ * 		- content: measures the startup cost of loading the Content from the text files,
+ * 		  from the packed asset archive file, and from the archive embedded in this program
+ * 		  (this program is always built with the embedded archive), checks that all of them
+ * 		  hold identical content, and reports the average load time of each
+ * 		- construct: measures loading the shared Content (done once per process) and then
+ * 		  reports the average time to construct a Game, which does no file I/O
+ * 		- snapshot: takes and restores snapshots of a game's state and hashes them, and
+ * 		  compares the time per snapshot with the time needed to construct a new Game
+ * 		- random: compares the speed of the per-game Random number generator with
+ * 		  rand() % n, then plays the same seeded games on one thread and on every
+ * 		  hardware thread, checks that each game ends in the same state both times, and
+ * 		  reports the throughput of each
+ * 		- coroutine: measures the cost of asking for input through co_await, with the
+ * 		  awaiting coroutines (nested two Tasks deep, as a Space's helper is within its
+ * 		  interact function) either carrying on right away or suspended and resumed for
+ * 		  every prompt, and then the cost per answer of driving a game server Session
+ * 		- walk: takes a random legal walk around the board, choosing each step among the
+ * 		  directions allowed by the Adjacency table, and reports steps per second and how
+ * 		  often each space was visited
+ * 		- map: generates a square grid map with about the given number of spaces (1,000,000
+ * 		  by default), writes it to a map file, and reports the time to load the file and
+ * 		  the memory the loaded map takes up (and checks that Rome.map loads as the map of
+ * 		  Rome)
+ * 		- generate: generates full and irregular grid maps of about the given number of
+ * 		  spaces (4,000,000 by default) on one thread and on every hardware thread, checks
+ * 		  that they match and that the Domus Aurea can be reached, and plays games on them
+ * 		- solve: finds the fewest steps in which a new game on the map of Rome can be won,
+ * 		  for every pair of items the prefect can want, checks that each can be won within
+ * 		  MAX_STEPS (exiting with status 2 if not, so that a change to the rules that makes
+ * 		  the game unwinnable is caught), and reports the time per solve
+ * 		- expectimax: computes the exact probability of winning a new game of Rome with the
+ * 		  best play within the given number of steps (MAX_STEPS by default) on one thread
+ * 		  and on every hardware thread, checks that both give the same probability, and
+ * 		  reports the time taken and the states evaluated per second
+ * 		- batch: plays the given number of turns (10,000 by default) of 4,096 games at once
+ * 		  in a BatchEnv with random actions, starting a new game in each slot whose game
+ * 		  has ended after every turn, and reports the game turns played per second by
+ * 		  step() alone and with the new games started, and how the games ended
+ * 		- mcts: plays the given number of games of Rome (10 by default) with the MctsPolicy
+ * 		  at budgets of 100, 1,000, and 10,000 rollouts per search, with root-parallel and
+ * 		  tree-parallel search on every hardware thread, and reports the rollouts played
+ * 		  per second and the share of the games won within MAX_STEPS for each
+ * 		- terminal: plays the given number of games (200 by default) through the TerminalIO
+ * 		  frontend with random typed answers and output sent to /dev/null, and reports the
+ * 		  write calls, flushes absorbed, and bytes written per turn
+ * 		- input: parses the given number of typed menu choices (10,000,000 by default, some
+ * 		  of them empty, not integers, or out of range) from a file, first the way
+ * 		  enterValidInt did before the InputReader (getline, isdigit, and stoi) and then
+ * 		  with an InputReader, checks that both give the same results, and reports the
+ * 		  choices parsed per second by each
+ * 		- typeahead: plays the given number of games (200 by default) headlessly with random
+ * 		  choices while writing the answers into scripts, types the scripts to the
+ * 		  TerminalIO frontend one answer per line and then one line per game (typed ahead),
+ * 		  checks that every game ends the same way each time, and reports the write calls,
+ * 		  bytes written, and screens skipped per game each way
+ * 		- noninteractive: plays the given number of games (200 by default) the same way,
+ * 		  typing the scripts to the TerminalIO frontend in interactive and non-interactive
+ * 		  mode, checks that every game ends the same way each time, and reports the bytes
+ * 		  written per game each way
+ * 		- replay: records the given number of games (100,000 by default) played at random
+ * 		  into ReplayLogs, encoded one after another as in a log file, then decodes and
+ * 		  plays every one again, and reports the bytes per game, the games played again per
+ * 		  second, and whether every game ended in its recorded state
+ * 		- allocations: counts the heap allocations made by a move prompt at each space of
+ * 		  Rome (with the menu built as a vector of strings for every prompt and with the
+ * 		  menu the Board builds once), and by each of the given number of turns (100,000 by
+ * 		  default) of games played at random, checks that a move prompt allocates nothing
+ * 		  and a turn in which the player only moves allocates only its coroutine frames, and
+ * 		  reports the allocations of each
+ **************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <sstream>
+#include <unordered_set>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "BatchEnv.hpp"
+#include "Expectimax.hpp"
+#include "Game.hpp"
+#include "HeadlessIO.hpp"
+#include "InputReader.hpp"
+#include "MapGenerator.hpp"
+#include "Policy.hpp"
+#include "Renderer.hpp"
+#include "ReplayLog.hpp"
+#include "Session.hpp"
+#include "Solver.hpp"
+#include "TerminalIO.hpp"
+
+// Clock used to time every benchmark
+typedef std::chrono::steady_clock BenchClock;
+
+
+/***************************************************************************************************
+ * Description: Receives the time at which a benchmark started. Returns the number of seconds
+ * 		that have elapsed since then.
+ ***************************************************************************************************/
+
+double seconds_since(BenchClock::time_point start)
+{
+	std::chrono::duration<double> elapsed = BenchClock::now() - start;
+	return elapsed.count();
+}
+
+
+/***************************************************************************************************
+ * Description: EventSink that tallies how each game ended.
+ ***************************************************************************************************/
+
+class OutcomeCounter : public EventSink
+{
+	public:
+		int wins = 0;
+		int deaths = 0;
+		int timeouts = 0;
+
+		virtual void on_event(const GameEvent& gameEvent) override
+		{
+			if (gameEvent.type == EventType::WON)
+			{
+				wins++;
+			}
+			else if (gameEvent.type == EventType::DIED)
+			{
+				deaths++;
+			}
+			else if (gameEvent.type == EventType::OUT_OF_STEPS)
+			{
+				timeouts++;
+			}
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Plays the received number of complete games headlessly, with every decision made
+ * 		at random, and prints the throughput. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_headless(int games)
+{
+	RandomDecisionSource decisions;
+	OutcomeCounter outcomes;
+	HeadlessIO io(decisions, &outcomes);
+
+	BenchClock::time_point start = BenchClock::now();
+	for (int count = 0; count < games; count++)
+	{
+		Game game(io);
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+	}
+	double elapsed = seconds_since(start);
+
+	std::cout << "headless: " << games << " games in " << elapsed << " s (";
+	std::cout << (games / elapsed) << " games/s, " << (io.get_decisions_made() / elapsed) << " decisions/s)\n";
+	std::cout << "\twins: " << outcomes.wins << "  deaths: " << outcomes.deaths;
+	std::cout << "  out of steps: " << outcomes.timeouts << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the board images, the number of the space at which the player is located,
+ * 		and the number of steps taken. Returns the text of a turn's screen at that space,
+ * 		built the same way Game::take_turn builds it.
+ ***************************************************************************************************/
+
+std::string turn_screen(const std::vector<std::string>& boardImages, int spaceNum, int stepsTaken)
+{
+	std::string screen = "\tSteps Taken: " + std::to_string(stepsTaken) + " of " + std::to_string(MAX_STEPS);
+	screen += "\tCoins: 6\tCurrent Space: Forum\n\nSatchel Contents: grain, wine";
+	screen += boardImages[spaceNum - 1];
+	screen += "Space Description: Come to the Forum to purchase various goods that are available for sale.\n";
+	screen += "\n**************************************************************************\n";
+	screen += "1. Enter Forum\n2. Keep moving\n";
+	screen += "**************************************************************************\n\nYour choice: ";
+	return screen;
+}
+
+
+/***************************************************************************************************
+ * Description: Draws the received number of turns (two screens each) to /dev/null using the
+ * 		"clear" command, the Renderer in full mode, and the Renderer in diff mode, and prints
+ * 		the average latency per turn of each. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_render(int turns)
+{
+	// Copy the board images used to build each screen
+	std::vector<std::string> boardImages;
+	for (std::string_view image : Content::get().sections(Asset::BOARD_IMAGES))
+	{
+		boardImages.push_back(std::string(image));
+	}
+
+	int nullFd = open("/dev/null", O_WRONLY);
+
+	// Before: every screen runs the "clear" command and then writes its text
+	BenchClock::time_point start = BenchClock::now();
+	for (int turn = 0; turn < turns; turn++)
+	{
+		for (int screen = 0; screen < 2; screen++)
+		{
+			std::string text = turn_screen(boardImages, (turn % NUM_BOARD_IMAGES) + 1, turn);
+			if (std::system("clear > /dev/null") != 0)
+			{
+				std::cout << "render: could not run clear\n";
+			}
+			if (write(nullFd, text.data(), text.size()) < 0)
+			{
+				std::cout << "render: write failed\n";
+			}
+		}
+	}
+	double clearSeconds = seconds_since(start);
+
+	// After: the Renderer in full mode and in diff mode
+	double rendererSeconds[2];
+	for (int mode = 0; mode < 2; mode++)
+	{
+		Renderer renderer(nullFd, mode == 1);
+		std::ostream screenStream(&renderer);
+		start = BenchClock::now();
+		for (int turn = 0; turn < turns; turn++)
+		{
+			for (int screen = 0; screen < 2; screen++)
+			{
+				renderer.clear_screen();
+				screenStream << turn_screen(boardImages, (turn % NUM_BOARD_IMAGES) + 1, turn);
+				renderer.present();
+			}
+		}
+		rendererSeconds[mode] = seconds_since(start);
+	}
+	close(nullFd);
+
+	std::cout << "render: " << turns << " turns\n";
+	std::cout << "\tclear command:   " << (clearSeconds / turns * 1e6) << " us/turn\n";
+	std::cout << "\trenderer (full): " << (rendererSeconds[0] / turns * 1e6) << " us/turn\n";
+	std::cout << "\trenderer (diff): " << (rendererSeconds[1] / turns * 1e6) << " us/turn\n";
+}
+
+
+/***************************************************************************************************
+ * Description: Plays the received number of complete games through the TerminalIO frontend, with
+ * 		standard output sent to /dev/null and an InputReader reading a file of random
+ * 		answers (empty lines, which continue past pauses, and numbers from 1 to 8, some of
+ * 		which are rejected by menus with more or fewer choices, as a person's might be).
+ * 		Prints the time per turn and the output of each turn: the write calls made, the
+ * 		flushes absorbed, and the bytes written (and the share written straight from static
+ * 		text). Returns nothing.
+ ***************************************************************************************************/
+
+void bench_terminal(int games)
+{
+	const int LINES_PER_GAME = 5000;
+	Random rng(1);
+	std::string answers;
+	for (long line = 0; line < static_cast<long>(games) * LINES_PER_GAME; line++)
+	{
+		if (rng.get_int(0, 3) != 0)
+		{
+			answers += static_cast<char>('0' + rng.get_int(1, 8));
+		}
+		answers += '\n';
+	}
+
+	// Send standard output to /dev/null and read the answers from a file
+	const char ANSWER_FILE[] = "benchmark_answers.tmp";
+	std::ofstream answerFile(ANSWER_FILE, std::ios::binary | std::ios::trunc);
+	answerFile << answers;
+	answerFile.close();
+	int answerFd = open(ANSWER_FILE, O_RDONLY);
+	std::cout.flush();
+	int savedStdout = dup(STDOUT_FILENO);
+	int nullFd = open("/dev/null", O_WRONLY);
+	dup2(nullFd, STDOUT_FILENO);
+	close(nullFd);
+
+	long turns = 0;
+	long linesRead = 0;
+	RendererStats stats;
+	BenchClock::time_point start = BenchClock::now();
+	{
+		InputReader input(answerFd);
+		TerminalIO io(false, input);
+		for (int count = 0; count < games; count++)
+		{
+			Game game(io, count + 1);
+			while (!game.game_over())
+			{
+				game.take_turn();
+				turns++;
+			}
+		}
+		io.clear_screen();
+		stats = io.get_stats();
+		linesRead = input.get_lines_read();
+	}
+	double elapsed = seconds_since(start);
+
+	dup2(savedStdout, STDOUT_FILENO);
+	close(savedStdout);
+	close(answerFd);
+	unlink(ANSWER_FILE);
+
+	std::cout << "terminal: " << games << " games, " << turns << " turns, " << linesRead << " lines of input in " << elapsed << " s (";
+	std::cout << (elapsed / turns * 1e6) << " us/turn)\n";
+	std::cout << "\twrite calls:      " << (static_cast<double>(stats.writeCalls) / turns) << " per turn, ";
+	std::cout << (static_cast<double>(stats.writeCalls) / linesRead) << " per line of input\n";
+	std::cout << "\tflushes absorbed: " << (static_cast<double>(stats.flushes) / turns) << " per turn\n";
+	std::cout << "\tbytes written:    " << (static_cast<double>(stats.bytesWritten) / turns) << " per turn (";
+	std::cout << (100.0 * stats.staticBytes / stats.bytesWritten) << "% written from static text without a copy)" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the number of menu choices to parse. Writes a file of that many typed
+ * 		choices (mostly numbers from 1 to 8, with some empty lines, words, lone dashes, and
+ * 		integers too large for an int), then parses the file the way enterValidInt did before
+ * 		the InputReader existed (getline into a string, isdigit on each character, and stoi
+ * 		in a try block) and with an InputReader. Prints the choices parsed per second by
+ * 		each. Returns true if both found the same choices valid (with the same sum) and
+ * 		rejected the same number for each reason, or false if they did not.
+ ***************************************************************************************************/
+
+bool bench_input(long choices)
+{
+	const char INPUT_FILE[] = "benchmark_input.tmp";
+	Random rng(1);
+	std::string typed;
+	for (long count = 0; count < choices; count++)
+	{
+		int kind = rng.get_int(1, 100);
+		if (kind <= 90)
+		{
+			typed += static_cast<char>('0' + rng.get_int(1, 8));
+		}
+		else if (kind <= 95)
+		{
+			// Empty line
+		}
+		else if (kind <= 98)
+		{
+			typed += "north";
+		}
+		else if (kind <= 99)
+		{
+			typed += "-";
+		}
+		else
+		{
+			typed += "99999999999";
+		}
+		typed += '\n';
+	}
+	std::ofstream inputFile(INPUT_FILE, std::ios::binary | std::ios::trunc);
+	inputFile << typed;
+	inputFile.close();
+
+	// Results counted by each parser: the valid choices, their sum, and the lines rejected
+	// as not integers and as out of range
+	long long results[2][4] = {};
+
+	BenchClock::time_point start = BenchClock::now();
+	std::ifstream lines(INPUT_FILE);
+	std::string line;
+	while (getline(lines, line))
+	{
+		bool validCharacters = !line.empty() && (isdigit(static_cast<unsigned char>(line.at(0))) || line.at(0) == '-');
+		for (std::size_t position = 1; position < line.size() && validCharacters; position++)
+		{
+			validCharacters = isdigit(static_cast<unsigned char>(line.at(position)));
+		}
+		if (!validCharacters)
+		{
+			results[0][2]++;
+			continue;
+		}
+		try
+		{
+			results[0][1] += stoi(line);
+			results[0][0]++;
+		}
+		catch (...)
+		{
+			results[0][3]++;
+		}
+	}
+	double getlineSeconds = seconds_since(start);
+
+	start = BenchClock::now();
+	int inputFd = open(INPUT_FILE, O_RDONLY);
+	{
+		InputReader input(inputFd);
+		int value = 0;
+		IntStatus status;
+		while ((status = input.read_int(value)) != IntStatus::END_OF_INPUT)
+		{
+			if (status == IntStatus::VALID)
+			{
+				results[1][1] += value;
+				results[1][0]++;
+			}
+			else
+			{
+				results[1][(status == IntStatus::NOT_INTEGER) ? 2 : 3]++;
+			}
+		}
+	}
+	double readerSeconds = seconds_since(start);
+	close(inputFd);
+	unlink(INPUT_FILE);
+
+	std::cout << "input: " << choices << " menu choices (" << results[1][0] << " valid, " << results[1][2] << " not integers, ";
+	std::cout << results[1][3] << " out of range)\n";
+	std::cout << "\tgetline and stoi: " << getlineSeconds << " s (" << (choices / getlineSeconds) << " choices/s)\n";
+	std::cout << "\tInputReader:      " << readerSeconds << " s (" << (choices / readerSeconds) << " choices/s, ";
+	std::cout << (getlineSeconds / readerSeconds) << "x faster)" << std::endl;
+	for (int result = 0; result < 4; result++)
+	{
+		if (results[0][result] != results[1][result])
+		{
+			std::cout << "\tCHECK FAILED: the InputReader parsed the choices differently" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: DecisionSource that makes random choices and writes each one to a script of typed
+ * 		answers (followed by a space), and HeadlessIO that also writes each pause to the
+ * 		script (as "enter"), so that the script plays the same game again when it is typed.
+ * 		The choices alone (one per line) are also kept, to be typed in non-interactive mode.
+ ***************************************************************************************************/
+
+class ScriptingDecisions : public DecisionSource
+{
+	public:
+		RandomDecisionSource random;
+		std::string script;
+		std::string choices;
+
+		ScriptingDecisions(std::uint64_t seed) : random(seed) {}
+
+		virtual int choose(Prompt prompt, MenuChoices menuChoices) override
+		{
+			int choice = random.choose(prompt, menuChoices);
+			script += std::to_string(choice);
+			script += ' ';
+			choices += std::to_string(choice);
+			choices += '\n';
+			return choice;
+		}
+};
+
+class ScriptingIO : public HeadlessIO
+{
+	public:
+		ScriptingDecisions* decisions;
+
+		ScriptingIO(ScriptingDecisions& decisions) : HeadlessIO(decisions), decisions(&decisions) {}
+
+		virtual void press_enter() override
+		{
+			decisions->script += "enter ";
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Receives typed answers, the hashes of the states in which the games they play must
+ * 		end (one per game), a RendererStats and a number of seconds passed by reference, and
+ * 		whether or not to play in non-interactive mode. Plays the games through the
+ * 		TerminalIO frontend with an InputReader reading the answers from a file and standard
+ * 		output sent to /dev/null. Stores the counts of the Renderer's output in "stats" and
+ * 		the time taken in "seconds". Returns the number of games that ended in the expected
+ * 		state.
+ ***************************************************************************************************/
+
+int play_typed(const std::string& answers, const std::vector<std::uint64_t>& hashes, RendererStats& stats, double& seconds,
+	bool nonInteractive = false)
+{
+	const char ANSWER_FILE[] = "benchmark_answers.tmp";
+	std::ofstream answerFile(ANSWER_FILE, std::ios::binary | std::ios::trunc);
+	answerFile << answers;
+	answerFile.close();
+	int answerFd = open(ANSWER_FILE, O_RDONLY);
+	std::cout.flush();
+	int savedStdout = dup(STDOUT_FILENO);
+	int nullFd = open("/dev/null", O_WRONLY);
+	dup2(nullFd, STDOUT_FILENO);
+	close(nullFd);
+
+	int matched = 0;
+	BenchClock::time_point start = BenchClock::now();
+	{
+		InputReader input(answerFd);
+		TerminalIO io(false, input);
+		io.set_non_interactive(nonInteractive);
+		for (std::size_t count = 0; count < hashes.size(); count++)
+		{
+			Game game(io, count + 1);
+			while (!game.game_over())
+			{
+				game.take_turn();
+			}
+			if (hash_state(game.snapshot()) == hashes[count])
+			{
+				matched++;
+			}
+		}
+		io.clear_screen();
+		stats = io.get_stats();
+	}
+	seconds = seconds_since(start);
+
+	dup2(savedStdout, STDOUT_FILENO);
+	close(savedStdout);
+	close(answerFd);
+	unlink(ANSWER_FILE);
+	return matched;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of games. Plays that many games headlessly with random choices,
+ * 		writing the answers that play each one again into a script, then types the scripts
+ * 		to the TerminalIO frontend twice: one answer per line, and each game's answers on a
+ * 		single line typed ahead. Prints the write calls and bytes written per game each way.
+ * 		Returns true if every game ended in the same state all three times, or false if not.
+ ***************************************************************************************************/
+
+bool bench_typeahead(int games)
+{
+	std::string perLine;
+	std::string typedAhead;
+	std::vector<std::uint64_t> hashes;
+	long answers = 0;
+	for (int count = 0; count < games; count++)
+	{
+		ScriptingDecisions decisions(count + 1);
+		ScriptingIO io(decisions);
+		Game game(io, count + 1);
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+		hashes.push_back(hash_state(game.snapshot()));
+
+		typedAhead += decisions.script;
+		typedAhead += '\n';
+		std::string_view rest = decisions.script;
+		std::string_view answer;
+		while (InputReader::next_answer(rest, answer))
+		{
+			perLine += answer;
+			perLine += '\n';
+			answers++;
+		}
+	}
+
+	RendererStats stats[2];
+	double seconds[2];
+	int matched[2];
+	matched[0] = play_typed(perLine, hashes, stats[0], seconds[0]);
+	matched[1] = play_typed(typedAhead, hashes, stats[1], seconds[1]);
+
+	std::cout << "typeahead: " << games << " games, " << (static_cast<double>(answers) / games) << " answers per game\n";
+	const char* labels[2] = {"one answer per line: ", "one line per game:   "};
+	for (int mode = 0; mode < 2; mode++)
+	{
+		std::cout << "\t" << labels[mode] << (static_cast<double>(stats[mode].writeCalls) / games) << " write calls, ";
+		std::cout << (static_cast<double>(stats[mode].bytesWritten) / games) << " bytes, ";
+		std::cout << (static_cast<double>(stats[mode].screensSkipped) / games) << " screens skipped per game (";
+		std::cout << (seconds[mode] / games * 1e6) << " us/game)\n";
+	}
+	std::cout << "\tended in the same state: " << matched[0] << " and " << matched[1] << " of " << games << std::endl;
+	if (matched[0] != games || matched[1] != games)
+	{
+		std::cout << "\tCHECK FAILED: a typed game did not end in the state it ended in headlessly" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of games. Plays that many games headlessly with random choices,
+ * 		writing the answers that play each one again into scripts, then types the scripts to
+ * 		the TerminalIO frontend one answer per line, first with every pause answered and
+ * 		then (without the presses of enter) in non-interactive mode. Prints the bytes written
+ * 		per game each way. Returns true if every game ended in the same state all three
+ * 		times, or false if not.
+ ***************************************************************************************************/
+
+bool bench_noninteractive(int games)
+{
+	std::string interactive;
+	std::string nonInteractive;
+	std::vector<std::uint64_t> hashes;
+	for (int count = 0; count < games; count++)
+	{
+		ScriptingDecisions decisions(count + 1);
+		ScriptingIO io(decisions);
+		Game game(io, count + 1);
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+		hashes.push_back(hash_state(game.snapshot()));
+
+		std::string_view rest = decisions.script;
+		std::string_view answer;
+		while (InputReader::next_answer(rest, answer))
+		{
+			interactive += answer;
+			interactive += '\n';
+		}
+		nonInteractive += decisions.choices;
+	}
+
+	RendererStats stats[2];
+	double seconds[2];
+	int matched[2];
+	matched[0] = play_typed(interactive, hashes, stats[0], seconds[0]);
+	matched[1] = play_typed(nonInteractive, hashes, stats[1], seconds[1], true);
+
+	std::cout << "noninteractive: " << games << " games\n";
+	const char* labels[2] = {"interactive:     ", "non-interactive: "};
+	for (int mode = 0; mode < 2; mode++)
+	{
+		std::cout << "\t" << labels[mode] << (static_cast<double>(stats[mode].bytesWritten) / games) << " bytes, ";
+		std::cout << (static_cast<double>(stats[mode].writeCalls) / games) << " write calls per game (";
+		std::cout << (seconds[mode] / games * 1e6) << " us/game)\n";
+	}
+	std::cout << "\t" << (static_cast<double>(stats[0].bytesWritten) / stats[1].bytesWritten) << "x fewer bytes\n";
+	std::cout << "\tended in the same state: " << matched[0] << " and " << matched[1] << " of " << games << std::endl;
+	if (matched[0] != games || matched[1] != games)
+	{
+		std::cout << "\tCHECK FAILED: a game played in non-interactive mode did not end in the same state" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives two Contents and returns a bool indicating whether or not every asset,
+ * 		section, and question they hold is identical.
+ ***************************************************************************************************/
+
+bool same_content(const Content& first, const Content& second)
+{
+	for (int index = 0; index < NUM_ASSETS; index++)
+	{
+		Asset asset = static_cast<Asset>(index);
+		if (first.asset_text(asset) != second.asset_text(asset) || first.sections(asset) != second.sections(asset))
+		{
+			return false;
+		}
+	}
+	for (int questionNum = 0; questionNum < NUM_QUESTIONS; questionNum++)
+	{
+		const Question& firstQ = first.questions()[questionNum];
+		const Question& secondQ = second.questions()[questionNum];
+		if (firstQ.questionText != secondQ.questionText || firstQ.answerNum != secondQ.answerNum)
+		{
+			return false;
+		}
+		for (int choiceNum = 0; choiceNum < NUM_CHOICES; choiceNum++)
+		{
+			if (firstQ.answerChoices[choiceNum] != secondQ.answerChoices[choiceNum])
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Loads the Content the received number of times from each ContentSource (the text
+ * 		files, the packed asset archive file, and the embedded archive), checks that each
+ * 		holds the same content as the text files, and prints the average time per load of
+ * 		each. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_content(int loads)
+{
+	const ContentSource SOURCES[] = {ContentSource::TEXT_FILES, ContentSource::ARCHIVE_FILE, ContentSource::EMBEDDED};
+	const char* const SOURCE_NAMES[] = {"text files:   ", "archive file: ", "embedded:     "};
+
+	std::unique_ptr<const Content> fromText = Content::load(ContentSource::TEXT_FILES);
+	std::cout << "content: " << loads << " loads\n";
+
+	for (int sourceNum = 0; sourceNum < 3; sourceNum++)
+	{
+		BenchClock::time_point start = BenchClock::now();
+		for (int count = 0; count < loads; count++)
+		{
+			std::unique_ptr<const Content> content = Content::load(SOURCES[sourceNum]);
+		}
+		double seconds = seconds_since(start);
+
+		std::unique_ptr<const Content> loaded = Content::load(SOURCES[sourceNum]);
+		std::cout << "\t" << SOURCE_NAMES[sourceNum];
+		if (loaded->source() != SOURCES[sourceNum])
+		{
+			std::cout << "unavailable (run \"make " << ARCHIVE_FILE_NAME << "\")\n";
+			continue;
+		}
+		std::cout << (seconds / loads * 1e6) << " us/load (";
+		std::cout << (same_content(*fromText, *loaded) ? "identical content" : "CONTENT DIFFERS") << ")\n";
+	}
+	std::cout << std::flush;
+}
+
+
+/***************************************************************************************************
+ * Description: Times the first call to Content::get() (which loads the shared Content), then
+ * 		constructs the received number of Games and prints the average time per Game.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void bench_construct(int games)
+{
+	RandomDecisionSource decisions;
+	HeadlessIO io(decisions);
+
+	BenchClock::time_point start = BenchClock::now();
+	const Content& content = Content::get();
+	double loadSeconds = seconds_since(start);
+
+	start = BenchClock::now();
+	for (int count = 0; count < games; count++)
+	{
+		Game game(io);
+	}
+	double constructSeconds = seconds_since(start);
+
+	std::cout << "construct: " << games << " games (" << content.questions().size() << " questions loaded)\n";
+	std::cout << "\tload content (once): " << (loadSeconds * 1e6) << " us\n";
+	std::cout << "\tconstruct Game:      " << (constructSeconds / games * 1e6) << " us" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Plays a game headlessly for a few turns, then takes, hashes, and restores the
+ * 		received number of snapshots of its state (inserting each hash into a set so the
+ * 		work is not optimized away). Compares the time per snapshot with the time needed
+ * 		to construct a new Game (which builds a Board and reads every text file). Returns
+ * 		nothing.
+ ***************************************************************************************************/
+
+void bench_snapshot(int snapshots)
+{
+	RandomDecisionSource decisions;
+	HeadlessIO io(decisions);
+	Game game(io);
+	for (int turn = 0; turn < 5 && !game.game_over(); turn++)
+	{
+		game.take_turn();
+	}
+
+	// Snapshot, hash, and restore the state, changing one field each time
+	// so that every snapshot is different
+	std::unordered_set<GameState> seen;
+	BenchClock::time_point start = BenchClock::now();
+	for (int count = 0; count < snapshots; count++)
+	{
+		GameState state = game.snapshot();
+		state.money = count & 0x7FFF;
+		state.stepsSinceBathing = count >> 15;
+		seen.insert(state);
+		game.restore(state);
+	}
+	double snapshotSeconds = seconds_since(start);
+
+	// Construct new games for comparison
+	int constructions = (snapshots / 1000 > 0) ? (snapshots / 1000) : 1;
+	start = BenchClock::now();
+	for (int count = 0; count < constructions; count++)
+	{
+		Game newGame(io);
+	}
+	double constructSeconds = seconds_since(start);
+
+	std::cout << "snapshot: " << snapshots << " snapshots (" << seen.size() << " distinct), ";
+	std::cout << "sizeof(GameState) = " << sizeof(GameState) << " bytes\n";
+	std::cout << "\tsnapshot + hash + restore: " << (snapshotSeconds / snapshots * 1e9) << " ns\n";
+	std::cout << "\tconstruct Game:            " << (constructSeconds / constructions * 1e9) << " ns" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the seed of a game. Plays the game headlessly with decisions drawn from a
+ * 		RandomDecisionSource whose seed is derived from the game's seed, and returns a hash
+ * 		of the state in which the game ended.
+ ***************************************************************************************************/
+
+size_t play_seeded_game(std::uint64_t seed)
+{
+	RandomDecisionSource decisions(~seed);
+	HeadlessIO io(decisions);
+	Game game(io, seed);
+	while (!game.game_over())
+	{
+		game.take_turn();
+	}
+	return hash_state(game.snapshot());
+}
+
+
+/***************************************************************************************************
+ * Description: Draws ten million random ints with the Random number generator and with
+ * 		rand() % n and prints the time per draw of each. Then plays the received number of
+ * 		seeded games on one thread and again split between every hardware thread, checks
+ * 		that each game ended in the same state both times, and prints the throughput of
+ * 		each. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_random(int games)
+{
+	const int DRAWS = 10000000;
+
+	Random rng(2026);
+	long long total = 0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int count = 0; count < DRAWS; count++)
+	{
+		total += rng.get_int(0, 2);
+	}
+	double randomSeconds = seconds_since(start);
+
+	srand(2026);
+	long long randTotal = 0;
+	start = BenchClock::now();
+	for (int count = 0; count < DRAWS; count++)
+	{
+		randTotal += rand() % 3;
+	}
+	double randSeconds = seconds_since(start);
+
+	std::cout << "random: " << DRAWS << " draws of a number from 0 to 2 (means ";
+	std::cout << (static_cast<double>(total) / DRAWS) << " and " << (static_cast<double>(randTotal) / DRAWS) << ")\n";
+	std::cout << "\tRandom::get_int: " << (randomSeconds / DRAWS * 1e9) << " ns/draw\n";
+	std::cout << "\trand() % n:      " << (randSeconds / DRAWS * 1e9) << " ns/draw\n";
+
+	// Play every game on this thread
+	std::vector<size_t> sequential(games);
+	start = BenchClock::now();
+	for (int gameNum = 0; gameNum < games; gameNum++)
+	{
+		sequential[gameNum] = play_seeded_game(gameNum);
+	}
+	double sequentialSeconds = seconds_since(start);
+
+	// Play the same games again, with each thread taking every numThreads-th game
+	int numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	std::vector<size_t> parallel(games);
+	std::vector<std::thread> threads;
+	start = BenchClock::now();
+	for (int threadNum = 0; threadNum < numThreads; threadNum++)
+	{
+		threads.emplace_back([&parallel, games, numThreads, threadNum]()
+		{
+			for (int gameNum = threadNum; gameNum < games; gameNum += numThreads)
+			{
+				parallel[gameNum] = play_seeded_game(gameNum);
+			}
+		});
+	}
+	for (std::thread& worker : threads)
+	{
+		worker.join();
+	}
+	double parallelSeconds = seconds_since(start);
+
+	std::cout << "\t" << games << " seeded games on 1 thread:   " << (games / sequentialSeconds) << " games/s\n";
+	std::cout << "\t" << games << " seeded games on " << numThreads << " threads: " << (games / parallelSeconds) << " games/s (";
+	std::cout << (sequential == parallel ? "every game reproduced" : "GAMES DIFFER") << ")" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: GameIO that always chooses the first menu choice and either answers each prompt
+ * 		right away or suspends the awaiting coroutine until the benchmark resumes it (as
+ * 		the game server does). Text written to it is discarded.
+ ***************************************************************************************************/
+
+class PromptCounterIO : public GameIO
+{
+	public:
+		std::ostringstream text;
+		std::coroutine_handle<> waiting;
+		bool suspends = false;
+
+		virtual std::ostream& out() override
+		{
+			return text;
+		}
+
+		virtual int menu([[maybe_unused]] Prompt prompt, [[maybe_unused]] MenuChoices menuChoices) override
+		{
+			return 1;
+		}
+
+		virtual void press_enter() override
+		{
+		}
+
+		virtual void clear_screen() override
+		{
+		}
+
+		virtual void event([[maybe_unused]] EventType type, [[maybe_unused]] int value) override
+		{
+		}
+
+		virtual bool begin_menu([[maybe_unused]] Prompt prompt, [[maybe_unused]] MenuChoices menuChoices, [[maybe_unused]] int& choice) override
+		{
+			choice = 1;
+			return !suspends;
+		}
+
+		virtual void suspend(std::coroutine_handle<> waiting) override
+		{
+			this->waiting = waiting;
+		}
+
+		virtual int take_answer() override
+		{
+			return 1;
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Coroutines used by bench_coroutine. ask_twice() asks for two menu choices and
+ * 		returns their sum, and ask_many() calls it until the received number of prompts have
+ * 		been answered and returns the total of every choice.
+ ***************************************************************************************************/
+
+Task<int> ask_twice(GameIO& io, MenuChoices menuChoices)
+{
+	int first = co_await io.choose(Prompt::MOVE, menuChoices);
+	int second = co_await io.choose(Prompt::MOVE, menuChoices);
+	co_return first + second;
+}
+
+Task<long> ask_many(GameIO& io, int prompts)
+{
+	const std::string_view menuChoices[] = {"North", "South"};
+	long total = 0;
+	for (int count = 0; count < prompts; count += 2)
+	{
+		total += co_await ask_twice(io, menuChoices);
+	}
+	co_return total;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of prompts. Answers that many prompts through co_await without
+ * 		suspending and again suspending and resuming the awaiting coroutine for each one, and
+ * 		prints the time per prompt of each. Then drives a Session (as the game server does)
+ * 		through the received number of answers, answering every menu with its first choice,
+ * 		and prints the time per answer. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_coroutine(int prompts)
+{
+	PromptCounterIO io;
+
+	// Every prompt answered right away
+	BenchClock::time_point start = BenchClock::now();
+	Task<long> immediate = ask_many(io, prompts);
+	immediate.start();
+	long immediateTotal = immediate.get();
+	double immediateSeconds = seconds_since(start);
+
+	// Every prompt suspends the coroutines and is answered by resuming them
+	io.suspends = true;
+	start = BenchClock::now();
+	Task<long> suspended = ask_many(io, prompts);
+	suspended.start();
+	while (!suspended.done())
+	{
+		std::coroutine_handle<> waiting = io.waiting;
+		io.waiting = nullptr;
+		waiting.resume();
+	}
+	long suspendedTotal = suspended.get();
+	double suspendedSeconds = seconds_since(start);
+
+	// Drive a Session, answering each prompt as soon as its output is taken
+	Session session;
+	std::string reply;
+	session.start(reply);
+	long answers = 0;
+	start = BenchClock::now();
+	while (answers < prompts && !session.finished())
+	{
+		bool atMenu = reply.size() >= 13 && reply.compare(reply.size() - 13, 13, "Your choice: ") == 0;
+		reply.clear();
+		session.receive(atMenu ? "1\n" : "\n", reply);
+		answers++;
+	}
+	double sessionSeconds = seconds_since(start);
+
+	std::cout << "coroutine: " << prompts << " prompts (";
+	std::cout << (immediateTotal == suspendedTotal ? "same answers both ways" : "ANSWERS DIFFER") << ")\n";
+	std::cout << "\tco_await, answered right away: " << (immediateSeconds / prompts * 1e9) << " ns/prompt\n";
+	std::cout << "\tco_await, suspend and resume:  " << (suspendedSeconds / prompts * 1e9) << " ns/prompt\n";
+	std::cout << "\tSession, " << answers << " answers:     " << (sessionSeconds / answers * 1e9) << " ns/answer" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of steps. Takes a random walk of that many steps from the Forum,
+ * 		drawing a direction and drawing again until the Board's GameMap allows a move in
+ * 		that direction, then moving to the neighbor in that direction. Prints the
+ * 		throughput and the share of steps that ended at each space. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_walk(int steps)
+{
+	Board board;
+	const GameMap& map = board.get_map();
+	Random rng(2026);
+	long visits[NUM_SPACES] = {};
+	long draws = 0;
+
+	int location = START_LOCATION;
+	BenchClock::time_point start = BenchClock::now();
+	for (int count = 0; count < steps; count++)
+	{
+		int dirNum;
+		do
+		{
+			dirNum = rng.get_int(0, NUM_DIRECTIONS - 1);
+			draws++;
+		} while (((map.get_valid_mask(location) >> dirNum) & 1) == 0);
+
+		location = map.get_neighbor(location, static_cast<Direction>(dirNum));
+		visits[location]++;
+	}
+	double elapsed = seconds_since(start);
+
+	std::cout << "walk: " << steps << " steps in " << elapsed << " s (" << (steps / elapsed) << " steps/s, ";
+	std::cout << (static_cast<double>(draws) / steps) << " draws/step)\n";
+	std::cout << "\tmap of Rome: " << map.memory_bytes() << " bytes, adjacency hash " << std::hex;
+	std::cout << hash_adjacency(ROME_ADJACENCY) << std::dec << "\n\tvisits per space:";
+	for (int index = 0; index < NUM_SPACES; index++)
+	{
+		std::cout << " " << (index + 1) << ": " << (100.0 * visits[index] / steps) << "%";
+	}
+	std::cout << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of spaces. Generates a square grid map with about that many
+ * 		spaces, writes it to a map file, loads the file back, checks that the loaded map is the
+ * 		same, and prints the time taken by each step, the size of the file, and the memory
+ * 		the map takes up (compared with eight Space pointers per space). Also checks that
+ * 		Rome.map loads as the map of Rome. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_map(int spaces)
+{
+	const char MAP_FILE[] = "benchmark_map.tmp";
+
+	GameMap romeFile;
+	romeFile.load("Rome.map");
+
+	std::uint32_t side = 1;
+	while (static_cast<long>(side + 1) * (side + 1) <= spaces)
+	{
+		side++;
+	}
+
+	MapSpec spec;
+	spec.rows = side;
+	spec.cols = side;
+	BenchClock::time_point start = BenchClock::now();
+	std::shared_ptr<const GameMap> grid = MapGenerator(spec).generate();
+	double buildSeconds = seconds_since(start);
+
+	start = BenchClock::now();
+	grid->write(MAP_FILE);
+	double writeSeconds = seconds_since(start);
+
+	struct stat fileInfo;
+	stat(MAP_FILE, &fileInfo);
+
+	start = BenchClock::now();
+	GameMap loaded;
+	loaded.load(MAP_FILE);
+	double loadSeconds = seconds_since(start);
+	unlink(MAP_FILE);
+
+	std::cout << "map: " << side << " x " << side << " grid, " << loaded.num_spaces() << " spaces, ";
+	std::cout << loaded.num_edges() << " edges (" << (loaded == *grid ? "loaded map matches" : "LOADED MAP DIFFERS");
+	std::cout << ", Rome.map " << (romeFile == *GameMap::rome() ? "matches the map of Rome" : "DIFFERS FROM THE MAP OF ROME") << ")\n";
+	std::cout << "\tgenerate: " << buildSeconds << " s  write: " << writeSeconds << " s  load: " << loadSeconds;
+	std::cout << " s (" << (fileInfo.st_size / 1048576.0) << " MB file)\n";
+	std::cout << "\tmemory: " << (loaded.memory_bytes() / 1048576.0) << " MB (";
+	std::cout << (static_cast<double>(loaded.memory_bytes()) / loaded.num_spaces()) << " bytes/space; eight Space pointers would take ";
+	std::cout << (8.0 * sizeof(Space*) * loaded.num_spaces() / 1048576.0) << " MB)" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of spaces. Generates a full square grid map and an irregular one
+ * 		(keeping half of the pairs of neighbors) with about that many spaces, on one thread
+ * 		and on every hardware thread, checks that both give the same map and that every
+ * 		space (including a Domus Aurea) can be reached from the start, and prints the time
+ * 		taken by each. Then plays games headlessly on the irregular map. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_generate(int spaces)
+{
+	std::uint32_t side = 1;
+	while (static_cast<long>(side + 1) * (side + 1) <= spaces)
+	{
+		side++;
+	}
+	int numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	std::cout << "generate: " << side << " x " << side << " maps (" << (static_cast<long>(side) * side) << " spaces)\n";
+
+	std::shared_ptr<const GameMap> irregular;
+	for (int keepPercent : {100, 50})
+	{
+		MapSpec spec;
+		spec.rows = side;
+		spec.cols = side;
+		spec.keepPercent = keepPercent;
+		spec.seed = 2026;
+
+		BenchClock::time_point start = BenchClock::now();
+		std::shared_ptr<const GameMap> sequential = MapGenerator(spec, 1).generate();
+		double sequentialSeconds = seconds_since(start);
+
+		start = BenchClock::now();
+		std::shared_ptr<const GameMap> parallel = MapGenerator(spec, numThreads).generate();
+		double parallelSeconds = seconds_since(start);
+
+		// Check that every space can be reached from the start and find the nearest Domus Aurea
+		std::vector<std::uint32_t> distances = parallel->distances_from(parallel->get_start());
+		long unreachable = 0;
+		std::uint32_t nearestGoal = NO_SPACE;
+		for (std::uint32_t location = 0; location < parallel->num_spaces(); location++)
+		{
+			unreachable += (distances[location] == NO_SPACE);
+			if (parallel->get_type(location) == SpaceType::DOMUS_AUREA && distances[location] < nearestGoal)
+			{
+				nearestGoal = distances[location];
+			}
+		}
+
+		std::cout << "\t" << keepPercent << "% of neighbors kept: " << parallel->num_edges() << " edges, ";
+		std::cout << (*sequential == *parallel ? "same map" : "MAPS DIFFER") << " on 1 and " << numThreads << " threads, ";
+		std::cout << unreachable << " unreachable spaces, nearest Domus Aurea " << nearestGoal << " moves away\n";
+		std::cout << "\t\t1 thread: " << sequentialSeconds << " s  " << numThreads << " threads: " << parallelSeconds << " s\n";
+		irregular = parallel;
+	}
+
+	// Play games on the irregular map, all sharing it
+	const int GAMES = 2000;
+	RandomDecisionSource decisions(2026);
+	OutcomeCounter outcomes;
+	HeadlessIO io(decisions, &outcomes);
+	BenchClock::time_point start = BenchClock::now();
+	for (int gameNum = 0; gameNum < GAMES; gameNum++)
+	{
+		Game game(io, gameNum, irregular);
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+	}
+	double elapsed = seconds_since(start);
+	std::cout << "\t" << GAMES << " headless games on the irregular map: " << (GAMES / elapsed) << " games/s" << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of solves. Solves a new game on the map of Rome for each of the
+ * 		nine pairs of items the prefect can want, prints the fewest steps in which each can be
+ * 		won (and the turns of the first), then times that many solves and solves from partway
+ * 		through a game and on a larger generated map. Returns true if every new game of Rome
+ * 		can be won within MAX_STEPS.
+ ***************************************************************************************************/
+
+bool bench_solve(int solves)
+{
+	Solver solver(GameMap::rome());
+	const ItemId expensiveItems[] = {OLIVE_OIL, SANDALS, WINE};
+	const ItemId cheapItems[] = {GRAIN, SALT, TUNIC};
+	std::vector<GameState> newGames;
+	bool allWinnable = true;
+	std::cout << "solve: fewest steps to win a new game of Rome (MAX_STEPS is " << MAX_STEPS << ")\n";
+	for (ItemId expensive : expensiveItems)
+	{
+		for (ItemId cheap : cheapItems)
+		{
+			Random rng(0);
+			GameState state = new_game_state(rng);
+			state.expensiveChoice = expensive;
+			state.cheapChoice = cheap;
+			newGames.push_back(state);
+
+			Solution solution = solver.solve(state);
+			allWinnable = allWinnable && solution.winnable;
+			std::cout << "\t" << item_name(expensive) << " and " << item_name(cheap) << ": ";
+			if (solution.winnable)
+			{
+				std::cout << solution.steps << " steps (" << solution.statesVisited << " states)\n";
+			}
+			else
+			{
+				std::cout << "CANNOT BE WON within " << MAX_STEPS << " steps (" << solution.statesVisited << " states)\n";
+			}
+		}
+	}
+
+	Solution first = solver.solve(newGames[0]);
+	for (std::size_t turnNum = 0; turnNum < first.turns.size(); turnNum++)
+	{
+		std::cout << "\t\t" << (turnNum + 1) << ". " << solver.describe_turn(first.turns[turnNum]) << "\n";
+	}
+
+	BenchClock::time_point start = BenchClock::now();
+	std::size_t totalSteps = 0;
+	for (int solveNum = 0; solveNum < solves; solveNum++)
+	{
+		totalSteps += solver.solve(newGames[solveNum % newGames.size()]).steps;
+	}
+	double elapsed = seconds_since(start);
+	std::cout << "\t" << solves << " solves of new games: " << (elapsed * 1000.0 / solves) << " ms/solve (";
+	std::cout << (static_cast<double>(totalSteps) / solves) << " steps on average)\n";
+
+	// Solve from the start of every turn of a headless game, as a hint engine would
+	RandomDecisionSource decisions(7);
+	HeadlessIO io(decisions);
+	Game game(io, 7);
+	int turns = 0;
+	start = BenchClock::now();
+	while (!game.game_over())
+	{
+		solver.solve(game.snapshot());
+		game.take_turn();
+		turns++;
+	}
+	elapsed = seconds_since(start);
+	std::cout << "\tsolving at the start of each of " << turns << " turns of a game: " << (elapsed * 1000.0 / turns) << " ms/turn\n";
+
+	// Solve on a larger generated map
+	MapSpec spec;
+	spec.rows = 15;
+	spec.cols = 15;
+	spec.keepPercent = 50;
+	spec.seed = 2026;
+	std::shared_ptr<const GameMap> generated = MapGenerator(spec).generate();
+	Solver generatedSolver(generated);
+	GameState state = newGames[0];
+	state.location = generated->get_start();
+	start = BenchClock::now();
+	Solution solution = generatedSolver.solve(state);
+	elapsed = seconds_since(start);
+	std::cout << "\t" << spec.rows << " x " << spec.cols << " generated map: ";
+	std::cout << (solution.winnable ? std::to_string(solution.steps) + " steps" : std::string("cannot be won"));
+	std::cout << " (" << solution.statesVisited << " states) in " << (elapsed * 1000.0) << " ms" << std::endl;
+
+	if (!allWinnable)
+	{
+		std::cout << "\tCHECK FAILED: a new game of Rome cannot be won within MAX_STEPS" << std::endl;
+	}
+	return allWinnable;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of steps. Computes the probability of winning a new game of Rome
+ * 		with the best play within that many steps, on one thread and on every hardware
+ * 		thread, checks that both give the same probability, and prints the time taken by
+ * 		each. Then does the same from partway through a game. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_expectimax(int steps)
+{
+	const char* const ACTION_NAMES[] = {"keep moving", "enter", "buy", "donate", "bathe"};
+	int numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	std::cout << "expectimax: probability of winning with the best play within " << steps << " steps\n";
+
+	// A new game, and the same game after 10 turns of random choices
+	Random rng(0);
+	GameState newGame = new_game_state(rng);
+	RandomDecisionSource decisions(11);
+	HeadlessIO io(decisions);
+	Game game(io, 11);
+	for (int turn = 0; turn < 10 && !game.game_over(); turn++)
+	{
+		game.take_turn();
+	}
+	GameState partway = game.snapshot();
+
+	for (const GameState& state : {newGame, partway})
+	{
+		int stepsLeft = steps - state.stepsTaken;
+		std::cout << "\t" << (state.stepsTaken == 0 ? "new game" : "partway through a game") << " (";
+		std::cout << stepsLeft << " steps left):\n";
+
+		BenchClock::time_point start = BenchClock::now();
+		ExpectimaxResult sequential = Expectimax(GameMap::rome(), 1).evaluate(state, stepsLeft);
+		double sequentialSeconds = seconds_since(start);
+
+		start = BenchClock::now();
+		ExpectimaxResult parallel = Expectimax(GameMap::rome(), numThreads).evaluate(state, stepsLeft);
+		double parallelSeconds = seconds_since(start);
+
+		std::cout << "\t\twin probability " << parallel.winProbability << " (best now: ";
+		std::cout << ACTION_NAMES[static_cast<int>(parallel.action)] << "), ";
+		std::cout << (sequential.winProbability == parallel.winProbability ? "same" : "DIFFERENT");
+		std::cout << " on 1 and " << numThreads << " threads\n";
+		std::cout << "\t\t1 thread: " << sequentialSeconds << " s (" << (sequential.statesEvaluated / sequentialSeconds);
+		std::cout << " states/s)  " << numThreads << " threads: " << parallelSeconds << " s (";
+		std::cout << parallel.statesEvaluated << " states)" << std::endl;
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of games. For each budget of rollouts per search, and each way
+ * 		of sharing a search among every hardware thread, plays that many games of Rome (the
+ * 		same seeds every time) with the MctsPolicy, and prints the rollouts played per
+ * 		second and the share of the games won. Returns nothing.
+ ***************************************************************************************************/
+
+void bench_mcts(int games)
+{
+	const int BUDGETS[] = {100, 1000, 10000};
+	int numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	std::cout << "mcts: " << games << " games per budget, " << numThreads << " threads\n";
+
+	for (int budget : BUDGETS)
+	{
+		for (MctsMode mode : {MctsMode::ROOT_PARALLEL, MctsMode::TREE_PARALLEL})
+		{
+			Mcts engine(GameMap::rome(), budget, numThreads, mode);
+			std::size_t rollouts = 0;
+			int wins = 0;
+			BenchClock::time_point start = BenchClock::now();
+			for (int gameNum = 0; gameNum < games; gameNum++)
+			{
+				std::uint64_t seed = gameNum + 1;
+				MctsPolicy policy(engine, Random(seed, 1).next());
+				HeadlessIO io(policy);
+				Game game(io, seed);
+				policy.watch(game);
+				while (!game.game_over())
+				{
+					game.take_turn();
+				}
+				rollouts += policy.get_rollouts_played();
+				wins += game.snapshot().withNero;
+			}
+			double seconds = seconds_since(start);
+
+			std::cout << "\t" << budget << " rollouts, " << (mode == MctsMode::ROOT_PARALLEL ? "root" : "tree") << " parallel: ";
+			std::cout << (rollouts / seconds / 1e6) << " million rollouts/s, won " << wins << " of " << games;
+			std::cout << " (" << (100.0 * wins / games) << "%)" << std::endl;
+		}
+	}
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of turns. Plays that many turns of 4,096 games at once in a
+ * 		BatchEnv, with random actions (drawn before the clock starts, so that only the
+ * 		batch is timed) that enter the space about half the time, and starts a new game in
+ * 		every slot whose game has ended after each turn. Prints the game turns played per
+ * 		second by step() alone and with the new games started, and how the games ended.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void bench_batch(int turns)
+{
+	const std::size_t NUM_BATCH_GAMES = 4096;
+	const int ACTION_ROUNDS = 64;
+	BatchEnv env(NUM_BATCH_GAMES, 1);
+
+	Random rng(1);
+	std::vector<std::uint8_t> actions(NUM_BATCH_GAMES * ACTION_ROUNDS);
+	for (std::uint8_t& action : actions)
+	{
+		action = static_cast<std::uint8_t>(rng.get_int(0, ENTER_ACTION + NUM_DIRECTIONS - 1));
+	}
+
+	long long endings[4] = {0, 0, 0, 0};
+	double stepSeconds = 0.0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int turn = 0; turn < turns; turn++)
+	{
+		BenchClock::time_point stepStart = BenchClock::now();
+		env.step(&actions[(turn % ACTION_ROUNDS) * NUM_BATCH_GAMES]);
+		stepSeconds += seconds_since(stepStart);
+
+		const std::uint32_t* status = env.get_status();
+		for (std::size_t gameNum = 0; gameNum < NUM_BATCH_GAMES; gameNum++)
+		{
+			endings[status[gameNum]]++;
+		}
+		env.reset_finished();
+	}
+	double elapsed = seconds_since(start);
+
+	double gameTurns = static_cast<double>(turns) * NUM_BATCH_GAMES;
+	long long gamesEnded = endings[1] + endings[2] + endings[3];
+	std::cout << "batch: " << turns << " turns of " << NUM_BATCH_GAMES << " games (" << gamesEnded << " games played)\n";
+	std::cout << "	step():            " << (gameTurns / stepSeconds / 1e6) << " million game turns/s\n";
+	std::cout << "	with new games:    " << (gameTurns / elapsed / 1e6) << " million game turns/s\n";
+	std::cout << "	wins: " << endings[static_cast<int>(BatchStatus::WON)] << "  deaths: " << endings[static_cast<int>(BatchStatus::DIED)];
+	std::cout << "  out of steps: " << endings[static_cast<int>(BatchStatus::OUT_OF_STEPS)] << std::endl;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a number of games. Plays that many games with every decision made at
+ * 		random, recording each into a ReplayLog and encoding its record into one buffer (as
+ * 		in a log file), then decodes and plays every game again. Prints the cost of recording,
+ * 		the bytes per game, and the games played again per second. Returns true if every
+ * 		game ended in its recorded state.
+ ***************************************************************************************************/
+
+bool bench_replay(int games)
+{
+	std::shared_ptr<const GameMap> map = GameMap::rome();
+	RandomDecisionSource decisions(1);
+	HeadlessIO io(decisions);
+	ReplayLog log;
+	std::string records;
+
+	BenchClock::time_point start = BenchClock::now();
+	for (int count = 0; count < games; count++)
+	{
+		Game game(io, count + 1, map);
+		log.start(game.get_seed(), false, *map);
+		io.set_replay_log(&log);
+		while (!game.game_over())
+		{
+			game.take_turn();
+		}
+		io.set_replay_log(nullptr);
+		log.finish(game.snapshot());
+		log.encode(records);
+	}
+	double recordSeconds = seconds_since(start);
+
+	int matched = 0;
+	const char* next = records.data();
+	const char* end = records.data() + records.size();
+	start = BenchClock::now();
+	while (log.decode(next, end))
+	{
+		if (log.replay(map, nullptr))
+		{
+			matched++;
+		}
+	}
+	double replaySeconds = seconds_since(start);
+
+	std::cout << "replay: " << games << " games recorded in " << recordSeconds << " s (" << (games / recordSeconds) << " games/s), ";
+	std::cout << (static_cast<double>(records.size()) / games) << " bytes per game\n";
+	std::cout << "\tplayed again in " << replaySeconds << " s (" << (games / replaySeconds) << " games/s, ";
+	std::cout << (1000000 / (games / replaySeconds)) << " s per million games on one thread)\n";
+	std::cout << "\tended in the recorded state: " << matched << " of " << games << std::endl;
+	if (matched != games)
+	{
+		std::cout << "\tCHECK FAILED: a game played again did not end in its recorded state" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+
+/***************************************************************************************************
+ * Description: Replacements of the global operator new and operator delete for this program that
+ * 		count the allocations made by each thread, so that bench_allocations can tell how
+ * 		many heap allocations the code it measures makes. Counting is a single increment,
+ * 		so it does not change the results of the other benchmarks.
+ ***************************************************************************************************/
+
+thread_local long long allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+	allocationCount++;
+	void* memory = std::malloc(size > 0 ? size : 1);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, [[maybe_unused]] std::size_t size) noexcept
+{
+	std::free(memory);
+}
+
+
+/***************************************************************************************************
+ * Description: EventSink used by bench_allocations that remembers whether the player entered the
+ * 		space in the current turn (a turn in which they did not only asked them whether to
+ * 		enter the space and where to move).
+ ***************************************************************************************************/
+
+class EnteredSpaceSink : public EventSink
+{
+	public:
+		bool enteredSpace = false;
+
+		virtual void on_event(const GameEvent& gameEvent) override
+		{
+			if (gameEvent.type == EventType::SPACE_ENTERED)
+			{
+				enteredSpace = true;
+			}
+		}
+};
+
+
+/***************************************************************************************************
+ * Description: Counts the heap allocations made by a move prompt at every location of the map of
+ * 		Rome, first building the menu of directions the way Board::move did before each
+ * 		space's menu was built once by the Board (a vector of strings) and then with the
+ * 		Board's menu (on a later visit, as a location's menus are built the first time they
+ * 		are asked for), and then the allocations made by each of the received number of turns
+ * 		of games played headlessly at random (split into the turns in which the player kept
+ * 		moving and those in which they entered the space). Returns true if the move prompts
+ * 		made no allocations and a turn in which the player kept moving allocated nothing but
+ * 		its coroutine frames.
+ ***************************************************************************************************/
+
+bool bench_allocations(int turns)
+{
+	// Coroutine frames of a turn in which the player keeps moving: Game::play_turn,
+	// Game::move_player, and Board::move
+	const long long MOVE_TURN_FRAMES = 3;
+
+	Board board;
+	RandomDecisionSource decisions(1);
+	EnteredSpaceSink events;
+	HeadlessIO io(decisions, &events);
+	std::uint32_t numSpaces = board.get_map().num_spaces();
+
+	// Visit every location once, building its menus (see BoardMenus.hpp)
+	for (std::uint32_t location = 0; location < numSpaces; location++)
+	{
+		board.get_move_menu(location);
+	}
+
+	// Move prompts with the menu built for every prompt, as before, and with the Board's menu
+	long long vectorAllocations = 0;
+	long long boardAllocations = 0;
+	std::vector<std::string_view> moveViews(NUM_DIRECTIONS);
+	for (std::uint32_t location = 0; location < numSpaces; location++)
+	{
+		long long before = allocationCount;
+		std::vector<std::string> moveChoices;
+		for (int dirNum = 0; dirNum < NUM_DIRECTIONS; dirNum++)
+		{
+			std::string directionMenuOption = std::string(DIRECTION_NAMES[dirNum]) + ": ";
+			std::uint32_t neighbor = board.get_map().get_neighbor(location, static_cast<Direction>(dirNum));
+			directionMenuOption += (neighbor != NO_SPACE) ? board.get_space(neighbor)->get_name() : "(cannot move in this direction)";
+			moveChoices.push_back(directionMenuOption);
+		}
+		moveViews.assign(moveChoices.begin(), moveChoices.end());
+		io.menu(Prompt::MOVE, moveViews);
+		vectorAllocations += allocationCount - before;
+
+		before = allocationCount;
+		io.menu(Prompt::MOVE, board.get_move_menu(location));
+		boardAllocations += allocationCount - before;
+	}
+
+	// Full turns of games played at random
+	long long moveTurns = 0;
+	long long moveTurnAllocations = 0;
+	long long moveTurnMost = 0;
+	long long enterTurns = 0;
+	long long enterTurnAllocations = 0;
+	std::uint64_t seed = 1;
+	Game* game = new Game(io, seed);
+	for (int count = 0; count < turns; count++)
+	{
+		if (game->game_over())
+		{
+			delete game;
+			game = new Game(io, ++seed);
+		}
+		events.enteredSpace = false;
+		long long before = allocationCount;
+		game->take_turn();
+		long long allocations = allocationCount - before;
+		if (events.enteredSpace)
+		{
+			enterTurns++;
+			enterTurnAllocations += allocations;
+		}
+		else
+		{
+			moveTurns++;
+			moveTurnAllocations += allocations;
+			moveTurnMost = std::max(moveTurnMost, allocations);
+		}
+	}
+	delete game;
+
+	std::cout << "allocations: move prompt (average of the " << numSpaces << " spaces of Rome): ";
+	std::cout << (static_cast<double>(vectorAllocations) / numSpaces) << " building a vector of strings, ";
+	std::cout << (static_cast<double>(boardAllocations) / numSpaces) << " with the Board's menu\n";
+	std::cout << "	turn (" << turns << " turns): " << (static_cast<double>(moveTurnAllocations) / std::max(moveTurns, 1LL));
+	std::cout << " when the player kept moving (at most " << moveTurnMost << ", " << MOVE_TURN_FRAMES << " of them coroutine frames), ";
+	std::cout << (static_cast<double>(enterTurnAllocations) / std::max(enterTurns, 1LL)) << " when they entered the space" << std::endl;
+	if (boardAllocations != 0 || moveTurnMost > MOVE_TURN_FRAMES)
+	{
+		std::cout << "\tCHECK FAILED: a move prompt or a turn in which the player kept moving allocated memory" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// Determine which benchmark to run and how many iterations were requested
+	const char* name = (argc > 1) ? argv[1] : "all";
+	int iterations = (argc > 2) ? atoi(argv[2]) : 0;
+	bool runAll = (strcmp(name, "all") == 0);
+	bool ranAny = false;
+	bool checkFailed = false;
+
+	if (runAll || strcmp(name, "headless") == 0)
+	{
+		bench_headless(iterations > 0 ? iterations : 20000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "render") == 0)
+	{
+		bench_render(iterations > 0 ? iterations : 200);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "content") == 0)
+	{
+		bench_content(iterations > 0 ? iterations : 2000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "construct") == 0)
+	{
+		bench_construct(iterations > 0 ? iterations : 100000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "snapshot") == 0)
+	{
+		bench_snapshot(iterations > 0 ? iterations : 1000000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "random") == 0)
+	{
+		bench_random(iterations > 0 ? iterations : 20000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "coroutine") == 0)
+	{
+		bench_coroutine(iterations > 0 ? iterations : 10000000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "walk") == 0)
+	{
+		bench_walk(iterations > 0 ? iterations : 50000000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "map") == 0)
+	{
+		bench_map(iterations > 0 ? iterations : 1000000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "generate") == 0)
+	{
+		bench_generate(iterations > 0 ? iterations : 4000000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "solve") == 0)
+	{
+		checkFailed = !bench_solve(iterations > 0 ? iterations : 1000) || checkFailed;
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "expectimax") == 0)
+	{
+		bench_expectimax(iterations > 0 ? iterations : MAX_STEPS);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "batch") == 0)
+	{
+		bench_batch(iterations > 0 ? iterations : 10000);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "mcts") == 0)
+	{
+		bench_mcts(iterations > 0 ? iterations : 10);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "terminal") == 0)
+	{
+		bench_terminal(iterations > 0 ? iterations : 200);
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "input") == 0)
+	{
+		checkFailed = !bench_input(iterations > 0 ? iterations : 10000000) || checkFailed;
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "typeahead") == 0)
+	{
+		checkFailed = !bench_typeahead(iterations > 0 ? iterations : 200) || checkFailed;
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "noninteractive") == 0)
+	{
+		checkFailed = !bench_noninteractive(iterations > 0 ? iterations : 200) || checkFailed;
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "replay") == 0)
+	{
+		checkFailed = !bench_replay(iterations > 0 ? iterations : 100000) || checkFailed;
+		ranAny = true;
+	}
+
+	if (runAll || strcmp(name, "allocations") == 0)
+	{
+		checkFailed = !bench_allocations(iterations > 0 ? iterations : 100000) || checkFailed;
+		ranAny = true;
+	}
+
+	if (!ranAny)
+	{
+		std::cout << "Unknown benchmark: " << name << std::endl;
+		return 1;
+	}
+
+	return checkFailed ? 2 : 0;
+}
@@ -15,6 +15,10 @@
  * 		ensure that the string converted to an int can be stored
  * 		in memory as an int.
  * 		Function only allows the entering of 1 integer per line.
+ * 		Input is read from standard input unless another InputReader
+ * 		is passed, and EndOfInput is thrown if the input ends.
+ * 		The messages displayed for invalid input are declared here so that
+ * 		the game server sends the same ones.
  ********************************************************************************/
 
 #ifndef ENTERVALIDINT_HPP
@@ -22,7 +26,13 @@
 
 #include <string>
 #include <iostream>
-#include <cctype>
-int enterValidInt();
+#include "InputReader.hpp"
+
+// Messages displayed when a line is not an integer, or is an integer that does not fit in an
+// int (also sent by the game server's Session)
+const char NOT_INTEGER_MESSAGE[] = "You did not enter a valid integer. Please enter an integer: ";
+const char OUT_OF_RANGE_MESSAGE[] = "That integer is out of the range of values that can be stored in memory.\nPlease enter a new integer: ";
+
+int enterValidInt(InputReader& input = InputReader::standard_input());
 
 #endif
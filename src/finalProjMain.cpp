@@ -14,59 +14,214 @@
  * 		could result in their characters death and the end of the game regardless of the number of 
  * 		steps taken so far.
  **************************************************************************************************************/
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
 #include "Game.hpp"
+#include "HintTable.hpp"
+#include "MapGenerator.hpp"
+#include "ReplayLog.hpp"
+#include "TerminalIO.hpp"
 
-int main()
+
+/***************************************************************************************************
+ * Description: Helper function that receives the TerminalIO recording a game, its ReplayLog (with
+ * 		the game's end, or that it stopped, recorded), and the name of the log file. Stops
+ * 		recording and appends the log's record to the file, printing an error if it cannot.
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+static void append_record(TerminalIO& io, ReplayLog& replayLog, const char* recordFileName)
+{
+	io.set_replay_log(nullptr);
+	if (!replayLog.append_to(recordFileName))
+	{
+		std::cerr << "Error: could not record the game in " << recordFileName << std::endl;
+	}
+}
+
+
+int main(int argc, char* argv[])
 {
+	// Process command line options. "--diff-render" repaints only the lines of each
+	// screen that have changed instead of redrawing the whole screen. "--seed N" plays
+	// reproducible games: the first game uses seed N, the next N + 1, and so on
+	// (otherwise every game gets an unpredictable seed). "--map FILE" plays on the
+	// board described by a map file instead of the map of Rome. "--random-map ROWS COLS"
+	// plays on a procedurally generated map of that size (generated from the seed, if
+	// one was given). "--hints FILE" offers hints from the table of hints in FILE (built
+	// for the map being played by "make Game_Hints.bin"). "--record FILE" appends a
+	// record of each game (its map, its seed, and the choices made, see ReplayLog.hpp) to
+	// FILE, to be played again by the replay program (a game the input ends in the middle
+	// of is recorded as unfinished). "--non-interactive" (or the environment
+	// variable FINALPROJ_NON_INTERACTIVE set to anything but 0) plays the game from a
+	// script: pauses do not wait for enter, and the game's text is replaced by compact
+	// codes for its events and menus (see TerminalIO.hpp).
+	bool diffRender = false;
+	bool seeded = false;
+	std::uint64_t nextSeed = 0;
+	const char* mapFileName = nullptr;
+	bool randomMap = false;
+	MapSpec spec;
+	const char* hintFileName = nullptr;
+	const char* recordFileName = nullptr;
+	const char* nonInteractiveVariable = getenv("FINALPROJ_NON_INTERACTIVE");
+	bool nonInteractive = (nonInteractiveVariable != nullptr && strcmp(nonInteractiveVariable, "0") != 0);
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--diff-render") == 0)
+		{
+			diffRender = true;
+		}
+		else if (strcmp(argv[index], "--seed") == 0 && index + 1 < argc)
+		{
+			seeded = true;
+			nextSeed = strtoull(argv[++index], nullptr, 10);
+		}
+		else if (strcmp(argv[index], "--map") == 0 && index + 1 < argc)
+		{
+			mapFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--random-map") == 0 && index + 2 < argc)
+		{
+			randomMap = true;
+			spec.rows = strtoul(argv[++index], nullptr, 10);
+			spec.cols = strtoul(argv[++index], nullptr, 10);
+		}
+		else if (strcmp(argv[index], "--hints") == 0 && index + 1 < argc)
+		{
+			hintFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--record") == 0 && index + 1 < argc)
+		{
+			recordFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--non-interactive") == 0)
+		{
+			nonInteractive = true;
+		}
+	}
+
+	// Load the game's text content (and the map file and the table of hints, if they
+	// were given) before taking over the terminal, so that a missing text file or an
+	// invalid map is reported (instead of the game running with blank descriptions).
+	std::shared_ptr<const GameMap> map = GameMap::rome();
+	std::shared_ptr<HintTable> hints;
+	try
+	{
+		Content::get();
+		if (mapFileName != nullptr)
+		{
+			std::shared_ptr<GameMap> loadedMap = std::make_shared<GameMap>();
+			loadedMap->load(mapFileName);
+			map = loadedMap;
+		}
+		else if (randomMap)
+		{
+			spec.seed = seeded ? nextSeed : Random::random_seed();
+			map = MapGenerator(spec).generate();
+		}
+		if (hintFileName != nullptr)
+		{
+			hints = std::make_shared<HintTable>(map);
+			if (!hints->open(hintFileName))
+			{
+				std::cerr << "Error: " << hintFileName << " is not a table of hints for this map" << std::endl;
+				return 1;
+			}
+		}
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "Error: " << error.what() << std::endl;
+		return 1;
+	}
+
+	// All input and output of the game is performed at the terminal.
+	TerminalIO io(diffRender);
+	io.set_non_interactive(nonInteractive);
+
 	// Declare a bool variable "playAgain" for use in the do-while loop that 
 	// iterates once for each game played until the user chooses to quit.
 	bool playAgain = false;
+	ReplayLog replayLog;
+	bool recording = false;
 	
-	do
-	{	
-		// Clear the screen for printing of game instructions.
-		std::system("clear");
+	// Play until the user chooses to exit, or until the input ends (for example, when a
+	// script playing the game runs out of lines), which ends the program normally.
+	try
+	{
+		do
+		{	
+			// Clear the screen for printing of game instructions.
+			io.clear_screen();
 		
-		// Load each line of instructions in from the instructions file,
-		// pausing and having the user press enter every time
-		// the delimination character is reached.
-		std::ifstream inputFile("Game_Instructions.txt");
-		std::string text;
-		while (getline(inputFile, text, DELIM))
-		{
-			std::cout << text;
-			pressEnter();
-		}
-		inputFile.close();
+			// Print each section of the instructions (loaded once per process from the
+			// instructions file, which is split into sections at the delimination character),
+			// pausing and having the user press enter after each one.
+			for (std::string_view text : Content::get().sections(Asset::GAME_INSTRUCTIONS))
+			{
+				io.out() << text;
+				io.press_enter();
+			}
 
-		// Create a new Game object (a new Game is therefore created during
-		// and destroyed at the end of each iteration of this outer do-while loop).
-		Game myGame;
+			// Create a new Game object (a new Game is therefore created during
+			// and destroyed at the end of each iteration of this outer do-while loop).
+			Game myGame(io, seeded ? nextSeed++ : Random::random_seed(), map);
+			myGame.set_hints(hints);
 
-		// Loop to have the user take turns until the Game class signals that the Game is over
-		// (which occurs when the user dies, reaches the step limit,
-		// or wins the game).
-		do
-		{
-			myGame.take_turn();
-		} while(myGame.game_over() == false);
+			// If asked to, record the choices made in the game (and the map it is played on,
+			// with the MapSpec it was generated from, if it was).
+			if (recordFileName != nullptr)
+			{
+				replayLog.start(myGame.get_seed(), hints != nullptr, *map, randomMap ? &spec : nullptr);
+				io.set_replay_log(&replayLog);
+				recording = true;
+			}
+
+			// Loop to have the user take turns until the Game class signals that the Game is over
+			// (which occurs when the user dies, reaches the step limit,
+			// or wins the game).
+			do
+			{
+				myGame.take_turn();
+			} while(myGame.game_over() == false);
 
-		// Use the menu function to ask the user if they want to play again.
-		std::vector<std::string> mainMenu = {"Play again", "Exit"};	
-		std::cout << "Main Menu: " << std::endl;
-		int mainChoice = menu(mainMenu);
+			// Append the record of the game to the log file.
+			if (recording)
+			{
+				replayLog.finish(myGame.snapshot());
+				append_record(io, replayLog, recordFileName);
+				recording = false;
+			}
+
+			// Use the menu function to ask the user if they want to play again.
+			const std::string_view mainMenu[] = {"Play again", "Exit"};	
+			io.out() << "Main Menu: " << std::endl;
+			int mainChoice = io.menu(Prompt::PLAY_AGAIN, mainMenu);
 		
-		// Process the user's choice.
-		if (mainChoice == 1)
-		{
-			playAgain = true;
-		}
-		else
+			// Process the user's choice.
+			if (mainChoice == 1)
+			{
+				playAgain = true;
+			}
+			else
+			{
+				playAgain = false;
+			}
+
+		} while (playAgain);
+	}
+	catch (const EndOfInput&)
+	{
+		// The input ended in the middle of a game, so record the game as unfinished.
+		if (recording)
 		{
-			playAgain = false;
+			replayLog.stop();
+			append_record(io, replayLog, recordFileName);
 		}
-
-	} while (playAgain);
+	}
 
 	return 0;
 }
@@ -0,0 +1,192 @@
+/***************************************************************************************************
+ * Program Name: gameServer.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program hosts many players' games in one process (see GameServer.hpp).
+ * 		Players connect with any line-based client (such as "nc -U gameServer.sock" or
+ * 		"telnet 127.0.0.1 7575") and see the same screens as the terminal game. The
+ * 		loadClient program connects thousands of simulated players to measure it.
+ *
+ * 		Command-line options:
+ * 		- "--unix PATH" listens on a Unix domain socket at PATH
+ * 		- "--tcp PORT" listens on TCP port PORT of the loopback interface
+ * 		- "--threads N" serves connections with N worker threads (one per processor by
+ * 		  default)
+ * 		- "--stats" prints the number of open connections and answers per second every
+ * 		  five seconds
+ * 		- "--hints FILE" offers hints from the table of hints in FILE (see HintTable.hpp) in
+ * 		  every game. The table is mapped into memory once and shared by every session
+ * 		- "--record FILE" appends a record of every game played (see ReplayLog.hpp) to FILE,
+ * 		  to be played again by the replay program
+ *
+ * 		If neither a Unix socket nor a TCP port is given, the server listens on
+ * 		gameServer.sock and on TCP port 7575. The server runs until it receives SIGINT or
+ * 		SIGTERM.
+ **************************************************************************************************/
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <unistd.h>
+#include "GameServer.hpp"
+#include "HintTable.hpp"
+
+// Set by the signal handler when the server should shut down
+volatile std::sig_atomic_t stopRequested = 0;
+
+
+/***************************************************************************************************
+ * Description: Signal handler for SIGINT and SIGTERM. Receives the signal number (unused) and asks
+ * 		the server to shut down. Returns nothing.
+ ***************************************************************************************************/
+
+void request_stop([[maybe_unused]] int signalNum)
+{
+	stopRequested = 1;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives nothing and returns the resident memory of this process in kilobytes
+ * 		(read from /proc/self/statm), or 0 if it cannot be determined.
+ ***************************************************************************************************/
+
+long resident_kilobytes()
+{
+	FILE* statm = fopen("/proc/self/statm", "r");
+	long totalPages = 0;
+	long residentPages = 0;
+	if (statm == nullptr)
+	{
+		return 0;
+	}
+	if (fscanf(statm, "%ld %ld", &totalPages, &residentPages) != 2)
+	{
+		residentPages = 0;
+	}
+	fclose(statm);
+	return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::string unixPath;
+	int tcpPort = 0;
+	int numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	bool printStats = false;
+	const char* hintFileName = nullptr;
+	std::string recordFileName;
+
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--unix") == 0 && index + 1 < argc)
+		{
+			unixPath = argv[++index];
+		}
+		else if (strcmp(argv[index], "--tcp") == 0 && index + 1 < argc)
+		{
+			tcpPort = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--threads") == 0 && index + 1 < argc)
+		{
+			numThreads = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--stats") == 0)
+		{
+			printStats = true;
+		}
+		else if (strcmp(argv[index], "--hints") == 0 && index + 1 < argc)
+		{
+			hintFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--record") == 0 && index + 1 < argc)
+		{
+			recordFileName = argv[++index];
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--unix PATH] [--tcp PORT] [--threads N] [--stats] [--hints FILE] [--record FILE]" << std::endl;
+			return 1;
+		}
+	}
+	if (unixPath.empty() && tcpPort == 0)
+	{
+		unixPath = "gameServer.sock";
+		tcpPort = 7575;
+	}
+
+	// Load the game's text content (and the table of hints, if any) before accepting any player
+	std::shared_ptr<HintTable> hints;
+	try
+	{
+		Content::get();
+		if (hintFileName != nullptr)
+		{
+			hints = std::make_shared<HintTable>(GameMap::rome());
+			if (!hints->open(hintFileName))
+			{
+				std::cerr << "Error: " << hintFileName << " is not a table of hints for this map" << std::endl;
+				return 1;
+			}
+		}
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "Error: " << error.what() << std::endl;
+		return 1;
+	}
+
+	GameServer server(numThreads, hints, recordFileName);
+	if (!unixPath.empty() && !server.listen_unix(unixPath))
+	{
+		std::cerr << "Error: could not listen on " << unixPath << ": " << strerror(errno) << std::endl;
+		return 1;
+	}
+	if (tcpPort != 0 && !server.listen_tcp(tcpPort))
+	{
+		std::cerr << "Error: could not listen on 127.0.0.1:" << tcpPort << ": " << strerror(errno) << std::endl;
+		return 1;
+	}
+
+	signal(SIGINT, request_stop);
+	signal(SIGTERM, request_stop);
+	server.start();
+	std::cout << "gameServer: listening on";
+	if (!unixPath.empty())
+	{
+		std::cout << " " << unixPath;
+	}
+	if (tcpPort != 0)
+	{
+		std::cout << " 127.0.0.1:" << tcpPort;
+	}
+	std::cout << " with " << numThreads << " worker thread(s)" << std::endl;
+
+	// Wait for a signal, printing statistics every five seconds if asked to
+	long lastAnswers = 0;
+	int tenths = 0;
+	while (!stopRequested)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		if (printStats && ++tenths == 50)
+		{
+			long answers = server.get_answers_given();
+			std::cout << "gameServer: " << server.get_open_connections() << " open connections, ";
+			std::cout << (answers - lastAnswers) / 5.0 << " answers/s, " << resident_kilobytes() << " KB resident" << std::endl;
+			lastAnswers = answers;
+			tenths = 0;
+		}
+	}
+
+	server.stop();
+	std::cout << "gameServer: " << server.get_accepted_connections() << " connections served, ";
+	std::cout << server.get_answers_given() << " answers, " << server.get_open_connections() << " still open, ";
+	std::cout << resident_kilobytes() << " KB resident" << std::endl;
+	return 0;
+}
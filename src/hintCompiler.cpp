@@ -0,0 +1,91 @@
+/***************************************************************************************************
+ * Program Name: hintCompiler.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program builds the table of hints (see HintTable.hpp): it evaluates a new game
+ * 		with the Expectimax engine on every hardware thread, walks through every state of
+ * 		the game that can be reached, and writes the best choice in each to a table file
+ * 		keyed with a perfect hash function, so that the game can answer a request for a
+ * 		hint with one lookup.
+ *
+ * 		Usage: hintCompiler [--map FILE] [TABLE_FILE]
+ *
+ * 		The table is built for the map of Rome, or for the map in the map file given, and
+ * 		is written to Game_Hints.bin unless another file name is given. The program is run by
+ * 		"make Game_Hints.bin". A table only works with the map it was built for, and must be
+ * 		built again whenever the rules of a space change.
+ **************************************************************************************************/
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "Expectimax.hpp"
+#include "HintTable.hpp"
+
+
+int main(int argc, char* argv[])
+{
+	// Process command line options
+	const char* fileName = HINT_FILE_NAME;
+	const char* mapFileName = nullptr;
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--map") == 0 && index + 1 < argc)
+		{
+			mapFileName = argv[++index];
+		}
+		else if (argv[index][0] != '-')
+		{
+			fileName = argv[index];
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--map FILE] [TABLE_FILE]\n";
+			return 1;
+		}
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::string tableBytes;
+	try
+	{
+		std::shared_ptr<const GameMap> map = GameMap::rome();
+		if (mapFileName != nullptr)
+		{
+			std::shared_ptr<GameMap> loadedMap = std::make_shared<GameMap>();
+			loadedMap->load(mapFileName);
+			map = loadedMap;
+		}
+
+		// Fill the engine's table from the start of a game on every thread first, so that
+		// walking through the states afterwards only looks up their values
+		Expectimax engine(map);
+		Random rng(0);
+		GameState newGame = new_game_state(rng);
+		newGame.location = map->get_start();
+		engine.evaluate(newGame);
+		engine.set_num_threads(1);
+		tableBytes = HintTable::build(map, engine);
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "hintCompiler: " << error.what() << std::endl;
+		return 1;
+	}
+
+	std::ofstream outputFile(fileName, std::ios::binary | std::ios::trunc);
+	outputFile.write(tableBytes.data(), tableBytes.size());
+	outputFile.close();
+	if (outputFile.fail())
+	{
+		std::cerr << "hintCompiler: could not write " << fileName << std::endl;
+		return 1;
+	}
+
+	const HintHeader* header = reinterpret_cast<const HintHeader*>(tableBytes.data());
+	std::cout << "hintCompiler: wrote " << fileName << " (" << header->numEntries << " states, ";
+	std::cout << tableBytes.size() << " bytes) in ";
+	std::cout << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s" << std::endl;
+	return 0;
+}
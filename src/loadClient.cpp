@@ -0,0 +1,324 @@
+/***************************************************************************************************
+ * Program Name: loadClient.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program measures the game server (gameServer.cpp) by connecting many
+ * 		simulated players to it from a single thread with epoll. Idle players connect, read
+ * 		their first screen, and never answer, which shows how many waiting sessions the
+ * 		server can hold. Active players answer every prompt as soon as it arrives: they
+ * 		press enter at every pause, pick a random choice at every menu, and always choose
+ * 		to play again, so they keep playing until the measurement ends.
+ *
+ * 		Command-line options:
+ * 		- "--unix PATH" or "--tcp PORT" selects the server's socket (gameServer.sock by
+ * 		  default)
+ * 		- "--idle N" connects N idle players (10000 by default)
+ * 		- "--active N" connects N active players (100 by default)
+ * 		- "--seconds S" measures the active players for S seconds (10 by default)
+ *
+ * 		At the end, the program reports how many idle players stayed connected, the number
+ * 		of answers per second the active players gave, the average and 99th percentile time
+ * 		between an answer and the server's next prompt, and the number of games finished.
+ **************************************************************************************************/
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Random.hpp"
+
+typedef std::chrono::steady_clock ClientClock;
+
+// Struct holding one simulated player's connection
+struct Player
+{
+	int fd;
+	bool active;
+	std::string received;			// output received since the last answer
+	ClientClock::time_point answeredAt;	// when the last answer was sent
+};
+
+
+/***************************************************************************************************
+ * Description: Receives the Unix socket path (or an empty string) and the TCP port of the server.
+ * 		Connects to the server and makes the socket non-blocking. Returns the socket, or -1
+ * 		if the connection failed.
+ ***************************************************************************************************/
+
+int connect_to_server(const std::string& unixPath, int tcpPort)
+{
+	int fd;
+	int result;
+	if (!unixPath.empty())
+	{
+		sockaddr_un address;
+		std::memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+		std::strncpy(address.sun_path, unixPath.c_str(), sizeof(address.sun_path) - 1);
+		fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		result = (fd < 0) ? -1 : connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+	}
+	else
+	{
+		sockaddr_in address;
+		std::memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_port = htons(static_cast<uint16_t>(tcpPort));
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		result = (fd < 0) ? -1 : connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+		int noDelay = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+	}
+
+	if (result != 0)
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+		return -1;
+	}
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	return fd;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the output received since a player's last answer. If the output ends with
+ * 		a prompt, returns the number of menu choices (counted from the numbered lines of the
+ * 		last menu), 0 for a pause, or -1 for the main menu. Returns -2 if the output does not
+ * 		end with a prompt yet.
+ ***************************************************************************************************/
+
+int pending_prompt(const std::string& received)
+{
+	const std::string CHOICE_PROMPT = "Your choice: ";
+	const std::string ENTER_PROMPT = "Press enter to continue.";
+
+	if (received.size() >= ENTER_PROMPT.size() &&
+	    received.compare(received.size() - ENTER_PROMPT.size(), ENTER_PROMPT.size(), ENTER_PROMPT) == 0)
+	{
+		return 0;
+	}
+	if (received.size() < CHOICE_PROMPT.size() ||
+	    received.compare(received.size() - CHOICE_PROMPT.size(), CHOICE_PROMPT.size(), CHOICE_PROMPT) != 0)
+	{
+		return -2;
+	}
+	if (received.find("Main Menu: ") != std::string::npos)
+	{
+		return -1;
+	}
+
+	// Count the numbered lines of the last menu
+	size_t position = received.rfind("\n1. ");
+	int choices = 0;
+	while (position != std::string::npos &&
+	       received.compare(position + 1, std::to_string(choices + 1).size() + 2, std::to_string(choices + 1) + ". ") == 0)
+	{
+		choices++;
+		position = received.find('\n', position + 1);
+	}
+	return choices;
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a player whose output ends with a prompt, the number returned by
+ * 		pending_prompt, and the Random number generator. Sends the player's answer and
+ * 		returns a bool indicating whether or not it was sent.
+ ***************************************************************************************************/
+
+bool answer(Player& player, int prompt, Random& rng)
+{
+	std::string line;
+	if (prompt == 0)
+	{
+		line = "\n";
+	}
+	else if (prompt == -1)
+	{
+		line = "1\n";
+	}
+	else
+	{
+		line = std::to_string(rng.get_int(1, prompt)) + "\n";
+	}
+
+	player.received.clear();
+	player.answeredAt = ClientClock::now();
+	return send(player.fd, line.data(), line.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(line.size());
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::string unixPath;
+	int tcpPort = 0;
+	int numIdle = 10000;
+	int numActive = 100;
+	double seconds = 10;
+
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--unix") == 0 && index + 1 < argc)
+		{
+			unixPath = argv[++index];
+		}
+		else if (strcmp(argv[index], "--tcp") == 0 && index + 1 < argc)
+		{
+			tcpPort = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--idle") == 0 && index + 1 < argc)
+		{
+			numIdle = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--active") == 0 && index + 1 < argc)
+		{
+			numActive = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--seconds") == 0 && index + 1 < argc)
+		{
+			seconds = atof(argv[++index]);
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--unix PATH | --tcp PORT] [--idle N] [--active N] [--seconds S]" << std::endl;
+			return 1;
+		}
+	}
+	if (unixPath.empty() && tcpPort == 0)
+	{
+		unixPath = "gameServer.sock";
+	}
+
+	int epollFd = epoll_create1(EPOLL_CLOEXEC);
+	std::vector<Player> players(numIdle + numActive);
+	Random rng(Random::random_seed());
+
+	// Connect every player (idle players first)
+	ClientClock::time_point connectStart = ClientClock::now();
+	for (size_t index = 0; index < players.size(); index++)
+	{
+		Player& player = players[index];
+		player.active = (static_cast<int>(index) >= numIdle);
+		player.fd = connect_to_server(unixPath, tcpPort);
+		if (player.fd < 0)
+		{
+			std::cerr << "loadClient: connection " << index << " failed: " << strerror(errno) << std::endl;
+			return 1;
+		}
+
+		epoll_event event;
+		event.events = EPOLLIN | EPOLLRDHUP;
+		event.data.u64 = index;
+		epoll_ctl(epollFd, EPOLL_CTL_ADD, player.fd, &event);
+	}
+	std::chrono::duration<double> connectSeconds = ClientClock::now() - connectStart;
+
+	// Answer prompts until the measurement ends
+	std::vector<double> latencies;
+	long gamesFinished = 0;
+	long disconnects = 0;
+	std::vector<epoll_event> events(1024);
+	char buffer[16384];
+	ClientClock::time_point start = ClientClock::now();
+	ClientClock::time_point end = start + std::chrono::duration_cast<ClientClock::duration>(std::chrono::duration<double>(seconds));
+	while (ClientClock::now() < end)
+	{
+		int numEvents = epoll_wait(epollFd, events.data(), events.size(), 100);
+		for (int eventNum = 0; eventNum < numEvents; eventNum++)
+		{
+			Player& player = players[events[eventNum].data.u64];
+			bool closed = false;
+			ssize_t bytesRead = read(player.fd, buffer, sizeof(buffer));
+			while (bytesRead > 0)
+			{
+				if (player.active)
+				{
+					player.received.append(buffer, bytesRead);
+				}
+				bytesRead = read(player.fd, buffer, sizeof(buffer));
+			}
+			if (bytesRead == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+			{
+				closed = true;
+			}
+
+			if (closed)
+			{
+				epoll_ctl(epollFd, EPOLL_CTL_DEL, player.fd, nullptr);
+				close(player.fd);
+				player.fd = -1;
+				disconnects++;
+				continue;
+			}
+
+			int prompt = player.active ? pending_prompt(player.received) : -2;
+			if (prompt != -2)
+			{
+				std::chrono::duration<double> latency = ClientClock::now() - player.answeredAt;
+				if (player.answeredAt != ClientClock::time_point())
+				{
+					latencies.push_back(latency.count());
+				}
+				if (prompt == -1)
+				{
+					gamesFinished++;
+				}
+				answer(player, prompt, rng);
+			}
+		}
+	}
+	std::chrono::duration<double> elapsed = ClientClock::now() - start;
+
+	// Count the idle players still connected
+	int idleConnected = 0;
+	for (int index = 0; index < numIdle; index++)
+	{
+		if (players[index].fd >= 0)
+		{
+			idleConnected++;
+		}
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+	double totalLatency = 0;
+	for (double latency : latencies)
+	{
+		totalLatency += latency;
+	}
+
+	std::cout << "loadClient: connected " << players.size() << " players in " << connectSeconds.count() << " s\n";
+	std::cout << "\tidle players still connected: " << idleConnected << " of " << numIdle << "\n";
+	std::cout << "\tactive players: " << numActive << ", " << latencies.size() << " answers in " << elapsed.count() << " s (";
+	std::cout << (latencies.size() / elapsed.count()) << " answers/s), " << gamesFinished << " games finished\n";
+	if (!latencies.empty())
+	{
+		std::cout << "\tlatency: mean " << (totalLatency / latencies.size() * 1e6) << " us, p99 ";
+		std::cout << (latencies[latencies.size() * 99 / 100] * 1e6) << " us\n";
+	}
+	std::cout << "\tdisconnected by the server: " << disconnects << std::endl;
+
+	for (Player& player : players)
+	{
+		if (player.fd >= 0)
+		{
+			close(player.fd);
+		}
+	}
+	close(epollFd);
+	return 0;
+}
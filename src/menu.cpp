@@ -2,26 +2,28 @@
  * Program Name: menu.cpp
  * Author: Alexander Densmore
  * Date: 10/16/18
- * Description: Implemenation file for function that is passed a string vector holding menu choices
- * 		and returns a validated menu choice as an integer. Menu is printed and input
+ * Description: Implemenation file for function that is passed a span of string_views holding menu
+ * 		choices and returns a validated menu choice as an integer. Menu is printed and input
  * 		is read within the function, and the user is repeatedly prompted
  * 		to enter valid intput until valid input is entered. Function uses
  * 		enterValidInt utility function that I created 
  * 		to make sure input is an integer, and function then tests
  * 		integer input to ensure it corresponds to one of the menu choices.
+ * 		The span does not own the choices, so a menu whose text never changes is
+ * 		displayed without copying it.
  **************************************************************************************************/
 #include "menu.hpp"
 using std::cout;
 using std::endl;
 
-int menu(std::vector<std::string> menuChoices)
+int menu(std::span<const std::string_view> menuChoices, InputReader& input)
 {
 	// Display stars at the top of the menu.
 	cout << "\n**************************************************************************\n";
 	
-	// Iterate through each element of the vector and display each menu choice.
+	// Iterate through each element of the span and display each menu choice.
 	// Auto-number each menu choice for ease of menu use.
-	for (int index = 0; index < menuChoices.size(); index++)
+	for (int index = 0; index < static_cast<int>(menuChoices.size()); index++)
 	{
 		cout << (index+1) << ". " << menuChoices[index] << endl;
 	}
@@ -33,16 +35,18 @@ int menu(std::vector<std::string> menuChoices)
 	// Prompt the user for their menu choice. Use enterValidInt to ensure it is an
 	// integer.
 	cout << "\nYour choice: ";
-	int menuChoiceNumber = enterValidInt();
+	int menuChoiceNumber = enterValidInt(input);
 	cout << endl;
 
-	// If menuChoice is not within the valid range of 1 through vector size, use a "while" loop
+	// If menuChoice is not within the valid range of 1 through span size, use a "while" loop
 	// to repeatedly prompt the user to enter a valid choice until one is entered.
-	while (menuChoiceNumber < 1 || menuChoiceNumber > menuChoices.size())
+	// Any answers typed ahead after the invalid choice are discarded.
+	while (menuChoiceNumber < 1 || menuChoiceNumber > static_cast<int>(menuChoices.size()))
 	{
+		input.discard_queued();
 		cout << "Please enter a number between 1 and " << menuChoices.size() << ".\n";
 		cout << "Your choice: ";
-		menuChoiceNumber = enterValidInt();
+		menuChoiceNumber = enterValidInt(input);
 		cout << endl;
 	}
 
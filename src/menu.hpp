@@ -2,21 +2,24 @@
  * Program Name: menu.hpp
  * Author: Alexander Densmore
  * Date: 10/16/18
- * Description: Header file for function that is passed a string vector holding menu choices
- * 		and returns a validated menu choice as an integer. Menu is printed and input
+ * Description: Header file for function that is passed a span of string_views holding menu
+ * 		choices and returns a validated menu choice as an integer. Menu is printed and input
  * 		is read within the function, and the user is repeatedly prompted
  * 		to enter valid intput until valid input is entered. Function uses
  * 		enterValidInt utility function that I created 
  * 		to make sure input is an integer, and function then tests
  * 		integer input to ensure it corresponds to one of the menu choices.
+ * 		The span does not own the choices, so a menu whose text never changes is
+ * 		displayed without copying it.
+ * 		Input is read from standard input unless another InputReader is passed.
  **************************************************************************************************/
 #ifndef MENU_HPP
 #define MENU_HPP
 
-#include <string>
-#include <vector>
+#include <span>
+#include <string_view>
 #include "enterValidInt.hpp"
 
-int menu(std::vector<std::string> menuChoices);
+int menu(std::span<const std::string_view> menuChoices, InputReader& input = InputReader::standard_input());
 
 #endif
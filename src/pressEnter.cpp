@@ -18,29 +18,37 @@
  * 		Function is void since user should not be pressing anything other than
  * 		enter, and, thus, the calling function does not expect
  * 		a return value.
+ * 		(Updated 10/17/26: lines are now read by an InputReader instead of
+ * 		getline. If the input ends, EndOfInput is thrown instead of waiting
+ * 		forever. Input other than enter discards any answers typed ahead
+ * 		on the same line.)
  ********************************************************************************/
 
 #include "pressEnter.hpp"
-using std::string;
-using std::cin;
 using std::cout;
 using std::endl;
 
-void pressEnter()
+void pressEnter(InputReader& input)
 {
-	string input = "";		// user input will be gathered as part of the loop below,
-					// but the string is declared before the loop
-					// so that it still exists after the loop.
+	std::string_view line;		// view of the line of user input, which is read
+					// into the InputReader's buffer instead of a string
 	cout << "\nPress enter to continue.";
-	getline(cin, input);
+	bool lineRead = input.read_line(line);
 	cout << endl;
 
 	// If the user did anything other than presseing enter,
-	// "input" will no longer be an empty string.
-	// Loop until it is an empty string.
-	while (input != "")
+	// "line" will not be empty.
+	// Loop until it is empty.
+	// Any answers typed ahead after the other input are discarded.
+	while (lineRead && !line.empty())
 	{
+		input.discard_queued();
 		cout << "Please do not enter any input before pressing enter. Press enter to continue.";
-		getline(cin, input);
+		lineRead = input.read_line(line);
+	}
+
+	if (!lineRead)
+	{
+		throw EndOfInput();
 	}
 }
@@ -18,6 +18,8 @@
  * 		Function is void since user should not be pressing anything other than
  * 		enter, and, thus, the calling function does not expect
  * 		a return value.
+ * 		Input is read from standard input unless another InputReader
+ * 		is passed, and EndOfInput is thrown if the input ends.
  ********************************************************************************/
 
 #ifndef PRESSENTER_HPP
@@ -25,7 +27,8 @@
 
 #include <string>
 #include <iostream>
+#include "InputReader.hpp"
 
-void pressEnter();
+void pressEnter(InputReader& input = InputReader::standard_input());
 
 #endif
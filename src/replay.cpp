@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ * Program Name: replay.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program plays every game recorded in a log file (see ReplayLog.hpp) again,
+ * 		headlessly and on every hardware thread, and checks that each ends in the state it
+ * 		ended in when it was recorded. It is used to reproduce a game that went wrong (from
+ * 		a log written by "finalProj --record FILE" or "gameServer --record FILE"), and to
+ * 		check that a change to the engine has not changed how any recorded game plays out
+ * 		(from a log of many games written by "simulate --record FILE").
+ *
+ * 		Usage: replay [--map FILE] [--hints FILE] [--threads N] [--verbose] LOG_FILE
+ *
+ * 		The games are played on the map of Rome, or on the map in the map file given, except
+ * 		that a game played on a generated map ("finalProj --random-map") is played on the
+ * 		map generated again from the MapSpec in its record (each such map is generated once).
+ * 		A game whose record names a different map (by its fingerprint) than the one it would
+ * 		be played on is reported as not ending in the recorded state. Games in which hints
+ * 		were offered need the table of hints they were played with (on the map given).
+ * 		Unfinished games (see ReplayLog.hpp) are played as far as they were recorded. The program reports how many games ended in the
+ * 		recorded state, how many did not (listing the first few, or every one with
+ * 		"--verbose"), and how many games were played again per second, and exits with 1 if
+ * 		any game did not end in the recorded state.
+ *
+ * 		The log file is read whole, and the start of each record is found first, so that
+ * 		the records can be handed out to the threads of a WorkStealingPool. Each thread
+ * 		decodes the records it is given into a ReplayLog of its own (reusing its memory)
+ * 		and counts its results in an accumulator of its own.
+ **************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "HintTable.hpp"
+#include "MapGenerator.hpp"
+#include "ReplayLog.hpp"
+#include "WorkStealingPool.hpp"
+
+// Number of games that did not end in the recorded state to list (unless asked to list every one)
+const std::size_t MAX_LISTED = 10;
+
+
+/***************************************************************************************************
+ * Description: Helper struct accumulating the results of the games played again by one thread:
+ * 		the number that ended in the recorded state, and the games that did not (with the
+ * 		reason). It is aligned to a cache line, so that the accumulators of different threads
+ * 		never share one.
+ ***************************************************************************************************/
+
+struct alignas(64) ReplayStats
+{
+	long long matched = 0;
+	std::vector<std::pair<std::size_t, std::string>> failures;
+};
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a log file. Returns its bytes. Throws std::runtime_error if it
+ * 		cannot be read.
+ ***************************************************************************************************/
+
+std::string read_log(const char* fileName)
+{
+	std::ifstream logFile(fileName, std::ios::binary);
+	if (!logFile)
+	{
+		throw std::runtime_error(std::string("Could not open the log file ") + fileName);
+	}
+	std::ostringstream bytes;
+	bytes << logFile.rdbuf();
+	return bytes.str();
+}
+
+
+int main(int argc, char* argv[])
+{
+	// Process command line options
+	const char* mapFileName = nullptr;
+	const char* hintFileName = nullptr;
+	const char* logFileName = nullptr;
+	int numThreads = 0;
+	bool verbose = false;
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--map") == 0 && index + 1 < argc)
+		{
+			mapFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--hints") == 0 && index + 1 < argc)
+		{
+			hintFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--threads") == 0 && index + 1 < argc)
+		{
+			numThreads = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--verbose") == 0)
+		{
+			verbose = true;
+		}
+		else if (argv[index][0] != '-' && logFileName == nullptr)
+		{
+			logFileName = argv[index];
+		}
+		else
+		{
+			logFileName = nullptr;
+			break;
+		}
+	}
+	if (logFileName == nullptr)
+	{
+		std::cerr << "Usage: " << argv[0] << " [--map FILE] [--hints FILE] [--threads N] [--verbose] LOG_FILE\n";
+		return 1;
+	}
+
+	WorkStealingPool pool(numThreads);
+	std::vector<ReplayStats> threadStats(pool.get_num_threads());
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::size_t numRecords = 0;
+	std::size_t logBytes = 0;
+	try
+	{
+		// Load the text content, the map, the table of hints, and the log, and find the
+		// start and the map of every record (generating each map that was generated, once)
+		Content::get();
+		std::shared_ptr<const GameMap> map = GameMap::rome();
+		if (mapFileName != nullptr)
+		{
+			std::shared_ptr<GameMap> loadedMap = std::make_shared<GameMap>();
+			loadedMap->load(mapFileName);
+			map = loadedMap;
+		}
+		std::shared_ptr<HintTable> hints;
+		if (hintFileName != nullptr)
+		{
+			hints = std::make_shared<HintTable>(map);
+			if (!hints->open(hintFileName))
+			{
+				throw std::runtime_error(std::string(hintFileName) + " is not a table of hints for this map");
+			}
+		}
+		std::string bytes = read_log(logFileName);
+		logBytes = bytes.size();
+		std::vector<const char*> records;
+		std::vector<std::shared_ptr<const GameMap>> recordMaps;
+		std::unordered_map<std::uint64_t, std::shared_ptr<const GameMap>> generatedMaps;
+		ReplayLog scanned;
+		const char* next = bytes.data();
+		const char* end = bytes.data() + bytes.size();
+		while (next < end)
+		{
+			records.push_back(next);
+			scanned.decode(next, end);
+			recordMaps.push_back(map);
+			if (scanned.get_map_spec() != nullptr)
+			{
+				std::shared_ptr<const GameMap>& generated = generatedMaps[scanned.get_map_fingerprint()];
+				if (generated == nullptr)
+				{
+					generated = MapGenerator(*scanned.get_map_spec()).generate();
+				}
+				recordMaps.back() = generated;
+			}
+		}
+		numRecords = records.size();
+
+		// Play every game again, each thread decoding its records into its own log
+		std::vector<ReplayLog> threadLogs(pool.get_num_threads());
+		pool.run(records.size(), [&](int threadNum, std::size_t recordNum)
+		{
+			ReplayLog& log = threadLogs[threadNum];
+			ReplayStats& stats = threadStats[threadNum];
+			const char* record = records[recordNum];
+			log.decode(record, end);
+			try
+			{
+				// The table of hints is only for the map given
+				const std::shared_ptr<const GameMap>& recordMap = recordMaps[recordNum];
+				if (log.replay(recordMap, recordMap == map ? hints : nullptr))
+				{
+					stats.matched++;
+				}
+				else
+				{
+					stats.failures.push_back({recordNum, "(seed " + std::to_string(log.get_seed()) + "): ended in a different state"});
+				}
+			}
+			catch (const std::runtime_error& error)
+			{
+				stats.failures.push_back({recordNum, "(seed " + std::to_string(log.get_seed()) + "): " + error.what()});
+			}
+		});
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "Error: " << error.what() << std::endl;
+		return 1;
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Combine the results of every thread, listing the games that went differently in the
+	// order in which they were recorded
+	long long matched = 0;
+	std::vector<std::pair<std::size_t, std::string>> failures;
+	for (const ReplayStats& stats : threadStats)
+	{
+		matched += stats.matched;
+		failures.insert(failures.end(), stats.failures.begin(), stats.failures.end());
+	}
+	std::sort(failures.begin(), failures.end());
+	for (std::size_t failureNum = 0; failureNum < failures.size() && (verbose || failureNum < MAX_LISTED); failureNum++)
+	{
+		std::cout << "replay: game " << failures[failureNum].first << " " << failures[failureNum].second << "\n";
+	}
+
+	std::cout << "replay: " << numRecords << " games (" << logBytes << " bytes), " << matched << " ended in the recorded state, ";
+	std::cout << failures.size() << " did not, " << pool.get_num_threads() << " threads, " << elapsed << " s (";
+	std::cout << static_cast<long long>(numRecords / elapsed) << " games/s)" << std::endl;
+	return failures.empty() ? 0 : 1;
+}
@@ -0,0 +1,424 @@
+/***************************************************************************************************
+ * Program Name: simulate.cpp
+ * Author: Alexander Densmore
+ * Date: 10/17/26
+ * Description: This program plays many complete games with a chosen policy (see Policy.hpp)
+ * 		through the HeadlessIO frontend, on every hardware thread, and reports how the
+ * 		policy fares: how often it wins, dies in the Colosseum, and runs out of steps
+ * 		(each with a 95% confidence interval), and the distributions of the steps taken
+ * 		(in all games, and in the games won) and of the coins left at the end of a game
+ * 		(the mean with a 95% confidence interval, and percentiles). It is used to check
+ * 		the balance of the game after the rules are changed, and how far each way of
+ * 		playing falls short of the best play.
+ *
+ * 		Usage: simulate [--games N] [--policy NAME] [--threads N] [--seed N]
+ * 				[--script FILE] [--map FILE] [--rollouts N] [--record FILE]
+ *
+ * 		The policies are:
+ * 		- random: makes a random choice at every menu (the default)
+ * 		- greedy: follows the fastest way to win, assuming every gamble goes its way
+ * 		- scripted: makes the choices listed in the script file (whitespace-separated
+ * 		  menu choices, as typed at the terminal), and random choices after them
+ * 		- optimal: does whatever makes winning most likely (the start of a game is
+ * 		  evaluated with every thread before the games are played, after which each
+ * 		  decision takes a few lookups in the engine's table)
+ * 		- mcts: does whatever a Monte Carlo tree search with a budget of rollouts (1000
+ * 		  by default) finds best, each search on the thread playing the game
+ *
+ * 		Game number n (counting from 0) is played with seed N + n (the seed being 1 by
+ * 		default), and the policy's own choices are drawn from another stream of the same
+ * 		seed, so the results depend only on the seed, the policy, and the number of games,
+ * 		never on the number of threads. The games are run by a WorkStealingPool, and each
+ * 		thread adds the result of each of its games to its own accumulator. The accumulators
+ * 		are combined once every game is done, so the threads share nothing else while they
+ * 		play. With "--record FILE", each thread also encodes the record of each of its games
+ * 		(see ReplayLog.hpp) into a buffer of its own, and the buffers are written to FILE
+ * 		(replacing it) once every game is done, to be played again by the replay program.
+ **************************************************************************************************/
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "Policy.hpp"
+#include "ReplayLog.hpp"
+#include "WorkStealingPool.hpp"
+
+// Number of standard deviations on each side of an estimate covered by a 95% confidence interval
+const double Z_95 = 1.959964;
+
+
+/***************************************************************************************************
+ * Description: Helper struct accumulating the results of the games played by one thread: the
+ * 		number of games won, lost by dying, and lost by running out of steps, and the number
+ * 		of games ending with each number of steps taken and coins held. It is aligned to a
+ * 		cache line, so that the accumulators of different threads never share one.
+ ***************************************************************************************************/
+
+struct alignas(64) SimulationStats
+{
+	long long games = 0;
+	long long wins = 0;
+	long long deaths = 0;
+	long long timeouts = 0;
+	std::vector<long long> gamesBySteps = std::vector<long long>(MAX_STEPS + 1, 0);
+	std::vector<long long> winsBySteps = std::vector<long long>(MAX_STEPS + 1, 0);
+	std::vector<long long> gamesByCoins;
+
+	// Add the result of a game from its state at the end
+	void record(const GameState& state)
+	{
+		games++;
+		if (state.withNero)
+		{
+			wins++;
+			winsBySteps[state.stepsTaken]++;
+		}
+		else if (!state.stillAlive)
+		{
+			deaths++;
+		}
+		else
+		{
+			timeouts++;
+		}
+		gamesBySteps[state.stepsTaken]++;
+
+		std::size_t coins = state.money > 0 ? state.money : 0;
+		if (coins >= gamesByCoins.size())
+		{
+			gamesByCoins.resize(coins + 1, 0);
+		}
+		gamesByCoins[coins]++;
+	}
+
+	// Add the results accumulated by another thread
+	void merge(const SimulationStats& other)
+	{
+		games += other.games;
+		wins += other.wins;
+		deaths += other.deaths;
+		timeouts += other.timeouts;
+		for (int steps = 0; steps <= MAX_STEPS; steps++)
+		{
+			gamesBySteps[steps] += other.gamesBySteps[steps];
+			winsBySteps[steps] += other.winsBySteps[steps];
+		}
+		if (other.gamesByCoins.size() > gamesByCoins.size())
+		{
+			gamesByCoins.resize(other.gamesByCoins.size(), 0);
+		}
+		for (std::size_t coins = 0; coins < other.gamesByCoins.size(); coins++)
+		{
+			gamesByCoins[coins] += other.gamesByCoins[coins];
+		}
+	}
+};
+
+
+/***************************************************************************************************
+ * Description: Receives a label, the number of games in which something happened, and the number
+ * 		of games. Prints the rate at which it happened with its 95% confidence interval (the
+ * 		Wilson score interval, which stays within 0% to 100% even for rates near either end).
+ * 		Returns nothing.
+ ***************************************************************************************************/
+
+void print_rate(const char* label, long long count, long long games)
+{
+	double rate = static_cast<double>(count) / games;
+	double spread = Z_95 * Z_95 / games;
+	double center = (rate + spread / 2) / (1 + spread);
+	double halfWidth = Z_95 * std::sqrt(rate * (1 - rate) / games + spread / (4 * games)) / (1 + spread);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "\t" << std::left << std::setw(14) << label << std::right << std::setw(7) << (100 * rate) << "%  (95% CI ";
+	std::cout << (100 * (center - halfWidth)) << "% to " << (100 * (center + halfWidth)) << "%, " << count << " games)\n";
+}
+
+
+/***************************************************************************************************
+ * Description: Receives a label and the number of games with each value (such as each number of
+ * 		steps taken). Prints the mean value with its 95% confidence interval, the standard
+ * 		deviation, and the 10th, 50th (median), and 90th percentiles, or "no games" if there
+ * 		are none. Returns nothing.
+ ***************************************************************************************************/
+
+void print_distribution(const char* label, const std::vector<long long>& gamesByValue)
+{
+	long long games = 0;
+	double sum = 0.0;
+	double sumOfSquares = 0.0;
+	for (std::size_t value = 0; value < gamesByValue.size(); value++)
+	{
+		games += gamesByValue[value];
+		sum += static_cast<double>(value) * gamesByValue[value];
+		sumOfSquares += static_cast<double>(value) * value * gamesByValue[value];
+	}
+
+	std::cout << "\t" << std::left << std::setw(14) << label << std::right;
+	if (games == 0)
+	{
+		std::cout << "no games\n";
+		return;
+	}
+
+	double mean = sum / games;
+	double variance = (games > 1) ? (sumOfSquares - sum * mean) / (games - 1) : 0.0;
+	double deviation = std::sqrt(variance > 0.0 ? variance : 0.0);
+
+	// Find the smallest value reached or passed by each percentage of the games
+	std::size_t percentiles[3] = {0, 0, 0};
+	const double FRACTIONS[3] = {0.1, 0.5, 0.9};
+	long long counted = 0;
+	int next = 0;
+	for (std::size_t value = 0; value < gamesByValue.size() && next < 3; value++)
+	{
+		counted += gamesByValue[value];
+		while (next < 3 && counted >= FRACTIONS[next] * games)
+		{
+			percentiles[next++] = value;
+		}
+	}
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "mean " << mean << " (95% CI " << (mean - Z_95 * deviation / std::sqrt(games)) << " to ";
+	std::cout << (mean + Z_95 * deviation / std::sqrt(games)) << "), sd " << deviation;
+	std::cout << ", p10/p50/p90 " << percentiles[0] << "/" << percentiles[1] << "/" << percentiles[2] << "\n";
+}
+
+
+/***************************************************************************************************
+ * Description: Receives the name of a script file. Returns the menu choices listed in it. Throws
+ * 		std::runtime_error if the file cannot be opened or holds anything but numbers.
+ ***************************************************************************************************/
+
+std::vector<int> load_script(const char* fileName)
+{
+	std::ifstream scriptFile(fileName);
+	if (!scriptFile)
+	{
+		throw std::runtime_error(std::string("Could not open the script file ") + fileName);
+	}
+
+	std::vector<int> script;
+	int choice = 0;
+	while (scriptFile >> choice)
+	{
+		script.push_back(choice);
+	}
+	if (!scriptFile.eof())
+	{
+		throw std::runtime_error(std::string("The script file ") + fileName + " must hold only menu choices");
+	}
+	return script;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// Process command line options
+	long long numGames = 10000;
+	std::string policyName = "random";
+	int numThreads = 0;
+	std::uint64_t firstSeed = 1;
+	const char* scriptFileName = nullptr;
+	const char* mapFileName = nullptr;
+	int rollouts = 1000;
+	const char* recordFileName = nullptr;
+	for (int index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--games") == 0 && index + 1 < argc)
+		{
+			numGames = strtoll(argv[++index], nullptr, 10);
+		}
+		else if (strcmp(argv[index], "--policy") == 0 && index + 1 < argc)
+		{
+			policyName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--threads") == 0 && index + 1 < argc)
+		{
+			numThreads = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--seed") == 0 && index + 1 < argc)
+		{
+			firstSeed = strtoull(argv[++index], nullptr, 10);
+		}
+		else if (strcmp(argv[index], "--script") == 0 && index + 1 < argc)
+		{
+			scriptFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--map") == 0 && index + 1 < argc)
+		{
+			mapFileName = argv[++index];
+		}
+		else if (strcmp(argv[index], "--rollouts") == 0 && index + 1 < argc)
+		{
+			rollouts = atoi(argv[++index]);
+		}
+		else if (strcmp(argv[index], "--record") == 0 && index + 1 < argc)
+		{
+			recordFileName = argv[++index];
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--games N] [--policy random|greedy|scripted|optimal|mcts] [--threads N]";
+			std::cerr << " [--seed N] [--script FILE] [--map FILE] [--rollouts N] [--record FILE]\n";
+			return 1;
+		}
+	}
+	if (policyName != "random" && policyName != "greedy" && policyName != "scripted" && policyName != "optimal" &&
+	    policyName != "mcts")
+	{
+		std::cerr << "Error: unknown policy \"" << policyName << "\" (the policies are random, greedy, scripted, optimal, and mcts)\n";
+		return 1;
+	}
+	if (policyName == "scripted" && scriptFileName == nullptr)
+	{
+		std::cerr << "Error: the scripted policy needs a script file (--script FILE)\n";
+		return 1;
+	}
+	if (numGames <= 0)
+	{
+		std::cerr << "Error: the number of games must be positive\n";
+		return 1;
+	}
+	if (rollouts <= 0)
+	{
+		std::cerr << "Error: the number of rollouts must be positive\n";
+		return 1;
+	}
+
+	WorkStealingPool pool(numThreads);
+	std::vector<SimulationStats> threadStats(pool.get_num_threads());
+	std::vector<ReplayLog> threadLogs(pool.get_num_threads());
+	std::vector<std::string> threadRecords(pool.get_num_threads());
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double setupSeconds = 0.0;
+	try
+	{
+		// Load the text content, the map, the script, and the engines used by the
+		// policies, all of which are shared (read-only, apart from the Expectimax
+		// engine's thread-safe table) by every game
+		Content::get();
+		std::shared_ptr<const GameMap> map = GameMap::rome();
+		if (mapFileName != nullptr)
+		{
+			std::shared_ptr<GameMap> loadedMap = std::make_shared<GameMap>();
+			loadedMap->load(mapFileName);
+			map = loadedMap;
+		}
+		std::vector<int> script;
+		if (scriptFileName != nullptr)
+		{
+			script = load_script(scriptFileName);
+		}
+		Solver solver(map);
+		Expectimax engine(map, pool.get_num_threads());
+		Mcts searcher(map, rollouts);
+		if (policyName == "optimal")
+		{
+			RandomDecisionSource setupDecisions(firstSeed);
+			HeadlessIO setupIO(setupDecisions);
+			engine.evaluate(Game(setupIO, firstSeed, map).snapshot());
+			engine.set_num_threads(1);
+		}
+		setupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		// Play every game, each thread recording the results of its games in its own
+		// accumulator
+		pool.run(numGames, [&](int threadNum, std::size_t gameNum)
+		{
+			std::uint64_t seed = firstSeed + gameNum;
+			std::uint64_t policySeed = Random(seed, 1).next();
+			std::unique_ptr<DecisionSource> decisions;
+			Policy* policy = nullptr;
+			if (policyName == "random")
+			{
+				decisions = std::make_unique<RandomDecisionSource>(policySeed);
+			}
+			else if (policyName == "scripted")
+			{
+				decisions = std::make_unique<ScriptedPolicy>(script, policySeed);
+			}
+			else if (policyName == "greedy")
+			{
+				decisions = std::make_unique<GreedyPolicy>(solver, policySeed);
+				policy = static_cast<Policy*>(decisions.get());
+			}
+			else if (policyName == "mcts")
+			{
+				decisions = std::make_unique<MctsPolicy>(searcher, policySeed);
+				policy = static_cast<Policy*>(decisions.get());
+			}
+			else
+			{
+				decisions = std::make_unique<OptimalPolicy>(engine, map, policySeed);
+				policy = static_cast<Policy*>(decisions.get());
+			}
+
+			HeadlessIO io(*decisions);
+			Game game(io, seed, map);
+			if (policy != nullptr)
+			{
+				policy->watch(game);
+			}
+			if (recordFileName != nullptr)
+			{
+				threadLogs[threadNum].start(seed, false, *map);
+				io.set_replay_log(&threadLogs[threadNum]);
+			}
+			while (!game.game_over())
+			{
+				game.take_turn();
+			}
+			threadStats[threadNum].record(game.snapshot());
+			if (recordFileName != nullptr)
+			{
+				threadLogs[threadNum].finish(game.snapshot());
+				threadLogs[threadNum].encode(threadRecords[threadNum]);
+			}
+		});
+
+		if (recordFileName != nullptr)
+		{
+			std::ofstream recordFile(recordFileName, std::ios::binary | std::ios::trunc);
+			for (const std::string& records : threadRecords)
+			{
+				recordFile.write(records.data(), records.size());
+			}
+			recordFile.close();
+			if (recordFile.fail())
+			{
+				throw std::runtime_error(std::string("Could not write the log file ") + recordFileName);
+			}
+		}
+	}
+	catch (const std::runtime_error& error)
+	{
+		std::cerr << "Error: " << error.what() << std::endl;
+		return 1;
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Combine the results of every thread
+	SimulationStats totals;
+	for (const SimulationStats& stats : threadStats)
+	{
+		totals.merge(stats);
+	}
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "simulate: " << totals.games << " games, policy " << policyName << ", seed " << firstSeed << ", ";
+	std::cout << pool.get_num_threads() << " threads, " << elapsed << " s (" << setupSeconds << " s setup, ";
+	std::cout << std::setprecision(0) << (totals.games / (elapsed - setupSeconds)) << " games/s)\n";
+	print_rate("win rate:", totals.wins, totals.games);
+	print_rate("death rate:", totals.deaths, totals.games);
+	print_rate("timeout rate:", totals.timeouts, totals.games);
+	print_distribution("steps taken:", totals.gamesBySteps);
+	print_distribution("steps to win:", totals.winsBySteps);
+	print_distribution("final coins:", totals.gamesByCoins);
+	return 0;
+}